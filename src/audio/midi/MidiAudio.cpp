@@ -32,8 +32,28 @@ void MidiAudio::_initialize(HWND windowHandle) noexcept
     }
 }
 
+MidiAudio::~MidiAudio() noexcept
+{
+    {
+        std::lock_guard lock{ _queueMutex };
+        _shutdown = true;
+    }
+    _queueCV.notify_all();
+    _skip.SetEvent();
+    if (_audioThread.joinable())
+    {
+        _audioThread.join();
+    }
+}
+
 void MidiAudio::BeginSkip() noexcept
 {
+    // Drop everything that hasn't played: a skip (Ctrl+C, shutdown) means
+    // the user wants silence now, not a drained backlog.
+    {
+        std::lock_guard lock{ _queueMutex };
+        _queue.clear();
+    }
     _skip.SetEvent();
 }
 
@@ -50,6 +70,58 @@ try
         return;
     }
 
+    {
+        std::lock_guard lock{ _queueMutex };
+
+        // If the app outruns the audio by this much, it's chirping faster
+        // than anything can play; dropping keeps the backlog (and the delay
+        // between cause and sound) bounded.
+        if (_queue.size() >= 64)
+        {
+            return;
+        }
+
+        _queue.push_back(Note{ windowHandle, noteNumber, velocity, duration });
+
+        if (!_audioThread.joinable())
+        {
+            _audioThread = std::thread{ [this]() noexcept { _audioThreadProc(); } };
+        }
+    }
+    _queueCV.notify_one();
+}
+CATCH_LOG()
+
+// The audio thread: drains the queue in order, sleeping between notes for
+// their durations, exactly as the old synchronous path did - just not on
+// the parser's clock.
+void MidiAudio::_audioThreadProc() noexcept
+{
+    for (;;)
+    {
+        Note note;
+        {
+            std::unique_lock lock{ _queueMutex };
+            _queueCV.wait(lock, [this]() { return _shutdown || !_queue.empty(); });
+            if (_shutdown)
+            {
+                return;
+            }
+            note = _queue.front();
+            _queue.pop_front();
+        }
+        _performNote(note);
+    }
+}
+
+void MidiAudio::_performNote(const Note& note) noexcept
+try
+{
+    const auto windowHandle = note.windowHandle;
+    const auto noteNumber = note.noteNumber;
+    const auto velocity = note.velocity;
+    const auto duration = note.duration;
+
     if (_hwnd != windowHandle)
     {
         _initialize(windowHandle);
@@ -6,12 +6,17 @@ Module Name:
 - MidiAudio.hpp
 
 Abstract:
-  This modules provide basic MIDI support with blocking sound output.
+  This modules provide basic MIDI support. Notes are queued and played by a
+  dedicated audio thread, so callers never wait on sound output.
   */
 
 #pragma once
 
 #include <array>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 struct IDirectSound8;
 struct IDirectSoundBuffer;
@@ -19,16 +24,38 @@ struct IDirectSoundBuffer;
 class MidiAudio
 {
 public:
+    ~MidiAudio() noexcept;
+
     void BeginSkip() noexcept;
     void EndSkip() noexcept;
     void PlayNote(HWND windowHandle, const int noteNumber, const int velocity, const std::chrono::milliseconds duration) noexcept;
 
 private:
+    struct Note
+    {
+        HWND windowHandle = nullptr;
+        int noteNumber = 0;
+        int velocity = 0;
+        std::chrono::milliseconds duration{};
+    };
+
+    void _audioThreadProc() noexcept;
+    void _performNote(const Note& note) noexcept;
     void _initialize(HWND windowHandle) noexcept;
     void _createBuffers() noexcept;
 
     wil::slim_event_manual_reset _skip;
 
+    // The queue between callers (the parse thread) and the audio thread.
+    // Enqueueing is a couple of uncontended mutex instructions; the audio
+    // thread plays notes back-to-back in order, preserving DECPS timing
+    // without the parser ever waiting on the sound hardware.
+    std::mutex _queueMutex;
+    std::condition_variable _queueCV;
+    std::deque<Note> _queue;
+    bool _shutdown = false;
+    std::thread _audioThread;
+
     HWND _hwnd = nullptr;
     wil::unique_hmodule _directSoundModule;
     wil::com_ptr<IDirectSound8> _directSound;
@@ -75,11 +75,13 @@ constexpr OutIt copy_n_small(InIt first, Diff count, OutIt dest)
 // - fillAttribute - the default text attribute
 // Return Value:
 // - constructed object
-ROW::ROW(wchar_t* charsBuffer, uint16_t* charOffsetsBuffer, uint16_t rowWidth, const TextAttribute& fillAttribute) :
+ROW::ROW(wchar_t* charsBuffer, uint16_t* charOffsetsBuffer, uint16_t rowWidth, const TextAttribute& fillAttribute, TextAttributeIdPool& attrPool, std::pmr::memory_resource* charsPool) :
     _charsBuffer{ charsBuffer },
+    _charsPool{ charsPool },
     _chars{ charsBuffer, rowWidth },
     _charOffsets{ charOffsetsBuffer, ::base::strict_cast<size_t>(rowWidth) + 1u },
-    _attr{ rowWidth, fillAttribute },
+    _attr{ rowWidth, attrPool.Intern(fillAttribute) },
+    _attrPool{ &attrPool },
     _columnCount{ rowWidth }
 {
     if (_chars.data())
@@ -95,10 +97,22 @@ void swap(ROW& lhs, ROW& rhs) noexcept
     std::swap(lhs._chars, rhs._chars);
     std::swap(lhs._charOffsets, rhs._charOffsets);
     std::swap(lhs._attr, rhs._attr);
+    std::swap(lhs._attrPool, rhs._attrPool);
+    std::swap(lhs._charsPool, rhs._charsPool);
     std::swap(lhs._columnCount, rhs._columnCount);
     std::swap(lhs._lineRendition, rhs._lineRendition);
     std::swap(lhs._wrapForced, rhs._wrapForced);
     std::swap(lhs._doubleBytePadded, rhs._doubleBytePadded);
+    std::swap(lhs._mayContainWideChars, rhs._mayContainWideChars);
+    std::swap(lhs._generation, rhs._generation);
+    std::swap(lhs._searchMask, rhs._searchMask);
+    std::swap(lhs._searchMaskGeneration, rhs._searchMaskGeneration);
+    // The attr-probe memo travels with the runs and generation it indexes
+    // into; buffer rotation swaps rows through here, and a stale memo whose
+    // generation happens to match would resume from another row's run start.
+    std::swap(lhs._attrProbeGeneration, rhs._attrProbeGeneration);
+    std::swap(lhs._attrProbeRunIndex, rhs._attrProbeRunIndex);
+    std::swap(lhs._attrProbeRunStart, rhs._attrProbeRunStart);
 }
 
 void ROW::SetWrapForced(const bool wrap) noexcept
@@ -141,15 +155,17 @@ void ROW::Reset(const TextAttribute& attr)
 {
     _charsHeap.reset();
     _chars = { _charsBuffer, _columnCount };
-    _attr = { _columnCount, attr };
+    _attr = { _columnCount, _attrPool->Intern(attr) };
     _lineRendition = LineRendition::SingleWidth;
     _wrapForced = false;
     _doubleBytePadded = false;
+    _mayContainWideChars = false;
     _init();
 }
 
 void ROW::_init() noexcept
 {
+    ++_generation;
     std::fill_n(_chars.begin(), _columnCount, UNICODE_SPACE);
     std::iota(_charOffsets.begin(), _charOffsets.end(), uint16_t{ 0 });
 }
@@ -161,8 +177,11 @@ void ROW::_init() noexcept
 // - charOffsetsBuffer - a new backing buffer to use for _charOffsets
 // - rowWidth - the new width, in cells
 // - fillAttribute - the attribute to use for any newly added, trailing cells
-void ROW::Resize(wchar_t* charsBuffer, uint16_t* charOffsetsBuffer, uint16_t rowWidth, const TextAttribute& fillAttribute)
+void ROW::Resize(wchar_t* charsBuffer, uint16_t* charOffsetsBuffer, uint16_t rowWidth, const TextAttribute& fillAttribute, TextAttributeIdPool& attrPool, std::pmr::memory_resource* charsPool)
 {
+    _attrPool = &attrPool;
+    _charsPool = charsPool;
+
     // A default-constructed ROW has no cols/chars to copy.
     // It can be detected by the lack of a _charsBuffer (among others).
     //
@@ -187,12 +206,12 @@ void ROW::Resize(wchar_t* charsBuffer, uint16_t* charOffsetsBuffer, uint16_t row
 
     // Allocate memory for the new `_chars` array.
     // Use the provided charsBuffer if possible, otherwise allocate a `_charsHeap`.
-    std::unique_ptr<wchar_t[]> charsHeap;
+    CharsHeapPtr charsHeap;
     std::span chars{ charsBuffer, rowWidth };
     const std::span charOffsets{ charOffsetsBuffer, ::base::strict_cast<size_t>(rowWidth) + 1u };
     if (const uint16_t charsCapacity = charsToCopy + trailingWhitespace; charsCapacity > rowWidth)
     {
-        charsHeap = std::make_unique_for_overwrite<wchar_t[]>(charsCapacity);
+        charsHeap = _allocateChars(charsCapacity);
         chars = { charsHeap.get(), charsCapacity };
     }
 
@@ -213,12 +232,13 @@ void ROW::Resize(wchar_t* charsBuffer, uint16_t* charOffsetsBuffer, uint16_t row
     _chars = chars;
     _charOffsets = charOffsets;
     _columnCount = rowWidth;
+    ++_generation;
 
     // .resize_trailing_extent() doesn't work if the vector is empty,
     // since there's no trailing item that could be extended.
     if (_attr.empty())
     {
-        _attr = { rowWidth, fillAttribute };
+        _attr = { rowWidth, _attrPool->Intern(fillAttribute) };
     }
     else
     {
@@ -226,9 +246,27 @@ void ROW::Resize(wchar_t* charsBuffer, uint16_t* charOffsetsBuffer, uint16_t row
     }
 }
 
-void ROW::TransferAttributes(const til::small_rle<TextAttribute, uint16_t, 1>& attr, til::CoordType newWidth)
+void ROW::TransferAttributes(const ROW& other, til::CoordType newWidth)
 {
-    _attr = attr;
+    ++_generation;
+    if (_attrPool == other._attrPool)
+    {
+        // Same pool, same ids: a plain run copy.
+        _attr = other._attr;
+    }
+    else
+    {
+        // The rows belong to different buffers (reflow), so the other row's
+        // ids have to be re-interned into our pool, run by run.
+        _attr = { other._attr.size(), _attrPool->Intern(other._attrPool->Lookup(0)) };
+        uint16_t column = 0;
+        for (const auto& run : other._attr.runs())
+        {
+            const auto id = _attrPool->Intern(other._attrPool->Lookup(run.value));
+            _attr.replace(column, gsl::narrow_cast<uint16_t>(column + run.length), id);
+            column += run.length;
+        }
+    }
     _attr.resize_trailing_extent(gsl::narrow<uint16_t>(newWidth));
 }
 
@@ -315,7 +353,8 @@ OutputCellIterator ROW::WriteCells(OutputCellIterator it, const til::CoordType c
             {
                 // Otherwise, commit this color into the run and save off the new one.
                 // Now commit the new color runs into the attr row.
-                _attr.replace(colorStarts, currentIndex, currentColor);
+                ++_generation;
+                _attr.replace(colorStarts, currentIndex, _attrPool->Intern(currentColor));
                 currentColor = it->TextAttr();
                 colorUses = 1;
                 colorStarts = currentIndex;
@@ -395,7 +434,8 @@ OutputCellIterator ROW::WriteCells(OutputCellIterator it, const til::CoordType c
     // Now commit the final color into the attr row
     if (colorUses)
     {
-        _attr.replace(colorStarts, currentIndex, currentColor);
+        ++_generation;
+        _attr.replace(colorStarts, currentIndex, _attrPool->Intern(currentColor));
     }
 
     return it;
@@ -403,13 +443,15 @@ OutputCellIterator ROW::WriteCells(OutputCellIterator it, const til::CoordType c
 
 bool ROW::SetAttrToEnd(const til::CoordType columnBegin, const TextAttribute attr)
 {
-    _attr.replace(_clampedColumnInclusive(columnBegin), _attr.size(), attr);
+    ++_generation;
+    _attr.replace(_clampedColumnInclusive(columnBegin), _attr.size(), _attrPool->Intern(attr));
     return true;
 }
 
 void ROW::ReplaceAttributes(const til::CoordType beginIndex, const til::CoordType endIndex, const TextAttribute& newAttr)
 {
-    _attr.replace(_clampedColumnInclusive(beginIndex), _clampedColumnInclusive(endIndex), newAttr);
+    ++_generation;
+    _attr.replace(_clampedColumnInclusive(beginIndex), _clampedColumnInclusive(endIndex), _attrPool->Intern(newAttr));
 }
 
 [[msvc::forceinline]] ROW::WriteHelper::WriteHelper(ROW& row, til::CoordType columnBegin, til::CoordType columnLimit, const std::wstring_view& chars) noexcept :
@@ -467,6 +509,7 @@ catch (...)
             til::at(row._charOffsets, colEnd) = gsl::narrow_cast<uint16_t>(chBeg | CharOffsetsTrailer);
         }
 
+        row._mayContainWideChars |= width > 1;
         colEndDirty = colEnd;
         charsConsumed = chars.size();
     }
@@ -521,6 +564,7 @@ catch (...)
         if (wide)
         {
             til::at(row._charOffsets, colEnd++) = gsl::narrow_cast<uint16_t>(ch | CharOffsetsTrailer);
+            row._mayContainWideChars = true;
         }
 
         colEndDirty = colEnd;
@@ -597,13 +641,16 @@ catch (...)
     //   const auto trailer  = _mm_and_epi32(in, _mm_set1_epi16(CharOffsetsTrailer));
     //   const auto out = _mm_or_epi32(_mm_add_epi16(off, _mm_set1_epi16(inToOutOffset)), trailer);
     //   _mm_store_si128(..., out);
+    uint16_t anyTrailer = 0;
     for (uint16_t i = 0; i < colEndInput; ++i, ++colEnd)
     {
         const auto ch = til::at(charOffsets, i);
         const auto off = ch & CharOffsetsMask;
         const auto trailer = ch & CharOffsetsTrailer;
+        anyTrailer |= trailer;
         til::at(row._charOffsets, colEnd) = gsl::narrow_cast<uint16_t>((off + inToOutOffset) | trailer);
     }
+    row._mayContainWideChars |= anyTrailer != 0;
 
     colEndDirty = gsl::narrow_cast<uint16_t>(colBeg + colEndDirtyInput);
     charsConsumed = endOffset - baseOffset;
@@ -611,6 +658,7 @@ catch (...)
 
 [[msvc::forceinline]] void ROW::WriteHelper::Finish()
 {
+    ++row._generation;
     colEndDirty = row._adjustForward(colEndDirty);
 
     const uint16_t trailingSpaces = colEndDirty - colEnd;
@@ -673,7 +721,7 @@ void ROW::_resizeChars(uint16_t colEndDirty, uint16_t chBegDirty, size_t chEndDi
         const auto minCapacity = std::min<size_t>(UINT16_MAX, _chars.size() + (_chars.size() >> 1));
         const auto newCapacity = gsl::narrow<uint16_t>(std::max(newLength, minCapacity));
 
-        auto charsHeap = std::make_unique_for_overwrite<wchar_t[]>(newCapacity);
+        auto charsHeap = _allocateChars(newCapacity);
         const std::span chars{ charsHeap.get(), newCapacity };
 
         std::copy_n(_chars.begin(), chBegDirty, chars.begin());
@@ -691,19 +739,47 @@ void ROW::_resizeChars(uint16_t colEndDirty, uint16_t chBegDirty, size_t chEndDi
     }
 }
 
-til::small_rle<TextAttribute, uint16_t, 1>& ROW::Attributes() noexcept
+ROW::AttributeIdRuns& ROW::Attributes() noexcept
 {
     return _attr;
 }
 
-const til::small_rle<TextAttribute, uint16_t, 1>& ROW::Attributes() const noexcept
+const ROW::AttributeIdRuns& ROW::Attributes() const noexcept
 {
     return _attr;
 }
 
 TextAttribute ROW::GetAttrByColumn(const til::CoordType column) const
 {
-    return _attr.at(_clampedUint16(column));
+    const auto col = _clampedUint16(column);
+    const auto& runs = _attr.runs();
+
+    // Resume from the memoized run when the row hasn't mutated since the
+    // last probe and this probe isn't behind it; a backwards (or first)
+    // probe walks from the front, exactly like _attr.at() always did.
+    size_t i = 0;
+    uint16_t start = 0;
+    if (_attrProbeGeneration == _generation && _attrProbeRunIndex < runs.size() && _attrProbeRunStart <= col)
+    {
+        i = _attrProbeRunIndex;
+        start = _attrProbeRunStart;
+    }
+
+    for (; i < runs.size(); ++i)
+    {
+        const auto end = gsl::narrow_cast<uint16_t>(start + til::at(runs, i).length);
+        if (col < end)
+        {
+            _attrProbeGeneration = _generation;
+            _attrProbeRunIndex = gsl::narrow_cast<uint16_t>(i);
+            _attrProbeRunStart = start;
+            return _attrPool->Lookup(til::at(runs, i).value);
+        }
+        start = end;
+    }
+
+    // Past the row's extent: same contract as the at() this replaced.
+    throw std::out_of_range("column out of range");
 }
 
 std::vector<uint16_t> ROW::GetHyperlinks() const
@@ -711,9 +787,10 @@ std::vector<uint16_t> ROW::GetHyperlinks() const
     std::vector<uint16_t> ids;
     for (const auto& run : _attr.runs())
     {
-        if (run.value.IsHyperlink())
+        const auto& attr = _attrPool->Lookup(run.value);
+        if (attr.IsHyperlink())
         {
-            ids.emplace_back(run.value.GetHyperlinkId());
+            ids.emplace_back(attr.GetHyperlinkId());
         }
     }
     return ids;
@@ -809,6 +886,13 @@ std::wstring_view ROW::GlyphAt(til::CoordType column) const noexcept
 
 DbcsAttribute ROW::DbcsAttrAt(til::CoordType column) const noexcept
 {
+    // The fast path for the vast majority of rows: plain narrow text never
+    // sets a trailer bit, so there's no need to inspect the offsets at all.
+    if (!_mayContainWideChars)
+    {
+        return DbcsAttribute::Single;
+    }
+
     const auto col = _clampedColumn(column);
 
     auto attr = DbcsAttribute::Single;
@@ -831,6 +915,79 @@ std::wstring_view ROW::GetText() const noexcept
     return { _chars.data(), _charSize() };
 }
 
+// Returns false if this row has held nothing but narrow glyphs since it was
+// last reset. The flag is conservative: overwriting the only wide glyph with
+// narrow text leaves it set until the row is reset.
+bool ROW::MayContainWideChars() const noexcept
+{
+    return _mayContainWideChars;
+}
+
+// Routine Description:
+// - Allocates overflow char storage from the owning buffer's arena pool, so
+//   that a reflow of many panes at once doesn't hammer the process heap lock.
+//   Falls back to the default resource for rows that never joined a buffer.
+ROW::CharsHeapPtr ROW::_allocateChars(const uint16_t capacity) const
+{
+    const auto resource = _charsPool ? _charsPool : til::pmr::get_default_resource();
+    const auto chars = static_cast<wchar_t*>(resource->allocate(capacity * sizeof(wchar_t), alignof(wchar_t)));
+    return { chars, { resource, capacity } };
+}
+
+// Routine Description:
+// - Returns the text covered by the given column range as one contiguous view.
+//   A range that starts on the trailing half of a wide glyph excludes that
+//   glyph; a range that ends halfway through one includes it - the same
+//   behavior a cell-by-cell walk that skips trailers produces.
+std::wstring_view ROW::GetTextBetween(til::CoordType columnBegin, til::CoordType columnLimit) const noexcept
+{
+    const auto colBeg = _adjustForward(_clampedColumnInclusive(columnBegin));
+    const auto colLim = _adjustForward(_clampedColumnInclusive(std::max(columnBegin, columnLimit)));
+    // Safety: _adjustForward only returns valid columns, and both helpers
+    // clamp into [0, _columnCount], where _charOffsets has _columnCount + 1 entries.
+    const auto chBeg = _uncheckedCharOffset(colBeg);
+    const auto chLim = _uncheckedCharOffset(colLim);
+    return { _chars.data() + chBeg, gsl::narrow_cast<size_t>(chLim - chBeg) };
+}
+
+// Routine Description:
+// - Returns this row's monotonic change generation. It is bumped by every
+//   text or attribute mutation, so consumers can detect changed rows by
+//   comparing integers instead of rescanning content.
+uint32_t ROW::Generation() const noexcept
+{
+    return _generation;
+}
+
+// Routine Description:
+// - Returns a 64-bit character bloom filter summarizing this row's text: for
+//   every character ch, bit (ch & 63) is set. Search uses it to reject rows
+//   without touching their text at all. Computed lazily and cached until the
+//   next write into the row, so search-as-you-type over an idle scrollback
+//   only ever pays for the scan once.
+uint64_t ROW::SearchMask() const noexcept
+{
+    if (_searchMaskGeneration != _generation)
+    {
+        uint64_t mask = 0;
+        for (const auto ch : GetText())
+        {
+            mask |= 1ull << (ch & 63);
+        }
+        _searchMask = mask;
+        _searchMaskGeneration = _generation;
+    }
+    return _searchMask;
+}
+
+// Returns the address of this row's fixed slot inside TextBuffer's chunked
+// char storage. _chars may refer to _charsHeap instead, which is why TextBuffer
+// uses this pointer (and never _chars) to map a row back onto its chunk.
+const wchar_t* ROW::BackingStorage() const noexcept
+{
+    return _charsBuffer;
+}
+
 DelimiterClass ROW::DelimiterClassAt(til::CoordType column, const std::wstring_view& wordDelimiters) const noexcept
 {
     const auto col = _clampedColumn(column);
@@ -25,6 +25,7 @@ Revision History:
 #include "LineRendition.hpp"
 #include "OutputCell.hpp"
 #include "OutputCellIterator.hpp"
+#include "TextAttributeIdPool.hpp"
 
 class TextBuffer;
 
@@ -60,8 +61,68 @@ struct RowWriteState
 class ROW final
 {
 public:
+    // Attribute runs store interned 32-bit ids instead of full TextAttribute
+    // values (see TextAttributeIdPool); two runs fit inline.
+    using AttributeIdRuns = til::small_rle<uint32_t, uint16_t, 2>;
+
+    // Iterates one decoded TextAttribute per column over the interned runs.
+    class AttrIterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = TextAttribute;
+        using pointer = const TextAttribute*;
+        using reference = const TextAttribute&;
+        using difference_type = AttributeIdRuns::const_iterator::difference_type;
+
+        AttrIterator(AttributeIdRuns::const_iterator it, const TextAttributeIdPool* pool) noexcept :
+            _it{ it }, _pool{ pool } {}
+
+        reference operator*() const noexcept { return _pool->Lookup(*_it); }
+        pointer operator->() const noexcept { return &_pool->Lookup(*_it); }
+        AttrIterator& operator++() noexcept
+        {
+            ++_it;
+            return *this;
+        }
+        AttrIterator& operator--() noexcept
+        {
+            --_it;
+            return *this;
+        }
+        AttrIterator& operator+=(difference_type d) noexcept
+        {
+            _it += d;
+            return *this;
+        }
+        AttrIterator& operator-=(difference_type d) noexcept
+        {
+            _it -= d;
+            return *this;
+        }
+        AttrIterator operator+(difference_type d) const noexcept
+        {
+            auto copy = *this;
+            copy += d;
+            return copy;
+        }
+        AttrIterator operator-(difference_type d) const noexcept
+        {
+            auto copy = *this;
+            copy -= d;
+            return copy;
+        }
+        difference_type operator-(const AttrIterator& other) const noexcept { return _it - other._it; }
+        bool operator==(const AttrIterator& other) const noexcept { return _it == other._it; }
+        bool operator!=(const AttrIterator& other) const noexcept { return _it != other._it; }
+
+    private:
+        AttributeIdRuns::const_iterator _it;
+        const TextAttributeIdPool* _pool = nullptr;
+    };
+
     ROW() = default;
-    ROW(wchar_t* charsBuffer, uint16_t* charOffsetsBuffer, uint16_t rowWidth, const TextAttribute& fillAttribute);
+    ROW(wchar_t* charsBuffer, uint16_t* charOffsetsBuffer, uint16_t rowWidth, const TextAttribute& fillAttribute, TextAttributeIdPool& attrPool, std::pmr::memory_resource* charsPool);
 
     ROW(const ROW& other) = delete;
     ROW& operator=(const ROW& other) = delete;
@@ -79,8 +140,8 @@ public:
     LineRendition GetLineRendition() const noexcept;
 
     void Reset(const TextAttribute& attr);
-    void Resize(wchar_t* charsBuffer, uint16_t* charOffsetsBuffer, uint16_t rowWidth, const TextAttribute& fillAttribute);
-    void TransferAttributes(const til::small_rle<TextAttribute, uint16_t, 1>& attr, til::CoordType newWidth);
+    void Resize(wchar_t* charsBuffer, uint16_t* charOffsetsBuffer, uint16_t rowWidth, const TextAttribute& fillAttribute, TextAttributeIdPool& attrPool, std::pmr::memory_resource* charsPool);
+    void TransferAttributes(const ROW& other, til::CoordType newWidth);
 
     til::CoordType NavigateToPrevious(til::CoordType column) const noexcept;
     til::CoordType NavigateToNext(til::CoordType column) const noexcept;
@@ -93,8 +154,8 @@ public:
     void ReplaceText(RowWriteState& state);
     til::CoordType CopyRangeFrom(til::CoordType columnBegin, til::CoordType columnLimit, const ROW& other, til::CoordType& otherBegin, til::CoordType otherLimit);
 
-    til::small_rle<TextAttribute, uint16_t, 1>& Attributes() noexcept;
-    const til::small_rle<TextAttribute, uint16_t, 1>& Attributes() const noexcept;
+    AttributeIdRuns& Attributes() noexcept;
+    const AttributeIdRuns& Attributes() const noexcept;
     TextAttribute GetAttrByColumn(til::CoordType column) const;
     std::vector<uint16_t> GetHyperlinks() const;
     uint16_t size() const noexcept;
@@ -104,11 +165,16 @@ public:
     bool ContainsText() const noexcept;
     std::wstring_view GlyphAt(til::CoordType column) const noexcept;
     DbcsAttribute DbcsAttrAt(til::CoordType column) const noexcept;
+    bool MayContainWideChars() const noexcept;
     std::wstring_view GetText() const noexcept;
+    std::wstring_view GetTextBetween(til::CoordType columnBegin, til::CoordType columnLimit) const noexcept;
+    uint32_t Generation() const noexcept;
+    uint64_t SearchMask() const noexcept;
+    const wchar_t* BackingStorage() const noexcept;
     DelimiterClass DelimiterClassAt(til::CoordType column, const std::wstring_view& wordDelimiters) const noexcept;
 
-    auto AttrBegin() const noexcept { return _attr.begin(); }
-    auto AttrEnd() const noexcept { return _attr.end(); }
+    AttrIterator AttrBegin() const noexcept { return { _attr.begin(), _attrPool }; }
+    AttrIterator AttrEnd() const noexcept { return { _attr.end(), _attrPool }; }
 
 #ifdef UNIT_TESTING
     friend constexpr bool operator==(const ROW& a, const ROW& b) noexcept;
@@ -173,6 +239,24 @@ private:
     template<typename T>
     constexpr uint16_t _clampedColumnInclusive(T v) const noexcept;
 
+    // Returns overflow char storage from the owning TextBuffer's arena pool.
+    // The deleter remembers its resource, so a ROW can safely outlive a
+    // change of _charsPool (it can't outlive the pool itself; TextBuffer
+    // destroys its rows before the arena).
+    struct CharsHeapDeleter
+    {
+        std::pmr::memory_resource* resource = nullptr;
+        uint16_t capacity = 0;
+
+        void operator()(wchar_t* p) const noexcept
+        {
+            resource->deallocate(p, capacity * sizeof(wchar_t), alignof(wchar_t));
+        }
+    };
+    using CharsHeapPtr = std::unique_ptr<wchar_t[], CharsHeapDeleter>;
+
+    CharsHeapPtr _allocateChars(uint16_t capacity) const;
+
     uint16_t _adjustBackward(uint16_t column) const noexcept;
     uint16_t _adjustForward(uint16_t column) const noexcept;
 
@@ -200,9 +284,11 @@ private:
     // _charsBuffer fits _columnCount characters at most.
     wchar_t* _charsBuffer = nullptr;
     // ...but if this ROW needs to store more than _columnCount characters
-    // then it will allocate a larger string on the heap and store it here.
-    // The capacity of this string on the heap is stored in _chars.size().
-    std::unique_ptr<wchar_t[]> _charsHeap;
+    // then it will allocate a larger string from the buffer's arena pool and
+    // store it here. The capacity of this string is stored in _chars.size().
+    CharsHeapPtr _charsHeap;
+    // The arena all rows of one TextBuffer draw their overflow storage from.
+    std::pmr::memory_resource* _charsPool = nullptr;
     // _chars either refers to our _charsBuffer or _charsHeap, defaulting to the former.
     // _chars.size() is NOT the length of the string, but rather its capacity.
     // _charOffsets[_columnCount] stores the length.
@@ -224,9 +310,28 @@ private:
     // In other words, _charOffsets tells us both the width in chars and width in columns.
     // See CharOffsetsTrailer for more information.
     std::span<uint16_t> _charOffsets;
-    // _attr is a run-length-encoded vector of TextAttribute with a decompressed
-    // length equal to _columnCount (= 1 TextAttribute per column).
-    til::small_rle<TextAttribute, uint16_t, 1> _attr;
+    // _attr is a run-length-encoded vector of interned attribute ids with a
+    // decompressed length equal to _columnCount (= 1 attribute per column).
+    // _attrPool (owned by TextBuffer) maps the ids back to TextAttributes.
+    AttributeIdRuns _attr;
+    TextAttributeIdPool* _attrPool = nullptr;
+    // Monotonic change generation, bumped by every mutation of the row's
+    // text or attributes. Consumers (the search mask below, highlight and
+    // render caches) compare generations instead of rescanning content.
+    uint32_t _generation = 1;
+    // A lazily computed character bloom filter over _chars for search (see
+    // SearchMask), and the generation it was computed at.
+    mutable uint64_t _searchMask = 0;
+    mutable uint32_t _searchMaskGeneration = 0;
+
+    // Memoized cursor into _attr's runs for GetAttrByColumn. Accessibility
+    // queries and hit tests probe columns in ascending order, so resuming
+    // from where the previous probe landed makes those O(1) instead of
+    // O(runs)-from-the-front on wide, fragmented rows. Validated against
+    // _generation, like the search mask above.
+    mutable uint32_t _attrProbeGeneration = 0;
+    mutable uint16_t _attrProbeRunIndex = 0;
+    mutable uint16_t _attrProbeRunStart = 0;
     // The width of the row in visual columns.
     uint16_t _columnCount = 0;
     // Stores double-width/height (DECSWL/DECDWL/DECDHL) attributes.
@@ -235,6 +340,10 @@ private:
     bool _wrapForced = false;
     // Occurs when the user runs out of text to support a double byte character and we're forced to the next line
     bool _doubleBytePadded = false;
+    // Set as soon as any wide glyph (= any trailer offset) is written into
+    // this row and only cleared on Reset. Lets DbcsAttrAt skip the offset
+    // inspection entirely for the common all-narrow case.
+    bool _mayContainWideChars = false;
 };
 
 #ifdef UNIT_TESTING
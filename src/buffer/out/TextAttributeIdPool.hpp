@@ -0,0 +1,73 @@
+/*++
+Copyright (c) Microsoft Corporation
+Licensed under the MIT license.
+
+Module Name:
+- TextAttributeIdPool.hpp
+
+Abstract:
+- An interning pool that maps TextAttributes to dense 32-bit ids and back.
+  Attribute runs store the ids instead of full TextAttribute values, which
+  shrinks the hottest data structure in the buffer and turns every run
+  comparison into a single integer compare. Because equal attributes always
+  intern to the same id, id equality is attribute equality and run-length
+  merging on ids behaves exactly like it did on the full values.
+--*/
+
+#pragma once
+
+#include <til/hash.h>
+
+#include "TextAttribute.hpp"
+
+class TextAttributeIdPool final
+{
+public:
+    TextAttributeIdPool()
+    {
+        // Id 0 is always the default attribute.
+        Intern(TextAttribute{});
+    }
+
+    // Returns the id for the given attribute, adding it to the pool on first use.
+    // Takes the attribute by value so that callers may pass a Lookup() result
+    // of this very pool without aliasing _attrs while it grows.
+    uint32_t Intern(const TextAttribute attr)
+    {
+        const auto [it, inserted] = _ids.emplace(attr, gsl::narrow_cast<uint32_t>(_attrs.size()));
+        if (inserted)
+        {
+            _attrs.emplace_back(attr);
+        }
+        return it->second;
+    }
+
+    const TextAttribute& Lookup(const uint32_t id) const noexcept
+    {
+        return til::at(_attrs, id);
+    }
+
+    // Drops all interned attributes. Only valid when every row that stored
+    // ids is reset right afterwards (TextBuffer::Reset does exactly that);
+    // this keeps the pool from growing forever across screen clears.
+    void Reset()
+    {
+        _ids.clear();
+        _attrs.clear();
+        Intern(TextAttribute{});
+    }
+
+private:
+    struct Hasher
+    {
+        size_t operator()(const TextAttribute& attr) const noexcept
+        {
+            // TextAttribute's operator== is a memcmp, so hashing the raw
+            // bytes is consistent with equality.
+            return til::hash(&attr, sizeof(attr));
+        }
+    };
+
+    std::unordered_map<TextAttribute, uint32_t, Hasher> _ids;
+    std::vector<TextAttribute> _attrs;
+};
@@ -12,6 +12,40 @@
 
 using namespace Microsoft::Console::Types;
 
+namespace
+{
+    // Returns whether ch occurs anywhere in text.
+    // Find-in-scrollback spends nearly all of its time rejecting rows that
+    // don't contain the needle at all, so this is the hot loop: on x64 it
+    // compares 8 characters per iteration.
+    bool textContainsChar(const std::wstring_view text, const wchar_t ch) noexcept
+    {
+        auto it = text.data();
+        const auto end = it + text.size();
+
+#ifdef _M_AMD64
+        const auto needle = _mm_set1_epi16(static_cast<short>(ch));
+        for (; end - it >= 8; it += 8)
+        {
+            const auto haystack = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(haystack, needle)))
+            {
+                return true;
+            }
+        }
+#endif
+
+        for (; it != end; ++it)
+        {
+            if (*it == ch)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
 // Routine Description:
 // - Constructs a Search object.
 // - Make a Search object then call .FindNext() to locate items.
@@ -68,20 +102,50 @@ Search::Search(Microsoft::Console::Render::IRenderData& renderData,
 // - True if we found another item. False if we've reached the end of the buffer.
 // - NOTE: You can FindNext() again after False to go around the buffer again.
 bool Search::FindNext()
+{
+    return FindNext(SIZE_MAX) == Result::Found;
+}
+
+// Routine Description
+// - Like the parameterless FindNext, but gives up after examining roughly
+//   `budget` positions (skipped rows count as one), so a caller scanning a
+//   large scrollback can release the console lock between chunks. The
+//   internal position is retained across a BudgetExhausted return: call
+//   again to continue where the last chunk stopped.
+// Arguments:
+// - budget - How many positions to examine before yielding.
+// Return Value:
+// - Found, NotFound (searched all the way around), or BudgetExhausted.
+Search::Result Search::FindNext(size_t budget)
 {
     if (_reachedEnd)
     {
         _reachedEnd = false;
-        return false;
+        return Result::NotFound;
     }
 
     do
     {
+        if (budget == 0)
+        {
+            return Result::BudgetExhausted;
+        }
+        --budget;
+
+        // Row-level prefilter: a row that doesn't contain the needle's first
+        // character anywhere cannot contain the start of a match, so we hop
+        // straight to the next row instead of testing it cell by cell.
+        if (!_RowMayContainNeedle(_coordNext.y))
+        {
+            _SkipCurrentRow();
+            continue;
+        }
+
         if (_FindNeedleInHaystackAt(_coordNext, _coordSelStart, _coordSelEnd))
         {
             _UpdateNextPosition();
             _reachedEnd = _coordNext == _coordAnchor;
-            return true;
+            return Result::Found;
         }
         else
         {
@@ -90,7 +154,85 @@ bool Search::FindNext()
 
     } while (_coordNext != _coordAnchor);
 
-    return false;
+    return Result::NotFound;
+}
+
+// Routine Description:
+// - Fast per-row prefilter for FindNext: scans the row's contiguous text for
+//   the needle's first character, 8 cells at a time on x64.
+// Arguments:
+// - row - The buffer row to check
+// Return Value:
+// - False if no match can possibly start in this row. True if the row needs
+//   the full cell-by-cell comparison (or the prefilter doesn't apply).
+bool Search::_RowMayContainNeedle(const til::CoordType row) const noexcept
+{
+    if (_needle.empty() || _needle.front().empty())
+    {
+        return true;
+    }
+
+    const auto first = _needle.front().front();
+    const auto& bufferRow = _renderData.GetTextBuffer().GetRowByOffset(row);
+
+    if (_sensitivity == Sensitivity::CaseSensitive)
+    {
+        // The row maintains a character bloom filter across writes, so rows
+        // that haven't changed since the last search are rejected without
+        // touching their text at all (search-as-you-type hits this a lot).
+        if (!(bufferRow.SearchMask() & (1ull << (first & 63))))
+        {
+            return false;
+        }
+        return textContainsChar(bufferRow.GetText(), first);
+    }
+
+    // Case-insensitive searches can only prefilter ASCII needles, where the
+    // two casings are the only characters that fold together. (Outside of
+    // ASCII that doesn't hold: U+212A KELVIN SIGN lowercases to "k".)
+    if (first >= 0x80)
+    {
+        return true;
+    }
+
+    const auto lower = gsl::narrow_cast<wchar_t>(::towlower(first));
+    const auto upper = gsl::narrow_cast<wchar_t>(::towupper(first));
+    const auto mask = bufferRow.SearchMask();
+    if (!(mask & ((1ull << (lower & 63)) | (1ull << (upper & 63)))))
+    {
+        return false;
+    }
+
+    const auto text = bufferRow.GetText();
+    return textContainsChar(text, lower) || (upper != lower && textContainsChar(text, upper));
+}
+
+// Routine Description:
+// - Moves the search position past the remainder of the current row (or past
+//   its beginning when searching backwards). If the anchor sits inside the
+//   skipped span, the position lands exactly on the anchor so that FindNext's
+//   termination condition still fires.
+void Search::_SkipCurrentRow()
+{
+    const auto previous = _coordNext;
+
+    if (_direction == Direction::Forward)
+    {
+        _coordNext.x = _renderData.GetTextBuffer().GetSize().RightInclusive();
+        _IncrementCoord(_coordNext);
+    }
+    else
+    {
+        _coordNext.x = 0;
+        _DecrementCoord(_coordNext);
+    }
+    _ClampNextPosition();
+
+    if (_coordAnchor.y == previous.y &&
+        (_direction == Direction::Forward ? _coordAnchor.x >= previous.x : _coordAnchor.x <= previous.x))
+    {
+        _coordNext = _coordAnchor;
+    }
 }
 
 // Routine Description:
@@ -300,11 +442,17 @@ void Search::_UpdateNextPosition()
         THROW_HR(E_NOTIMPL);
     }
 
-    // To reduce wrap-around time, if the next position is larger than
-    // the end position of the written text
-    // We put the next position to:
-    // Forward: (0, 0)
-    // Backward: the position of the end of the text buffer
+    _ClampNextPosition();
+}
+
+// Routine Description:
+// - To reduce wrap-around time, if the next position is larger than
+//   the end position of the written text
+//   We put the next position to:
+//   Forward: (0, 0)
+//   Backward: the position of the end of the text buffer
+void Search::_ClampNextPosition() noexcept
+{
     const auto bufferEndPosition = _renderData.GetTextBufferEndPosition();
 
     if (_coordNext.y > bufferEndPosition.y ||
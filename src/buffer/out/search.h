@@ -39,6 +39,13 @@ public:
         CaseSensitive
     };
 
+    enum class Result
+    {
+        Found,
+        NotFound,
+        BudgetExhausted
+    };
+
     Search(Microsoft::Console::Render::IRenderData& renderData,
            const std::wstring_view str,
            const Direction dir,
@@ -51,6 +58,7 @@ public:
            const til::point anchor);
 
     bool FindNext();
+    Result FindNext(size_t budget);
     void Select() const;
     void Color(const TextAttribute attr) const;
 
@@ -60,7 +68,10 @@ private:
     wchar_t _ApplySensitivity(const wchar_t wch) const noexcept;
     bool _FindNeedleInHaystackAt(const til::point pos, til::point& start, til::point& end) const;
     bool _CompareChars(const std::wstring_view one, const std::wstring_view two) const noexcept;
+    bool _RowMayContainNeedle(const til::CoordType row) const noexcept;
+    void _SkipCurrentRow();
     void _UpdateNextPosition();
+    void _ClampNextPosition() noexcept;
 
     void _IncrementCoord(til::point& coord) const noexcept;
     void _DecrementCoord(til::point& coord) const noexcept;
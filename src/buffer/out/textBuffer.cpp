@@ -6,6 +6,7 @@
 #include "textBuffer.hpp"
 
 #include <til/hash.h>
+#include <til/small_vector.h>
 #include <til/unicode.h>
 
 #include "../renderer/base/renderer.hpp"
@@ -17,6 +18,15 @@ namespace
 {
     struct BufferAllocator
     {
+        // Rows are handed out from fixed-size chunks instead of one contiguous
+        // allocation spanning the entire scrollback. The _storage vector of ROWs
+        // acts as the indirection table between logical row order and the chunked
+        // backing memory, which makes circular rotation a plain index bump and
+        // means a 100k-line scrollback never asks the OS for one giant block.
+        // 256KiB amortizes the VirtualAlloc overhead across a few hundred rows,
+        // while staying small enough to be returned to the OS piecemeal.
+        static constexpr size_t TargetChunkSize = 256 * 1024;
+
         BufferAllocator(til::size sz)
         {
             const auto w = gsl::narrow<uint16_t>(sz.width);
@@ -27,34 +37,64 @@ namespace
             // That extra column stores the past-the-end _chars pointer.
             const auto indicesBytes = w * sizeof(uint16_t) + sizeof(uint16_t);
             const auto rowStride = charsBytes + indicesBytes;
-            // 65535*65535 cells would result in a charsAreaSize of 8GiB.
-            // --> Use uint64_t so that we can safely do our calculations even on x86.
-            const auto allocSize = gsl::narrow<size_t>(::base::strict_cast<uint64_t>(rowStride) * ::base::strict_cast<uint64_t>(h));
-
-            _buffer = wil::unique_virtualalloc_ptr<std::byte>{ static_cast<std::byte*>(VirtualAlloc(nullptr, allocSize, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE)) };
-            THROW_IF_NULL_ALLOC(_buffer);
 
-            _data = std::span{ _buffer.get(), allocSize }.begin();
             _rowStride = rowStride;
             _indicesOffset = charsBytes;
             _width = w;
             _height = h;
+            _rowsPerChunk = gsl::narrow_cast<size_t>(std::clamp<uint64_t>(TargetChunkSize / rowStride, 1, h));
+
+            // All chunks are committed up front so that a failed resize can
+            // never leave some rows pointing into partially allocated memory.
+            const auto chunkCount = (gsl::narrow_cast<size_t>(h) + _rowsPerChunk - 1) / _rowsPerChunk;
+            _chunks.reserve(chunkCount);
+            for (size_t rowsLeft = h; rowsLeft > 0;)
+            {
+                const auto rows = std::min(_rowsPerChunk, rowsLeft);
+                // 65535*65535 cells would result in a total row area of 8GiB.
+                // --> Use uint64_t so that we can safely do our calculations even on x86.
+                const auto allocSize = gsl::narrow<size_t>(::base::strict_cast<uint64_t>(rowStride) * ::base::strict_cast<uint64_t>(rows));
+
+                auto chunk = wil::unique_virtualalloc_ptr<std::byte>{ static_cast<std::byte*>(VirtualAlloc(nullptr, allocSize, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE)) };
+                THROW_IF_NULL_ALLOC(chunk);
+
+                // The bases are tracked separately from ownership, so that
+                // iteration keeps working after take() transferred the chunks.
+                _chunkBases.push_back(chunk.get());
+                _chunks.emplace_back(std::move(chunk));
+                rowsLeft -= rows;
+            }
+
+            _data = _chunkBases.front();
         }
 
         BufferAllocator& operator++() noexcept
         {
-            _data += _rowStride;
+            if (++_rowInChunk >= _rowsPerChunk)
+            {
+                _rowInChunk = 0;
+                // The caller increments us once past the final row, so the
+                // index has to be guarded against running off the last chunk.
+                if (++_chunkIndex < _chunkBases.size())
+                {
+                    _data = til::at(_chunkBases, _chunkIndex);
+                }
+            }
+            else
+            {
+                _data += _rowStride;
+            }
             return *this;
         }
 
         wchar_t* chars() const noexcept
         {
-            return til::bit_cast<wchar_t*>(&*_data);
+            return til::bit_cast<wchar_t*>(_data);
         }
 
         uint16_t* indices() const noexcept
         {
-            return til::bit_cast<uint16_t*>(&*(_data + _indicesOffset));
+            return til::bit_cast<uint16_t*>(_data + _indicesOffset);
         }
 
         uint16_t width() const noexcept
@@ -67,16 +107,32 @@ namespace
             return _height;
         }
 
-        wil::unique_virtualalloc_ptr<std::byte>&& take() noexcept
+        size_t chunkCount() const noexcept
+        {
+            return _chunks.size();
+        }
+
+        size_t chunkSize(size_t index) const noexcept
         {
-            return std::move(_buffer);
+            const auto begin = index * _rowsPerChunk;
+            const auto rows = std::min(_rowsPerChunk, gsl::narrow_cast<size_t>(_height) - begin);
+            return _rowStride * rows;
+        }
+
+        std::vector<wil::unique_virtualalloc_ptr<std::byte>>&& take() noexcept
+        {
+            return std::move(_chunks);
         }
 
     private:
-        wil::unique_virtualalloc_ptr<std::byte> _buffer;
-        std::span<std::byte>::iterator _data;
+        std::vector<wil::unique_virtualalloc_ptr<std::byte>> _chunks;
+        std::vector<std::byte*> _chunkBases;
+        std::byte* _data;
         size_t _rowStride;
         size_t _indicesOffset;
+        size_t _rowsPerChunk;
+        size_t _rowInChunk = 0;
+        size_t _chunkIndex = 0;
         uint16_t _width;
         uint16_t _height;
     };
@@ -117,10 +173,16 @@ TextBuffer::TextBuffer(til::size screenBufferSize,
     _storage.reserve(allocator.height());
     for (til::CoordType i = 0; i < screenBufferSize.height; ++i, ++allocator)
     {
-        _storage.emplace_back(allocator.chars(), allocator.indices(), allocator.width(), _currentAttributes);
+        _storage.emplace_back(allocator.chars(), allocator.indices(), allocator.width(), _currentAttributes, _attributeIdPool, &_charsHeapPool);
     }
 
-    _charBuffer = allocator.take();
+    const auto chunkCount = allocator.chunkCount();
+    auto chunks = allocator.take();
+    _charBuffers.reserve(chunkCount);
+    for (size_t i = 0; i < chunkCount; ++i)
+    {
+        _charBuffers.push_back({ std::move(til::at(chunks, i)), allocator.chunkSize(i) });
+    }
     _UpdateSize();
 }
 
@@ -158,7 +220,12 @@ const ROW& TextBuffer::GetRowByOffset(const til::CoordType index) const noexcept
 {
     // Rows are stored circularly, so the index you ask for is offset by the start position and mod the total of rows.
     const auto offsetIndex = gsl::narrow_cast<size_t>(_firstRow + index) % _storage.size();
-    return til::at(_storage, offsetIndex);
+    const auto& row = til::at(_storage, offsetIndex);
+    if (!_compressedRanges.empty())
+    {
+        _ensureRowIsResident(row);
+    }
+    return row;
 }
 
 // Routine Description:
@@ -172,7 +239,12 @@ ROW& TextBuffer::GetRowByOffset(const til::CoordType index) noexcept
 {
     // Rows are stored circularly, so the index you ask for is offset by the start position and mod the total of rows.
     const auto offsetIndex = gsl::narrow_cast<size_t>(_firstRow + index) % _storage.size();
-    return til::at(_storage, offsetIndex);
+    auto& row = til::at(_storage, offsetIndex);
+    if (!_compressedRanges.empty())
+    {
+        _ensureRowIsResident(row);
+    }
+    return row;
 }
 
 // Routine Description:
@@ -686,9 +758,266 @@ bool TextBuffer::IncrementCircularBuffer(const bool inVtMode)
             _firstRow = 0;
         }
     }
+
+    // Amortize the cold-row compaction over the scroll rate: a deep scrollback
+    // only pays for one pass every ColdCompactionInterval scrolled lines.
+    if (++_incrementsSinceCompaction >= ColdCompactionInterval)
+    {
+        _incrementsSinceCompaction = 0;
+        _compressColdChunks();
+    }
     return true;
 }
 
+// Routine Description:
+// - Packs every chunk of the char buffer whose rows have all scrolled further
+//   than ColdRowThreshold lines above the cursor and decommits its pages.
+//   Such rows are almost never touched again until a search or a scroll-back,
+//   and any access through GetRowByOffset transparently makes them resident.
+void TextBuffer::_compressColdChunks()
+{
+    // With a single chunk the buffer is too small to be worth compacting.
+    if (_charBuffers.size() < 2)
+    {
+        return;
+    }
+
+    const auto coldLimit = GetCursor().GetPosition().y - ColdRowThreshold;
+    if (coldLimit <= 0)
+    {
+        return;
+    }
+
+    // Any chunk backing at least one row at or below the cold limit stays hot.
+    // (Rows with heap-allocated text still round-trip through their slot.)
+    til::small_vector<bool, 64> hot(_charBuffers.size(), false);
+    const auto height = GetSize().Height();
+    for (auto offset = coldLimit; offset < height; ++offset)
+    {
+        const auto slot = til::bit_cast<const std::byte*>(GetRowByOffset(offset).BackingStorage());
+        for (size_t i = 0; i < _charBuffers.size(); ++i)
+        {
+            const auto& chunk = _charBuffers[i];
+            if (slot >= chunk.memory.get() && slot < chunk.memory.get() + chunk.size)
+            {
+                til::at(hot, i) = true;
+                break;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < _charBuffers.size(); ++i)
+    {
+        auto& chunk = _charBuffers[i];
+        if (!til::at(hot, i) && !chunk.isCompressed())
+        {
+            _compressChunk(chunk);
+            _compressedRanges.emplace_back(chunk.memory.get(), i);
+        }
+    }
+
+    std::sort(_compressedRanges.begin(), _compressedRanges.end());
+}
+
+// Routine Description:
+// - Makes the chunk backing the given row resident again if it was compressed.
+//   Called from GetRowByOffset, so this is the hot path: while nothing is
+//   compressed the caller skips us entirely, otherwise we do one binary search
+//   over the compressed address ranges.
+void TextBuffer::_ensureRowIsResident(const ROW& row) const noexcept
+{
+    const auto slot = til::bit_cast<const std::byte*>(row.BackingStorage());
+    const auto it = std::upper_bound(_compressedRanges.begin(), _compressedRanges.end(), slot, [](const auto& p, const auto& range) { return p < range.first; });
+    if (it == _compressedRanges.begin())
+    {
+        return;
+    }
+
+    const auto range = it - 1;
+    auto& chunk = til::at(_charBuffers, range->second);
+    if (slot < chunk.memory.get() + chunk.size)
+    {
+        _decompressChunk(chunk);
+        _compressedRanges.erase(range);
+    }
+}
+
+// Routine Description:
+// - Makes every chunk resident. Required before operations that touch row
+//   memory without going through GetRowByOffset (Reset, resize).
+void TextBuffer::_decompressAllChunks() const noexcept
+{
+    for (const auto& range : _compressedRanges)
+    {
+        _decompressChunk(til::at(_charBuffers, range.second));
+    }
+    _compressedRanges.clear();
+}
+
+// Routine Description:
+// - Packs a chunk's contents and decommits its pages. The transform is a
+//   word-wise delta followed by run-length coding: blank-padded text becomes
+//   runs of zero deltas and the monotone char-offset arrays become runs of
+//   ones, so typical scrollback rows shrink by well over an order of magnitude.
+void TextBuffer::_compressChunk(CharBufferChunk& chunk)
+{
+    const std::span<const uint16_t> words{ til::bit_cast<const uint16_t*>(chunk.memory.get()), chunk.size / sizeof(uint16_t) };
+    std::vector<uint16_t> packed;
+    packed.reserve(words.size() / 16);
+
+    uint16_t prev = 0;
+    for (size_t i = 0; i < words.size();)
+    {
+        const auto delta = gsl::narrow_cast<uint16_t>(words[i] - prev);
+        size_t run = 1;
+        while (i + run < words.size() && run < UINT16_MAX && gsl::narrow_cast<uint16_t>(words[i + run] - words[i + run - 1]) == delta)
+        {
+            ++run;
+        }
+        packed.push_back(gsl::narrow_cast<uint16_t>(run));
+        packed.push_back(delta);
+        prev = words[i + run - 1];
+        i += run;
+    }
+
+    // Spill the packed payload into the mapped temp file where the OS can
+    // demand-page it out entirely; keep it on the heap only if the spill
+    // file is unavailable (e.g. no temp directory, disk full).
+    const auto bytes = gsl::narrow_cast<uint64_t>(packed.size() * sizeof(uint16_t));
+    const auto offset = _spillAlloc(bytes);
+    if (offset != UINT64_MAX)
+    {
+        memcpy(_spillView.get() + offset, packed.data(), gsl::narrow_cast<size_t>(bytes));
+        chunk.spillOffset = offset;
+        chunk.spillSize = bytes;
+    }
+    else
+    {
+        chunk.compressed = std::move(packed);
+        chunk.compressed.shrink_to_fit();
+    }
+
+    VirtualFree(chunk.memory.get(), chunk.size, MEM_DECOMMIT);
+}
+
+// Routine Description:
+// - Recommits a chunk's pages and unpacks its contents from the spill file
+//   (or the heap fallback). FAIL_FAST on commit failure: callers sit on
+//   noexcept paths and the rows' pointers into the chunk are already handed
+//   out all over the place.
+void TextBuffer::_decompressChunk(CharBufferChunk& chunk) const noexcept
+{
+    FAIL_FAST_IF_NULL(VirtualAlloc(chunk.memory.get(), chunk.size, MEM_COMMIT, PAGE_READWRITE));
+
+    std::span<const uint16_t> packed;
+    if (chunk.spillOffset != UINT64_MAX)
+    {
+        packed = { til::bit_cast<const uint16_t*>(_spillView.get() + chunk.spillOffset), gsl::narrow_cast<size_t>(chunk.spillSize / sizeof(uint16_t)) };
+    }
+    else
+    {
+        packed = chunk.compressed;
+    }
+
+    auto out = til::bit_cast<uint16_t*>(chunk.memory.get());
+    uint16_t value = 0;
+    for (size_t i = 0; i + 1 < packed.size(); i += 2)
+    {
+        const auto run = packed[i];
+        const auto delta = packed[i + 1];
+        for (uint16_t j = 0; j < run; ++j)
+        {
+            value += delta;
+            *out++ = value;
+        }
+    }
+
+    if (chunk.spillOffset != UINT64_MAX)
+    {
+        _spillFree(chunk.spillOffset, chunk.spillSize);
+        chunk.spillOffset = UINT64_MAX;
+        chunk.spillSize = 0;
+    }
+    chunk.compressed = {};
+}
+
+// Routine Description:
+// - Carves a region for a packed payload out of the spill file, creating the
+//   file and growing the mapping as needed. Returns UINT64_MAX when spilling
+//   is unavailable; the caller then falls back to heap storage.
+uint64_t TextBuffer::_spillAlloc(uint64_t bytes) const noexcept
+{
+    // Reuse a freed region if one is big enough (first fit).
+    for (auto it = _spillFreeList.begin(); it != _spillFreeList.end(); ++it)
+    {
+        if (it->second >= bytes)
+        {
+            const auto offset = it->first;
+            it->first += bytes;
+            it->second -= bytes;
+            if (it->second == 0)
+            {
+                _spillFreeList.erase(it);
+            }
+            return offset;
+        }
+    }
+
+    if (!_spillFile)
+    {
+        wchar_t tempPath[MAX_PATH];
+        wchar_t tempFileName[MAX_PATH];
+        if (!GetTempPathW(MAX_PATH, tempPath) || !GetTempFileNameW(tempPath, L"wtb", 0, tempFileName))
+        {
+            return UINT64_MAX;
+        }
+        // FILE_ATTRIBUTE_TEMPORARY keeps the contents in the file cache as
+        // long as memory allows; FILE_FLAG_DELETE_ON_CLOSE cleans up for us.
+        _spillFile.reset(CreateFileW(tempFileName, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr));
+        if (!_spillFile)
+        {
+            return UINT64_MAX;
+        }
+    }
+
+    const auto offset = _spillUsed;
+    const auto end = offset + bytes;
+    if (end > _spillViewSize)
+    {
+        const auto newSize = (end + SpillGrowthIncrement - 1) / SpillGrowthIncrement * SpillGrowthIncrement;
+        wil::unique_handle mapping{ CreateFileMappingW(_spillFile.get(), nullptr, PAGE_READWRITE, gsl::narrow_cast<DWORD>(newSize >> 32), gsl::narrow_cast<DWORD>(newSize & 0xffffffff), nullptr) };
+        if (!mapping)
+        {
+            return UINT64_MAX;
+        }
+        wil::unique_mapview_ptr<std::byte> view{ static_cast<std::byte*>(MapViewOfFile(mapping.get(), FILE_MAP_ALL_ACCESS, 0, 0, 0)) };
+        if (!view)
+        {
+            return UINT64_MAX;
+        }
+        _spillView = std::move(view);
+        _spillMapping = std::move(mapping);
+        _spillViewSize = newSize;
+    }
+
+    _spillUsed = end;
+    return offset;
+}
+
+// Routine Description:
+// - Returns a payload region to the spill file's free list.
+void TextBuffer::_spillFree(uint64_t offset, uint64_t bytes) const noexcept
+{
+    if (bytes != 0)
+    {
+        try
+        {
+            _spillFreeList.emplace_back(offset, bytes);
+        }
+        CATCH_LOG();
+    }
+}
+
 //Routine Description:
 // - Retrieves the position of the last non-space character in the given
 //   viewport
@@ -795,9 +1124,30 @@ void TextBuffer::ScrollRows(const til::CoordType firstRow, const til::CoordType
 
     // OK. We're about to play games by moving rows around within the deque to
     // scroll a massive region in a faster way than copying things.
-    // To make this easier, first correct the circular buffer to have the first row be 0 again.
+    // When the circular buffer has an offset, only normalize it if the region
+    // we're scrolling actually straddles the wrap-around seam. Full-screen
+    // apps scroll their margin regions on every line they emit, and paying a
+    // whole-storage rotation per line just to shuffle a few dozen rows makes
+    // margin scrolling scale with the scrollback size instead of the region.
     if (_firstRow != 0)
     {
+        // The rotations below touch [firstRow + delta, firstRow + size) when
+        // scrolling up and [firstRow, firstRow + size + delta) when scrolling
+        // down; rows the scroll pushes out rotate into the vacated space, and
+        // the caller erases them there.
+        const auto totalRows = _storage.size();
+        const auto lo = delta < 0 ? firstRow + delta : firstRow;
+        const auto span = gsl::narrow_cast<size_t>(delta < 0 ? size - delta : size + delta);
+        const auto storageLo = gsl::narrow_cast<size_t>(_firstRow + lo) % totalRows;
+
+        if (storageLo + span <= totalRows)
+        {
+            const auto first = _storage.begin() + storageLo;
+            const auto middle = first + (delta < 0 ? -delta : size);
+            std::rotate(first, middle, first + span);
+            return;
+        }
+
         // Rotate the buffer to put the first row at the front.
         std::rotate(_storage.begin(), _storage.begin() + _firstRow, _storage.end());
 
@@ -981,6 +1331,13 @@ void TextBuffer::Reset()
 {
     const auto attr = GetCurrentAttributes();
 
+    // We're about to touch every row's memory directly, bypassing GetRowByOffset.
+    _decompressAllChunks();
+
+    // Every row is re-filled below, so this is the one spot where the
+    // attribute pool can be safely emptied to keep it from growing forever.
+    _attributeIdPool.Reset();
+
     for (auto& row : _storage)
     {
         row.Reset(attr);
@@ -1001,11 +1358,51 @@ void TextBuffer::Reset()
 
     try
     {
-        BufferAllocator allocator{ newSize };
-
         const auto currentSize = GetSize().Dimensions();
         const auto attributes = GetCurrentAttributes();
 
+        // Fast path: growing only in height (the common maximize case) keeps
+        // every existing row's storage exactly where it is - the chunked
+        // backing memory means the new rows simply come from fresh chunks.
+        // Existing rows aren't touched at all, so even compressed cold
+        // chunks stay compressed.
+        if (newSize.width == currentSize.width && newSize.height > currentSize.height)
+        {
+            // Rotate the original rows into place, like the full resize does.
+            // For pure growth the cursor always stays in bounds, so the new
+            // top row is simply the current first row.
+            std::rotate(_storage.begin(), _storage.begin() + GetFirstRowIndex(), _storage.end());
+            _SetFirstRowIndex(0);
+
+            BufferAllocator allocator{ { newSize.width, newSize.height - currentSize.height } };
+
+            // Hand the chunks to _charBuffers before constructing rows into
+            // them, so a failure mid-construction can't leave rows pointing
+            // into memory the allocator would otherwise free on unwind.
+            const auto chunkCount = allocator.chunkCount();
+            auto chunks = allocator.take();
+            _charBuffers.reserve(_charBuffers.size() + chunkCount);
+            for (size_t i = 0; i < chunkCount; ++i)
+            {
+                _charBuffers.push_back({ std::move(til::at(chunks, i)), allocator.chunkSize(i) });
+            }
+
+            _storage.reserve(gsl::narrow_cast<size_t>(newSize.height));
+            for (auto i = currentSize.height; i < newSize.height; ++i, ++allocator)
+            {
+                _storage.emplace_back(allocator.chars(), allocator.indices(), allocator.width(), attributes, _attributeIdPool, &_charsHeapPool);
+            }
+
+            _UpdateSize();
+            return S_OK;
+        }
+
+        BufferAllocator allocator{ newSize };
+
+        // The per-row Resize below reads the old row memory directly,
+        // bypassing GetRowByOffset.
+        _decompressAllChunks();
+
         til::CoordType TopRow = 0; // new top row of the screen buffer
         if (newSize.height <= GetCursor().GetPosition().y)
         {
@@ -1024,14 +1421,21 @@ void TextBuffer::Reset()
         // realloc in the X direction
         for (auto& it : _storage)
         {
-            it.Resize(allocator.chars(), allocator.indices(), allocator.width(), attributes);
+            it.Resize(allocator.chars(), allocator.indices(), allocator.width(), attributes, _attributeIdPool, &_charsHeapPool);
             ++allocator;
         }
 
         // Update the cached size value
         _UpdateSize();
 
-        _charBuffer = allocator.take();
+        const auto chunkCount = allocator.chunkCount();
+        auto chunks = allocator.take();
+        _charBuffers.clear();
+        _charBuffers.reserve(chunkCount);
+        for (size_t i = 0; i < chunkCount; ++i)
+        {
+            _charBuffers.push_back({ std::move(til::at(chunks, i)), allocator.chunkSize(i) });
+        }
     }
     CATCH_RETURN();
 
@@ -1061,6 +1465,14 @@ void TextBuffer::TriggerRedraw(const Viewport& viewport)
     }
 }
 
+void TextBuffer::TriggerScrollRegion(const Viewport& viewport, const til::CoordType delta)
+{
+    if (_isActiveBuffer)
+    {
+        _renderer.TriggerScrollRegion(viewport, delta);
+    }
+}
+
 void TextBuffer::TriggerRedrawCursor(const til::point position)
 {
     if (_isActiveBuffer)
@@ -1382,48 +1794,48 @@ til::point TextBuffer::_GetWordEndForSelection(const til::point target, const st
 
 void TextBuffer::_PruneHyperlinks()
 {
-    // Check the old first row for hyperlink references
-    // If there are any, search the entire buffer for the same reference
-    // If the buffer does not contain the same reference, we can remove that hyperlink from our map
-    // This way, obsolete hyperlink references are cleared from our hyperlink map instead of hanging around
-    // Get all the hyperlink references in the row we're erasing
+    // Collect the recycled row's references. The liveness sweep that decides
+    // whether they can leave the map is batched: OSC 8-heavy output used to
+    // pay one whole-buffer scan for every scrolled-out link row, which made
+    // scrolling O(buffer) exactly when CI logs emit millions of links.
     const auto hyperlinks = GetRowByOffset(0).GetHyperlinks();
-
     if (!hyperlinks.empty())
     {
-        // Move to unordered set so we can use hashed lookup of IDs instead of linear search.
-        // Only make it an unordered set now because set always heap allocates but vector
-        // doesn't when the set is empty (saving an allocation in the common case of no links.)
-        std::unordered_set<uint16_t> firstRowRefs{ hyperlinks.cbegin(), hyperlinks.cend() };
+        _pendingHyperlinkPrune.insert(hyperlinks.cbegin(), hyperlinks.cend());
+    }
 
-        const auto total = TotalRowCount();
-        // Loop through all the rows in the buffer except the first row -
-        // we have found all hyperlink references in the first row and put them in refs,
-        // now we need to search the rest of the buffer (i.e. all the rows except the first)
-        // to see if those references are anywhere else
-        for (til::CoordType i = 1; i < total; ++i)
-        {
-            const auto nextRowRefs = GetRowByOffset(i).GetHyperlinks();
-            for (auto id : nextRowRefs)
-            {
-                if (firstRowRefs.find(id) != firstRowRefs.end())
-                {
-                    firstRowRefs.erase(id);
-                }
-            }
-            if (firstRowRefs.empty())
-            {
-                // No more hyperlink references left to search for, terminate early
-                break;
-            }
-        }
+    // One sweep resolves every pending id at once, so the amortized cost is
+    // proportional to the recycled rows, not the buffer size. The backlog
+    // limit bounds how many dead map entries can pile up between sweeps.
+    if (++_scrollsSinceHyperlinkPrune < HyperlinkPruneInterval && _pendingHyperlinkPrune.size() < HyperlinkPruneBacklogLimit)
+    {
+        return;
+    }
+    _scrollsSinceHyperlinkPrune = 0;
 
-        // Now delete obsolete references from our map
-        for (auto hyperlinkReference : firstRowRefs)
+    if (_pendingHyperlinkPrune.empty())
+    {
+        return;
+    }
+
+    auto pending = std::exchange(_pendingHyperlinkPrune, {});
+
+    // Row 0 is always the row being recycled when we're called, so it never
+    // counts as a live reference - exactly like the old per-row scan.
+    const auto total = TotalRowCount();
+    for (til::CoordType i = 1; i < total && !pending.empty(); ++i)
+    {
+        for (const auto id : GetRowByOffset(i).GetHyperlinks())
         {
-            RemoveHyperlinkFromMap(hyperlinkReference);
+            pending.erase(id);
         }
     }
+
+    // Whatever the sweep didn't find anywhere is truly gone.
+    for (const auto id : pending)
+    {
+        RemoveHyperlinkFromMap(id);
+    }
 }
 
 // Method Description:
@@ -2412,11 +2824,44 @@ HRESULT TextBuffer::Reflow(TextBuffer& oldBuffer,
             }
         }
 
+        // Fast path: a row that ends in a hard newline and fits the new row's
+        // width without wrapping keeps its wrap point, so the whole thing can
+        // be copied in one shot instead of cell by cell. Typical scrollback is
+        // mostly short, fully flushed lines, so this skips the per-cell
+        // iteration for nearly every row and only rewraps the rows whose wrap
+        // points can actually change.
+        auto fastPathUsed = false;
+        til::CoordType iOldCol = 0;
+        const auto copyRight = iRight;
+        if (newBufferPos.x == 0 && !row.WasWrapForced() && !row.WasDoubleBytePadded() &&
+            iRight < newBuffer.GetLineWidth(newBufferPos.y))
+        {
+            try
+            {
+                auto& newRow = newBuffer.GetRowByOffset(newBufferPos.y);
+                const auto newWidth = newBuffer.GetLineWidth(newBufferPos.y);
+                til::CoordType copyBegin = 0;
+                newRow.CopyRangeFrom(0, newWidth, row, copyBegin, iRight);
+                newRow.TransferAttributes(row, newWidth);
+
+                if (!fFoundCursorPos && iOldRow == cOldCursorPos.y && cOldCursorPos.x < copyRight)
+                {
+                    cNewCursorPos = { cOldCursorPos.x, newBufferPos.y };
+                    fFoundCursorPos = true;
+                }
+
+                // Leave the cursor where the per-cell path would have: one
+                // past the last written character, with no wrap possible.
+                newCursor.SetXPosition(iRight);
+                iOldCol = copyRight;
+                fastPathUsed = true;
+            }
+            CATCH_RETURN();
+        }
+
         // Loop through every character in the current row (up to
         // the "right" boundary, which is one past the final valid
         // character)
-        til::CoordType iOldCol = 0;
-        const auto copyRight = iRight;
         for (; iOldCol < copyRight; iOldCol++)
         {
             if (iOldCol == cOldCursorPos.x && iOldRow == cOldCursorPos.y)
@@ -2461,26 +2906,30 @@ HRESULT TextBuffer::Reflow(TextBuffer& oldBuffer,
         //     line in the new buffer, then we didn't wrap. That's fine. just
         //     copy attributes from the old row till the end of the new row, and
         //     move on.
-        const auto newRowY = newCursor.GetPosition().y;
-        auto& newRow = newBuffer.GetRowByOffset(newRowY);
-        auto newAttrColumn = newCursor.GetPosition().x;
-        const auto newWidth = newBuffer.GetLineWidth(newRowY);
-        // Stop when we get to the end of the buffer width, or the new position
-        // for inserting an attr would be past the right of the new buffer.
-        for (auto copyAttrCol = iOldCol;
-             copyAttrCol < cOldColsTotal && newAttrColumn < newWidth;
-             copyAttrCol++, newAttrColumn++)
+        // The fast path above already transferred the whole attribute row.
+        if (!fastPathUsed)
         {
-            try
+            const auto newRowY = newCursor.GetPosition().y;
+            auto& newRow = newBuffer.GetRowByOffset(newRowY);
+            auto newAttrColumn = newCursor.GetPosition().x;
+            const auto newWidth = newBuffer.GetLineWidth(newRowY);
+            // Stop when we get to the end of the buffer width, or the new position
+            // for inserting an attr would be past the right of the new buffer.
+            for (auto copyAttrCol = iOldCol;
+                 copyAttrCol < cOldColsTotal && newAttrColumn < newWidth;
+                 copyAttrCol++, newAttrColumn++)
             {
-                // TODO: MSFT: 19446208 - this should just use an iterator and the inserter...
-                const auto textAttr = row.GetAttrByColumn(copyAttrCol);
-                if (!newRow.SetAttrToEnd(newAttrColumn, textAttr))
+                try
                 {
-                    break;
+                    // TODO: MSFT: 19446208 - this should just use an iterator and the inserter...
+                    const auto textAttr = row.GetAttrByColumn(copyAttrCol);
+                    if (!newRow.SetAttrToEnd(newAttrColumn, textAttr))
+                    {
+                        break;
+                    }
                 }
+                CATCH_LOG(); // Not worth dying over.
             }
-            CATCH_LOG(); // Not worth dying over.
         }
 
         // If we found the old row that the caller was interested in, set the
@@ -2589,7 +3038,7 @@ HRESULT TextBuffer::Reflow(TextBuffer& oldBuffer,
         // the last attr when wider.
         auto& newRow = newBuffer.GetRowByOffset(newRowY);
         const auto newWidth = newBuffer.GetLineWidth(newRowY);
-        newRow.TransferAttributes(row.Attributes(), newWidth);
+        newRow.TransferAttributes(row, newWidth);
 
         newRowY++;
     }
@@ -2779,10 +3228,11 @@ void TextBuffer::CopyHyperlinkMaps(const TextBuffer& other)
 // - The regex pattern
 // Return value:
 // - An ID that the caller should associate with the given pattern
-const size_t TextBuffer::AddPatternRecognizer(const std::wstring_view regexString)
+const size_t TextBuffer::AddPatternRecognizer(const std::wstring_view regexString, const wchar_t requiredChar)
 {
     ++_currentPatternId;
-    _idsAndPatterns.emplace(std::make_pair(_currentPatternId, regexString));
+    _idsAndPatterns.emplace(_currentPatternId, PatternRecognizer{ std::wstring{ regexString }, requiredChar });
+    _patternScanFirstRow = -1;
     return _currentPatternId;
 }
 
@@ -2792,6 +3242,7 @@ void TextBuffer::ClearPatternRecognizers() noexcept
 {
     _idsAndPatterns.clear();
     _currentPatternId = 0;
+    _patternScanFirstRow = -1;
 }
 
 // Method Description:
@@ -2802,6 +3253,7 @@ void TextBuffer::CopyPatterns(const TextBuffer& OtherBuffer)
 {
     _idsAndPatterns = OtherBuffer._idsAndPatterns;
     _currentPatternId = OtherBuffer._currentPatternId;
+    _patternScanFirstRow = -1;
 }
 
 // Method Description:
@@ -2813,24 +3265,79 @@ void TextBuffer::CopyPatterns(const TextBuffer& OtherBuffer)
 // - An interval tree containing the patterns found
 PointTree TextBuffer::GetPatterns(const til::CoordType firstRow, const til::CoordType lastRow) const
 {
-    PointTree::interval_vector intervals;
+    // The scan costs a full concatenation of the range plus a regex pass per
+    // pattern, and the throttle re-runs it after every burst of output. Two
+    // shortcuts keep the steady-state cost down:
+    // 1. If the range and every row's change generation (and identity - see
+    //    PatternScanRowKey) match the previous scan, the cached results are
+    //    still exact - no work at all.
+    // 2. A pattern whose required character (the ':' of "://") appears in no
+    //    row of the range can't match anywhere, so its regex pass - and the
+    //    concatenation, if every pattern bails - is skipped. The row's char
+    //    bloom filter answers that without touching the text.
+    const auto rowCount = gsl::narrow_cast<size_t>(std::max<til::CoordType>(0, lastRow - firstRow + 1));
 
-    std::wstring concatAll;
-    const auto rowSize = GetRowByOffset(0).size();
-    concatAll.reserve(gsl::narrow_cast<size_t>(rowSize) * gsl::narrow_cast<size_t>(lastRow - firstRow + 1));
+    auto cacheHit = firstRow == _patternScanFirstRow &&
+                    lastRow == _patternScanLastRow &&
+                    _patternScanKeys.size() == rowCount;
+    for (size_t i = 0; cacheHit && i < rowCount; ++i)
+    {
+        const auto& row = GetRowByOffset(firstRow + gsl::narrow_cast<til::CoordType>(i));
+        const auto& key = _patternScanKeys[i];
+        cacheHit = row.Generation() == key.generation && row.BackingStorage() == key.backing;
+    }
+    if (cacheHit)
+    {
+        auto copy = _patternScanResults;
+        return PointTree(std::move(copy));
+    }
 
-    // to deal with text that spans multiple lines, we will first concatenate
-    // all the text into one string and find the patterns in that string
+    _patternScanKeys.clear();
+    _patternScanKeys.reserve(rowCount);
     for (til::CoordType i = firstRow; i <= lastRow; ++i)
     {
-        auto& row = GetRowByOffset(i);
-        concatAll += row.GetText();
+        const auto& row = GetRowByOffset(i);
+        _patternScanKeys.push_back({ row.Generation(), row.BackingStorage() });
     }
 
+    const auto rangeMayContain = [&](const wchar_t requiredChar) {
+        for (til::CoordType i = firstRow; i <= lastRow; ++i)
+        {
+            if (GetRowByOffset(i).SearchMask() & (1ull << (requiredChar & 63)))
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    PointTree::interval_vector intervals;
+
+    std::wstring concatAll;
+    const auto rowSize = GetRowByOffset(0).size();
+
     // for each pattern we know of, iterate through the string
     for (const auto& idAndPattern : _idsAndPatterns)
     {
-        std::wregex regexObj{ idAndPattern.second };
+        if (idAndPattern.second.requiredChar != UNICODE_NULL && !rangeMayContain(idAndPattern.second.requiredChar))
+        {
+            continue;
+        }
+
+        // to deal with text that spans multiple lines, we will first
+        // concatenate all the text into one string and find the patterns in
+        // that string - but only once some pattern actually needs it.
+        if (concatAll.empty())
+        {
+            concatAll.reserve(gsl::narrow_cast<size_t>(rowSize) * rowCount);
+            for (til::CoordType i = firstRow; i <= lastRow; ++i)
+            {
+                auto& row = GetRowByOffset(i);
+                concatAll += row.GetText();
+            }
+        }
+
+        std::wregex regexObj{ idAndPattern.second.pattern };
 
         // search through the run with our regex object
         auto words_begin = std::wsregex_iterator(concatAll.begin(), concatAll.end(), regexObj);
@@ -2868,6 +3375,287 @@ PointTree TextBuffer::GetPatterns(const til::CoordType firstRow, const til::Coor
             intervals.push_back(PointTree::interval(startCoord, endCoord, idAndPattern.first));
         }
     }
+
+    _patternScanFirstRow = firstRow;
+    _patternScanLastRow = lastRow;
+    _patternScanResults = intervals;
+
     PointTree result(std::move(intervals));
     return result;
 }
+// Method Description:
+// - Estimates this buffer's heap footprint for diagnostics: the cell grid,
+//   each row's attribute runs and overflow text, and the interning tables.
+//   An estimate, not an audit - allocator overhead and arena slack aren't
+//   visible from here - but it's the number that explains why a
+//   scrollback-heavy tab weighs what it weighs.
+size_t TextBuffer::EstimatedMemoryUsage() const noexcept
+{
+    // Computed entirely from metadata. Walking rows through GetRowByOffset
+    // would transparently recommit and unpack every cold chunk - the query
+    // would destroy the compression it's meant to observe, and then report
+    // the fully expanded footprint instead of the actual one.
+    auto total = _storage.size() * sizeof(ROW);
+
+    // Cell storage, per chunk: resident chunks cost their committed pages,
+    // compressed chunks cost their packed bytes, and spilled chunks live in
+    // the demand-paged spill file, costing (approximately) nothing resident.
+    for (const auto& chunk : _charBuffers)
+    {
+        if (chunk.isCompressed())
+        {
+            total += chunk.compressed.size() * sizeof(uint16_t);
+        }
+        else
+        {
+            total += chunk.size;
+        }
+    }
+
+    // Attribute run lists live in the ROW objects themselves, not the
+    // chunked cell storage, so reading them wakes nothing. Overflow text
+    // drawn from the arena pool isn't attributed here; it's small relative
+    // to the grid and bounded by the pool.
+    for (const auto& row : _storage)
+    {
+        total += row.Attributes().runs().size() * sizeof(ROW::AttributeIdRuns::rle_type);
+    }
+
+    return total;
+}
+
+// --- Session buffer persistence -------------------------------------------
+// A compact, versioned binary image of the buffer's content. Attributes are
+// written once as a table (they're already interned per buffer), row text is
+// stored as contiguous UTF-16 runs, and colors as (attribute index, length)
+// runs. This is a cache of a live session, never a source of truth: any
+// structural mismatch - magic, version, width - rejects the image wholesale
+// and the caller starts with an empty buffer instead.
+
+namespace
+{
+    constexpr uint32_t SerializedBufferMagic = 0x42535457; // 'WTSB'
+    constexpr uint32_t SerializedBufferVersion = 1;
+
+    struct SerializedBufferHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        int32_t width;
+        int32_t height;
+        int32_t cursorX;
+        int32_t cursorY;
+        uint32_t attrCount;
+        // Layout fingerprint: the attribute table is raw TextAttribute
+        // bytes, so an image from a build where the struct changed size is
+        // rejected even if nobody remembered to bump the version.
+        uint32_t attrSize;
+    };
+
+    static_assert(std::is_trivially_copyable_v<SerializedBufferHeader>);
+    static_assert(std::is_trivially_copyable_v<TextAttribute>);
+
+    void appendBytes(std::vector<std::byte>& out, const void* data, const size_t size)
+    {
+        const auto p = static_cast<const std::byte*>(data);
+        out.insert(out.end(), p, p + size);
+    }
+
+    template<typename T>
+    void appendValue(std::vector<std::byte>& out, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        appendBytes(out, &value, sizeof(value));
+    }
+
+    // A bounds-checked reader over the serialized image; any overrun makes
+    // every further read fail, and the caller bails with false.
+    struct ByteReader
+    {
+        std::span<const std::byte> data;
+        size_t offset = 0;
+        bool failed = false;
+
+        template<typename T>
+        bool read(T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            if (failed || data.size() - offset < sizeof(T))
+            {
+                failed = true;
+                return false;
+            }
+            memcpy(&value, data.data() + offset, sizeof(T));
+            offset += sizeof(T);
+            return true;
+        }
+
+        bool readInto(void* dest, const size_t size)
+        {
+            if (failed || data.size() - offset < size)
+            {
+                failed = true;
+                return false;
+            }
+            memcpy(dest, data.data() + offset, size);
+            offset += size;
+            return true;
+        }
+    };
+}
+
+// Method Description:
+// - Serializes the buffer's content (text, colors, wrap flags, cursor) into
+//   a flat byte vector for session persistence.
+// Return Value:
+// - the serialized image; feed it to RestoreContentFrom on a buffer of the
+//   same width to bring the content back.
+std::vector<std::byte> TextBuffer::SerializeContent() const
+{
+    const auto size = GetSize().Dimensions();
+
+    std::vector<std::byte> out;
+    // Rough guess: header + text + one run per row. The vector grows past it
+    // for colorful content; this just avoids the early doublings.
+    out.reserve(sizeof(SerializedBufferHeader) + static_cast<size_t>(size.width) * size.height * sizeof(wchar_t) + size.height * 8);
+
+    // The attribute table: ids are buffer-local, so we re-enumerate the ones
+    // actually referenced, densely.
+    std::unordered_map<uint32_t, uint32_t> idToIndex;
+    std::vector<TextAttribute> attrTable;
+    for (til::CoordType y = 0; y < size.height; ++y)
+    {
+        for (const auto& run : GetRowByOffset(y).Attributes().runs())
+        {
+            if (idToIndex.try_emplace(run.value, gsl::narrow_cast<uint32_t>(attrTable.size())).second)
+            {
+                attrTable.push_back(_attributeIdPool.Lookup(run.value));
+            }
+        }
+    }
+
+    const auto cursorPos = GetCursor().GetPosition();
+    SerializedBufferHeader header{
+        SerializedBufferMagic,
+        SerializedBufferVersion,
+        size.width,
+        size.height,
+        cursorPos.x,
+        cursorPos.y,
+        gsl::narrow_cast<uint32_t>(attrTable.size()),
+        sizeof(TextAttribute),
+    };
+    appendValue(out, header);
+    appendBytes(out, attrTable.data(), attrTable.size() * sizeof(TextAttribute));
+
+    for (til::CoordType y = 0; y < size.height; ++y)
+    {
+        const auto& row = GetRowByOffset(y);
+
+        const uint8_t flags = row.WasWrapForced() ? 1 : 0;
+        appendValue(out, flags);
+
+        const auto text = row.GetText();
+        appendValue(out, gsl::narrow_cast<uint16_t>(text.size()));
+        appendBytes(out, text.data(), text.size() * sizeof(wchar_t));
+
+        const auto& runs = row.Attributes().runs();
+        appendValue(out, gsl::narrow_cast<uint16_t>(runs.size()));
+        for (const auto& run : runs)
+        {
+            appendValue(out, idToIndex.at(run.value));
+            appendValue(out, gsl::narrow_cast<uint16_t>(run.length));
+        }
+    }
+
+    return out;
+}
+
+// Method Description:
+// - Restores content previously produced by SerializeContent into this
+//   buffer. The buffer must have the same width as the serialized image
+//   (restore before the first user resize; the usual reflow machinery takes
+//   over afterwards). Rows beyond this buffer's height are dropped from the
+//   top-down image's tail.
+// Arguments:
+// - data: a serialized image
+// Return Value:
+// - true if the content was restored; false if the image was malformed or
+//   structurally incompatible (the buffer may be partially written then -
+//   callers treat that as "no restore" and Reset()).
+bool TextBuffer::RestoreContentFrom(std::span<const std::byte> data)
+{
+    ByteReader reader{ data };
+
+    SerializedBufferHeader header{};
+    if (!reader.read(header) ||
+        header.magic != SerializedBufferMagic ||
+        header.version != SerializedBufferVersion ||
+        header.attrSize != sizeof(TextAttribute))
+    {
+        return false;
+    }
+
+    const auto size = GetSize().Dimensions();
+    if (header.width != size.width || header.height <= 0 || header.attrCount == 0 || header.attrCount > 0xFFFFFF)
+    {
+        return false;
+    }
+
+    std::vector<TextAttribute> attrTable;
+    attrTable.resize(header.attrCount);
+    if (!reader.readInto(attrTable.data(), attrTable.size() * sizeof(TextAttribute)))
+    {
+        return false;
+    }
+
+    const auto rowsToRestore = std::min<til::CoordType>(header.height, size.height);
+    std::wstring text;
+    for (til::CoordType y = 0; y < rowsToRestore; ++y)
+    {
+        uint8_t flags = 0;
+        uint16_t textLength = 0;
+        if (!reader.read(flags) || !reader.read(textLength))
+        {
+            return false;
+        }
+
+        text.resize(textLength);
+        if (!reader.readInto(text.data(), textLength * sizeof(wchar_t)))
+        {
+            return false;
+        }
+
+        auto& row = GetRowByOffset(y);
+        row.Reset(TextAttribute{});
+        RowWriteState state{ .text = text, .columnBegin = 0, .columnLimit = size.width };
+        row.ReplaceText(state);
+        row.SetWrapForced(flags & 1);
+
+        uint16_t runCount = 0;
+        if (!reader.read(runCount))
+        {
+            return false;
+        }
+
+        til::CoordType column = 0;
+        for (uint16_t i = 0; i < runCount; ++i)
+        {
+            uint32_t attrIndex = 0;
+            uint16_t length = 0;
+            if (!reader.read(attrIndex) || !reader.read(length) ||
+                attrIndex >= attrTable.size() ||
+                column + length > size.width)
+            {
+                return false;
+            }
+            row.ReplaceAttributes(column, column + length, til::at(attrTable, attrIndex));
+            column += length;
+        }
+    }
+
+    GetCursor().SetPosition({ std::clamp<til::CoordType>(header.cursorX, 0, size.width - 1),
+                              std::clamp<til::CoordType>(header.cursorY, 0, size.height - 1) });
+
+    return true;
+}
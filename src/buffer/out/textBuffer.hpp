@@ -148,6 +148,7 @@ public:
     Microsoft::Console::Render::Renderer& GetRenderer() noexcept;
 
     void TriggerRedraw(const Microsoft::Console::Types::Viewport& viewport);
+    void TriggerScrollRegion(const Microsoft::Console::Types::Viewport& viewport, const til::CoordType delta);
     void TriggerRedrawCursor(const til::point position);
     void TriggerRedrawAll();
     void TriggerScroll();
@@ -213,7 +214,11 @@ public:
                           const std::optional<Microsoft::Console::Types::Viewport> lastCharacterViewport,
                           std::optional<std::reference_wrapper<PositionInformation>> positionInfo);
 
-    const size_t AddPatternRecognizer(const std::wstring_view regexString);
+    size_t EstimatedMemoryUsage() const noexcept;
+    std::vector<std::byte> SerializeContent() const;
+    bool RestoreContentFrom(std::span<const std::byte> data);
+
+    const size_t AddPatternRecognizer(const std::wstring_view regexString, const wchar_t requiredChar = UNICODE_NULL);
     void ClearPatternRecognizers() noexcept;
     void CopyPatterns(const TextBuffer& OtherBuffer);
     interval_tree::IntervalTree<til::point, size_t> GetPatterns(const til::CoordType firstRow, const til::CoordType lastRow) const;
@@ -238,16 +243,112 @@ private:
 
     static void _AppendRTFText(std::ostringstream& contentBuilder, const std::wstring_view& text);
 
+    // Chunks of rows that scrolled far out of the active area get their contents
+    // packed into a compact heap buffer and their pages decommitted. The address
+    // range stays reserved, so the ROWs' pointers remain valid; any access via
+    // GetRowByOffset transparently commits the pages again and unpacks.
+    struct CharBufferChunk
+    {
+        wil::unique_virtualalloc_ptr<std::byte> memory;
+        size_t size = 0;
+        // Holds the packed contents while the pages are decommitted and the
+        // spill file is unavailable. Empty while the chunk is resident.
+        std::vector<uint16_t> compressed;
+        // Location of the packed contents inside the spill file, if spilled.
+        uint64_t spillOffset = UINT64_MAX;
+        uint64_t spillSize = 0;
+
+        bool isCompressed() const noexcept
+        {
+            return !compressed.empty() || spillOffset != UINT64_MAX;
+        }
+    };
+
+    // How many scrolled lines (or how much backlog) between hyperlink sweeps.
+    static constexpr uint32_t HyperlinkPruneInterval = 256;
+    static constexpr size_t HyperlinkPruneBacklogLimit = 512;
+
+    // Rows further than this many lines above the cursor are compaction candidates.
+    static constexpr til::CoordType ColdRowThreshold = 512;
+    // How many calls to IncrementCircularBuffer amortize one compaction pass.
+    static constexpr uint32_t ColdCompactionInterval = 1024;
+    // The spill file mapping grows in large steps to keep remaps rare.
+    static constexpr uint64_t SpillGrowthIncrement = 16ull * 1024 * 1024;
+
+    void _compressColdChunks();
+    void _ensureRowIsResident(const ROW& row) const noexcept;
+    void _decompressAllChunks() const noexcept;
+    void _compressChunk(CharBufferChunk& chunk);
+    void _decompressChunk(CharBufferChunk& chunk) const noexcept;
+    uint64_t _spillAlloc(uint64_t bytes) const noexcept;
+    void _spillFree(uint64_t offset, uint64_t bytes) const noexcept;
+
     Microsoft::Console::Render::Renderer& _renderer;
 
     std::unordered_map<uint16_t, std::wstring> _hyperlinkMap;
     std::unordered_map<std::wstring, uint16_t> _hyperlinkCustomIdMap;
     uint16_t _currentHyperlinkId = 1;
+    // Hyperlink ids recycled out of the top of the buffer, awaiting the next
+    // batched liveness sweep (see _PruneHyperlinks).
+    std::unordered_set<uint16_t> _pendingHyperlinkPrune;
+    uint32_t _scrollsSinceHyperlinkPrune = 0;
 
-    std::unordered_map<size_t, std::wstring> _idsAndPatterns;
+    struct PatternRecognizer
+    {
+        std::wstring pattern;
+        // A character that must appear somewhere in any match (UNICODE_NULL
+        // if there is none); lets GetPatterns skip the regex pass over a
+        // range that can't possibly contain a match.
+        wchar_t requiredChar = UNICODE_NULL;
+    };
+    std::unordered_map<size_t, PatternRecognizer> _idsAndPatterns;
     size_t _currentPatternId = 0;
 
-    wil::unique_virtualalloc_ptr<std::byte> _charBuffer;
+    // The range, per-row change generations, and results of the last
+    // GetPatterns scan, so an unchanged viewport doesn't pay for another
+    // concatenation and regex pass.
+    // One entry per row of the last pattern scan. The generation catches
+    // edits in place; the backing pointer catches the circular buffer
+    // rotating a different ROW into the same visible offset (it travels with
+    // the ROW's storage, so uniform generations across rows can't alias).
+    struct PatternScanRowKey
+    {
+        uint32_t generation;
+        const wchar_t* backing;
+    };
+    mutable til::CoordType _patternScanFirstRow = -1;
+    mutable til::CoordType _patternScanLastRow = -1;
+    mutable std::vector<PatternScanRowKey> _patternScanKeys;
+    mutable interval_tree::IntervalTree<til::point, size_t>::interval_vector _patternScanResults;
+
+    // Interns the TextAttributes stored (as ids) in the rows' attribute runs.
+    TextAttributeIdPool _attributeIdPool;
+    // Arena the rows draw their overflow char storage from. Unsynchronized is
+    // fine: all row mutation happens under the owning console's lock, and a
+    // per-buffer pool keeps 30 panes reflowing at once off the heap lock.
+    // Declared before _storage so it outlives the rows on destruction.
+    std::pmr::unsynchronized_pool_resource _charsHeapPool{ til::pmr::get_default_resource() };
+    // Chunked backing memory for the ROWs in _storage. Each chunk holds a
+    // fixed number of rows; _storage is the indirection table that maps the
+    // logical row order onto them. mutable, because decompressing a cold chunk
+    // on access is logically const.
+    mutable std::vector<CharBufferChunk> _charBuffers;
+    // The [begin, chunk index) ranges of all currently compressed chunks,
+    // sorted by address for the residency check in GetRowByOffset.
+    mutable std::vector<std::pair<const std::byte*, size_t>> _compressedRanges;
+    // Packed cold chunks spill into a lazily created, delete-on-close temp
+    // file. The file is kept mapped in one view, so the OS demand-pages the
+    // packed contents in and out and deep scrollback stops costing RAM at all.
+    // Only offsets are stored anywhere, because the view moves when it grows.
+    mutable wil::unique_hfile _spillFile;
+    mutable wil::unique_handle _spillMapping;
+    mutable wil::unique_mapview_ptr<std::byte> _spillView;
+    mutable uint64_t _spillViewSize = 0;
+    mutable uint64_t _spillUsed = 0;
+    // Freed payload regions for reuse, as { offset, size }. First-fit, no
+    // coalescing; payloads are similarly sized so fragmentation stays low.
+    mutable std::vector<std::pair<uint64_t, uint64_t>> _spillFreeList;
+    uint32_t _incrementsSinceCompaction = 0;
     std::vector<ROW> _storage;
     TextAttribute _currentAttributes;
     til::CoordType _firstRow = 0; // indexes top row (not necessarily 0)
@@ -0,0 +1,219 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "pch.h"
+#include "DirtyRegionEngine.hpp"
+
+using namespace Microsoft::Console::Render;
+
+// Routine Description:
+// - Registers (or clears, with nullptr) the embedder's per-frame callback.
+//   Invoked from the render thread at the end of every painted frame.
+void DirtyRegionEngine::SetCallback(DirtyRegionCallback callback) noexcept
+{
+    _callback = callback;
+}
+
+[[nodiscard]] HRESULT DirtyRegionEngine::StartPaint() noexcept
+{
+    RETURN_HR_IF(S_FALSE, !_callback);
+
+    // Nothing accumulated means nothing to report for this frame.
+    RETURN_HR_IF(S_FALSE, _dirty.empty() && _scrollDelta == til::point{} && !_invalidAll);
+
+    return S_OK;
+}
+
+// Routine Description:
+// - Reports the frame's accumulated changes to the embedder, then resets for
+//   the next frame. The scroll delta is reported first so the host can shift
+//   its mirrored content, then the dirty rects (in post-scroll coordinates)
+//   tell it which rows to re-read.
+[[nodiscard]] HRESULT DirtyRegionEngine::EndPaint() noexcept
+try
+{
+    if (_callback)
+    {
+        if (_invalidAll)
+        {
+            _dirty.assign(1, _viewport);
+        }
+
+        _callback(_scrollDelta.y, _dirty.data(), gsl::narrow_cast<uint32_t>(_dirty.size()));
+    }
+
+    _dirty.clear();
+    _scrollDelta = {};
+    _invalidAll = false;
+    return S_OK;
+}
+CATCH_RETURN()
+
+[[nodiscard]] HRESULT DirtyRegionEngine::Present() noexcept
+{
+    return S_FALSE;
+}
+
+[[nodiscard]] HRESULT DirtyRegionEngine::PrepareForTeardown(_Out_ bool* const pForcePaint) noexcept
+{
+    *pForcePaint = false;
+    return S_FALSE;
+}
+
+[[nodiscard]] HRESULT DirtyRegionEngine::ScrollFrame() noexcept
+{
+    return S_FALSE;
+}
+
+[[nodiscard]] HRESULT DirtyRegionEngine::Invalidate(const til::rect* const psrRegion) noexcept
+try
+{
+    if (_callback && !_invalidAll && psrRegion)
+    {
+        // If painting is paused (hidden window) the list could grow without
+        // bound; past a sanity limit a full refresh is cheaper to report.
+        if (_dirty.size() >= 256)
+        {
+            return InvalidateAll();
+        }
+        _dirty.push_back(*psrRegion);
+    }
+    return S_OK;
+}
+CATCH_RETURN()
+
+[[nodiscard]] HRESULT DirtyRegionEngine::InvalidateCursor(const til::rect* const psrRegion) noexcept
+{
+    return Invalidate(psrRegion);
+}
+
+[[nodiscard]] HRESULT DirtyRegionEngine::InvalidateSystem(const til::rect* const prcDirtyClient) noexcept
+{
+    // System coordinates are in pixels relative to the window, which the
+    // embedder already observes directly; nothing to report.
+    return S_OK;
+}
+
+[[nodiscard]] HRESULT DirtyRegionEngine::InvalidateSelection(const std::vector<til::rect>& rectangles) noexcept
+try
+{
+    if (_callback && !_invalidAll)
+    {
+        if (_dirty.size() + rectangles.size() >= 256)
+        {
+            return InvalidateAll();
+        }
+        _dirty.insert(_dirty.end(), rectangles.begin(), rectangles.end());
+    }
+    return S_OK;
+}
+CATCH_RETURN()
+
+[[nodiscard]] HRESULT DirtyRegionEngine::InvalidateScroll(const til::point* const pcoordDelta) noexcept
+try
+{
+    if (_callback && pcoordDelta && *pcoordDelta != til::point{})
+    {
+        // Invalidations that arrived before the scroll refer to the
+        // pre-scroll viewport; shift them so everything we report is in
+        // post-scroll coordinates.
+        for (auto& rect : _dirty)
+        {
+            rect.top += pcoordDelta->y;
+            rect.bottom += pcoordDelta->y;
+            rect.left += pcoordDelta->x;
+            rect.right += pcoordDelta->x;
+        }
+        _scrollDelta += *pcoordDelta;
+    }
+    return S_OK;
+}
+CATCH_RETURN()
+
+[[nodiscard]] HRESULT DirtyRegionEngine::InvalidateAll() noexcept
+{
+    if (_callback)
+    {
+        _invalidAll = true;
+        _dirty.clear();
+    }
+    return S_OK;
+}
+
+[[nodiscard]] HRESULT DirtyRegionEngine::PaintBackground() noexcept
+{
+    return S_FALSE;
+}
+
+[[nodiscard]] HRESULT DirtyRegionEngine::PaintBufferLine(const std::span<const Cluster> /*clusters*/, const til::point /*coord*/, const bool /*fTrimLeft*/, const bool /*lineWrapped*/) noexcept
+{
+    return S_FALSE;
+}
+
+[[nodiscard]] HRESULT DirtyRegionEngine::PaintBufferGridLines(const GridLineSet /*lines*/, const COLORREF /*color*/, const size_t /*cchLine*/, const til::point /*coordTarget*/) noexcept
+{
+    return S_FALSE;
+}
+
+[[nodiscard]] HRESULT DirtyRegionEngine::PaintSelection(const til::rect& /*rect*/) noexcept
+{
+    return S_FALSE;
+}
+
+[[nodiscard]] HRESULT DirtyRegionEngine::PaintCursor(const CursorOptions& /*options*/) noexcept
+{
+    return S_FALSE;
+}
+
+[[nodiscard]] HRESULT DirtyRegionEngine::UpdateDrawingBrushes(const TextAttribute& /*textAttributes*/, const RenderSettings& /*renderSettings*/, const gsl::not_null<IRenderData*> /*pData*/, const bool /*usingSoftFont*/, const bool /*isSettingDefaultBrushes*/) noexcept
+{
+    return S_FALSE;
+}
+
+[[nodiscard]] HRESULT DirtyRegionEngine::UpdateFont(const FontInfoDesired& /*pfiFontInfoDesired*/, FontInfo& /*fiFontInfo*/) noexcept
+{
+    return S_FALSE;
+}
+
+[[nodiscard]] HRESULT DirtyRegionEngine::UpdateDpi(const int /*iDpi*/) noexcept
+{
+    return S_FALSE;
+}
+
+[[nodiscard]] HRESULT DirtyRegionEngine::UpdateViewport(const til::inclusive_rect& srNewViewport) noexcept
+{
+    _viewport = til::rect{ til::point{ srNewViewport.left, srNewViewport.top },
+                           til::point{ srNewViewport.right + 1, srNewViewport.bottom + 1 } };
+    return S_OK;
+}
+
+[[nodiscard]] HRESULT DirtyRegionEngine::GetProposedFont(const FontInfoDesired& /*fiFontInfoDesired*/, FontInfo& /*fiFontInfo*/, const int /*iDpi*/) noexcept
+{
+    return S_FALSE;
+}
+
+[[nodiscard]] HRESULT DirtyRegionEngine::GetDirtyArea(std::span<const til::rect>& area) noexcept
+{
+    // We don't need the renderer to walk any buffer content for us; the
+    // accumulated invalidations are all we report.
+    static constexpr til::rect empty;
+    area = { &empty, 1 };
+    return S_OK;
+}
+
+[[nodiscard]] HRESULT DirtyRegionEngine::GetFontSize(_Out_ til::size* const pFontSize) noexcept
+{
+    *pFontSize = { 1, 1 };
+    return S_FALSE;
+}
+
+[[nodiscard]] HRESULT DirtyRegionEngine::IsGlyphWideByFont(const std::wstring_view /*glyph*/, _Out_ bool* const pResult) noexcept
+{
+    *pResult = false;
+    return S_FALSE;
+}
+
+[[nodiscard]] HRESULT DirtyRegionEngine::_DoUpdateTitle(const std::wstring_view /*newTitle*/) noexcept
+{
+    return S_FALSE;
+}
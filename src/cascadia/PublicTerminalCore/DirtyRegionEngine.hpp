@@ -0,0 +1,69 @@
+/*++
+Copyright (c) Microsoft Corporation
+Licensed under the MIT license.
+
+Module Name:
+- DirtyRegionEngine.hpp
+
+Abstract:
+- A render engine that draws nothing and instead reports, once per frame,
+  which regions of the terminal changed - the scroll delta and the dirty
+  rectangles - to a callback registered by a PublicTerminalCore embedder.
+  This lets hosts like the WPF control update only the changed parts of
+  their airspace and accessibility mirrors instead of re-reading the whole
+  screen every frame.
+--*/
+
+#pragma once
+
+#include "../../renderer/inc/RenderEngineBase.hpp"
+
+namespace Microsoft::Console::Render
+{
+    class DirtyRegionEngine final : public RenderEngineBase
+    {
+    public:
+        using DirtyRegionCallback = void(__stdcall*)(til::CoordType scrollDeltaY, const til::rect* dirtyRects, uint32_t dirtyRectCount);
+
+        DirtyRegionEngine() = default;
+
+        void SetCallback(DirtyRegionCallback callback) noexcept;
+
+        // IRenderEngine Members
+        [[nodiscard]] HRESULT StartPaint() noexcept override;
+        [[nodiscard]] HRESULT EndPaint() noexcept override;
+        [[nodiscard]] HRESULT Present() noexcept override;
+        [[nodiscard]] HRESULT PrepareForTeardown(_Out_ bool* const pForcePaint) noexcept override;
+        [[nodiscard]] HRESULT ScrollFrame() noexcept override;
+        [[nodiscard]] HRESULT Invalidate(const til::rect* const psrRegion) noexcept override;
+        [[nodiscard]] HRESULT InvalidateCursor(const til::rect* const psrRegion) noexcept override;
+        [[nodiscard]] HRESULT InvalidateSystem(const til::rect* const prcDirtyClient) noexcept override;
+        [[nodiscard]] HRESULT InvalidateSelection(const std::vector<til::rect>& rectangles) noexcept override;
+        [[nodiscard]] HRESULT InvalidateScroll(const til::point* const pcoordDelta) noexcept override;
+        [[nodiscard]] HRESULT InvalidateAll() noexcept override;
+        [[nodiscard]] HRESULT PaintBackground() noexcept override;
+        [[nodiscard]] HRESULT PaintBufferLine(const std::span<const Cluster> clusters, const til::point coord, const bool fTrimLeft, const bool lineWrapped) noexcept override;
+        [[nodiscard]] HRESULT PaintBufferGridLines(const GridLineSet lines, const COLORREF color, const size_t cchLine, const til::point coordTarget) noexcept override;
+        [[nodiscard]] HRESULT PaintSelection(const til::rect& rect) noexcept override;
+        [[nodiscard]] HRESULT PaintCursor(const CursorOptions& options) noexcept override;
+        [[nodiscard]] HRESULT UpdateDrawingBrushes(const TextAttribute& textAttributes, const RenderSettings& renderSettings, const gsl::not_null<IRenderData*> pData, const bool usingSoftFont, const bool isSettingDefaultBrushes) noexcept override;
+        [[nodiscard]] HRESULT UpdateFont(const FontInfoDesired& FontInfoDesired, _Out_ FontInfo& FontInfo) noexcept override;
+        [[nodiscard]] HRESULT UpdateDpi(const int iDpi) noexcept override;
+        [[nodiscard]] HRESULT UpdateViewport(const til::inclusive_rect& srNewViewport) noexcept override;
+        [[nodiscard]] HRESULT GetProposedFont(const FontInfoDesired& FontInfoDesired, _Out_ FontInfo& FontInfo, const int iDpi) noexcept override;
+        [[nodiscard]] HRESULT GetDirtyArea(std::span<const til::rect>& area) noexcept override;
+        [[nodiscard]] HRESULT GetFontSize(_Out_ til::size* const pFontSize) noexcept override;
+        [[nodiscard]] HRESULT IsGlyphWideByFont(const std::wstring_view glyph, _Out_ bool* const pResult) noexcept override;
+
+    protected:
+        [[nodiscard]] HRESULT _DoUpdateTitle(const std::wstring_view newTitle) noexcept override;
+
+    private:
+        DirtyRegionCallback _callback = nullptr;
+
+        std::vector<til::rect> _dirty;
+        til::point _scrollDelta;
+        til::rect _viewport;
+        bool _invalidAll = false;
+    };
+}
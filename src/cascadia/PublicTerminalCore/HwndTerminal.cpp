@@ -258,6 +258,46 @@ try
 }
 CATCH_LOG();
 
+void HwndTerminal::RegisterDirtyRegionCallback(::Microsoft::Console::Render::DirtyRegionEngine::DirtyRegionCallback callback)
+{
+    if (!_renderer)
+    {
+        return;
+    }
+    // Created lazily, so embedders that never ask for dirty regions don't
+    // pay for an extra engine in the render loop. (Mirrors how the UIA
+    // engine joins the renderer only once accessibility is requested.)
+    if (!_dirtyRegionEngine)
+    {
+        _dirtyRegionEngine = std::make_unique<::Microsoft::Console::Render::DirtyRegionEngine>();
+        _renderer->AddRenderEngine(_dirtyRegionEngine.get());
+    }
+    _dirtyRegionEngine->SetCallback(callback);
+}
+
+// Switches presentation from the hosted hwnd's swap chain to a shared DXGI
+// texture the embedder composes itself (WPF opens the handle via D3D9Ex and
+// hands it to a D3DImage). The callback receives the shared handle, again on
+// every resize (the texture is replaced, not resized). Pair with
+// TerminalRegisterDirtyRegionCallback to drive D3DImage::AddDirtyRect.
+HRESULT HwndTerminal::EnableSharedTexturePresentation(void __stdcall callback(HANDLE)) noexcept
+{
+    RETURN_HR_IF_NULL(E_NOT_VALID_STATE, _renderEngine.get());
+    RETURN_HR_IF_NULL(E_INVALIDARG, callback);
+
+    _renderEngine->SetCallback([callback](const HANDLE handle) noexcept {
+        callback(handle);
+    });
+    RETURN_IF_FAILED(_renderEngine->SetSharedTexturePresentation());
+
+    // Force the device resources (and thus the texture) into existence.
+    if (_renderer)
+    {
+        _renderer->TriggerRedrawAll();
+    }
+    return S_OK;
+}
+
 void HwndTerminal::RegisterScrollCallback(std::function<void(int, int, int)> callback)
 {
     if (!_terminal)
@@ -401,6 +441,18 @@ void _stdcall TerminalRegisterScrollCallback(void* terminal, void __stdcall call
     publicTerminal->RegisterScrollCallback(callback);
 }
 
+void _stdcall TerminalRegisterDirtyRegionCallback(void* terminal, void __stdcall callback(til::CoordType scrollDeltaY, const til::rect* dirtyRects, uint32_t dirtyRectCount))
+{
+    auto publicTerminal = static_cast<HwndTerminal*>(terminal);
+    publicTerminal->RegisterDirtyRegionCallback(callback);
+}
+
+HRESULT _stdcall TerminalEnableSharedTexturePresentation(void* terminal, void __stdcall callback(HANDLE sharedTextureHandle))
+{
+    const auto publicTerminal = static_cast<HwndTerminal*>(terminal);
+    return publicTerminal->EnableSharedTexturePresentation(callback);
+}
+
 void _stdcall TerminalRegisterWriteCallback(void* terminal, const void __stdcall callback(wchar_t*))
 {
     const auto publicTerminal = static_cast<HwndTerminal*>(terminal);
@@ -6,6 +6,7 @@
 #include "../../renderer/base/Renderer.hpp"
 #include "../../renderer/dx/DxRenderer.hpp"
 #include "../../renderer/uia/UiaRenderer.hpp"
+#include "DirtyRegionEngine.hpp"
 #include "../../cascadia/TerminalCore/Terminal.hpp"
 #include "../../types/IControlAccessibilityInfo.h"
 #include "HwndTerminalAutomationPeer.hpp"
@@ -27,6 +28,12 @@ extern "C" {
 __declspec(dllexport) HRESULT _stdcall CreateTerminal(HWND parentHwnd, _Out_ void** hwnd, _Out_ void** terminal);
 __declspec(dllexport) void _stdcall TerminalSendOutput(void* terminal, LPCWSTR data);
 __declspec(dllexport) void _stdcall TerminalRegisterScrollCallback(void* terminal, void __stdcall callback(int, int, int));
+// Reports, once per rendered frame, the vertical scroll delta and the dirty
+// rectangles (in post-scroll viewport cells), so embedders update only the
+// changed regions instead of re-reading the whole screen. The rect pointer is
+// only valid for the duration of the callback. Invoked on the render thread.
+__declspec(dllexport) void _stdcall TerminalRegisterDirtyRegionCallback(void* terminal, void __stdcall callback(til::CoordType scrollDeltaY, const til::rect* dirtyRects, uint32_t dirtyRectCount));
+__declspec(dllexport) HRESULT _stdcall TerminalEnableSharedTexturePresentation(void* terminal, void __stdcall callback(HANDLE sharedTextureHandle));
 __declspec(dllexport) HRESULT _stdcall TerminalTriggerResize(_In_ void* terminal, _In_ til::CoordType width, _In_ til::CoordType height, _Out_ til::size* dimensions);
 __declspec(dllexport) HRESULT _stdcall TerminalTriggerResizeWithDimension(_In_ void* terminal, _In_ til::size dimensions, _Out_ til::size* dimensionsInPixels);
 __declspec(dllexport) HRESULT _stdcall TerminalCalculateResize(_In_ void* terminal, _In_ til::CoordType width, _In_ til::CoordType height, _Out_ til::size* dimensions);
@@ -62,6 +69,8 @@ public:
     void SendOutput(std::wstring_view data);
     HRESULT Refresh(const til::size windowSize, _Out_ til::size* dimensions);
     void RegisterScrollCallback(std::function<void(int, int, int)> callback);
+    void RegisterDirtyRegionCallback(::Microsoft::Console::Render::DirtyRegionEngine::DirtyRegionCallback callback);
+    [[nodiscard]] HRESULT EnableSharedTexturePresentation(void __stdcall callback(HANDLE)) noexcept;
     void RegisterWriteCallback(const void _stdcall callback(wchar_t*));
     ::Microsoft::Console::Render::IRenderData* GetRenderData() const noexcept;
     HWND GetHwnd() const noexcept;
@@ -81,6 +90,7 @@ private:
     std::unique_ptr<::Microsoft::Console::Render::Renderer> _renderer;
     std::unique_ptr<::Microsoft::Console::Render::DxEngine> _renderEngine;
     std::unique_ptr<::Microsoft::Console::Render::UiaEngine> _uiaEngine;
+    std::unique_ptr<::Microsoft::Console::Render::DirtyRegionEngine> _dirtyRegionEngine;
 
     bool _focused{ false };
 
@@ -99,9 +99,17 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
             peasant.HideNotificationIconRequested([this](auto&&, auto&&) { _HideNotificationIconRequestedHandlers(*this, nullptr); });
             peasant.QuitAllRequested({ this, &Monarch::_handleQuitAll });
 
+            // One WindowName call at registration (the peasant just called
+            // us; it's alive) seeds the name cache for later routing.
+            const std::wstring peasantName{ peasant.WindowName() };
+
             {
                 std::unique_lock lock{ _peasantsMutex };
                 _peasants[newPeasantsId] = peasant;
+                if (!peasantName.empty())
+                {
+                    _peasantNames.insert_or_assign(peasantName, newPeasantsId);
+                }
             }
 
             TraceLoggingWrite(g_hRemotingProvider,
@@ -206,6 +214,7 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
         {
             std::unique_lock lock{ _peasantsMutex };
             _peasants.erase(peasantId);
+            std::erase_if(_peasantNames, [&](const auto& entry) { return entry.second == peasantId; });
         }
         _WindowClosedHandlers(nullptr, nullptr);
     }
@@ -275,6 +284,7 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
             {
                 std::unique_lock lock{ _peasantsMutex };
                 _peasants.erase(peasantID);
+                std::erase_if(_peasantNames, [&](const auto& entry) { return entry.second == peasantID; });
             }
 
             if (clearMruPeasantOnFailure)
@@ -305,6 +315,18 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
 
         uint64_t result = 0;
 
+        // Serve repeated lookups from the name cache; the fallback scan below
+        // costs a cross-process WindowName call per peasant. A cached ID for
+        // a meanwhile-dead peasant resolves to nullptr in _getPeasant, whose
+        // cleanup drops the stale entry, so the next lookup rescans.
+        {
+            std::shared_lock lock{ _peasantsMutex };
+            if (const auto it = _peasantNames.find(std::wstring{ name }); it != _peasantNames.end())
+            {
+                return it->second;
+            }
+        }
+
         const auto callback = [&](const auto& id, const auto& p) {
             auto otherName = p.WindowName();
             if (otherName == name)
@@ -325,6 +347,12 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
 
         _forEachPeasant(callback, onError);
 
+        if (result != 0)
+        {
+            std::unique_lock lock{ _peasantsMutex };
+            _peasantNames.insert_or_assign(std::wstring{ name }, result);
+        }
+
         TraceLoggingWrite(g_hRemotingProvider,
                           "Monarch_lookupPeasantIdForName",
                           TraceLoggingWideString(std::wstring{ name }.c_str(), "name", "the name we're looking for"),
@@ -837,7 +865,7 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
     //   indicating if the request was successful.
     // Return Value:
     // - <none>
-    void Monarch::_renameRequested(const winrt::Windows::Foundation::IInspectable& /*sender*/,
+    void Monarch::_renameRequested(const winrt::Windows::Foundation::IInspectable& sender,
                                    const winrt::Microsoft::Terminal::Remoting::RenameRequestArgs& args)
     {
         auto successfullyRenamed = false;
@@ -854,6 +882,19 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
                 // be renamed.
                 args.Succeeded(true);
                 successfullyRenamed = true;
+
+                // Keep the name cache in step with the approval: the peasant
+                // applies the new name as soon as we say yes.
+                if (const auto requestor{ sender.try_as<winrt::Microsoft::Terminal::Remoting::IPeasant>() })
+                {
+                    const auto requestorId = requestor.GetID();
+                    std::unique_lock lock{ _peasantsMutex };
+                    std::erase_if(_peasantNames, [&](const auto& entry) { return entry.second == requestorId; });
+                    if (!name.empty())
+                    {
+                        _peasantNames.insert_or_assign(std::wstring{ name }, requestorId);
+                    }
+                }
             }
 
             TraceLoggingWrite(g_hRemotingProvider,
@@ -115,6 +115,11 @@ namespace winrt::Microsoft::Terminal::Remoting::implementation
         winrt::com_ptr<IVirtualDesktopManager> _desktopManager{ nullptr };
 
         std::unordered_map<uint64_t, winrt::Microsoft::Terminal::Remoting::IPeasant> _peasants;
+        // Window-name -> peasant ID cache, so name routing doesn't cost a
+        // cross-process WindowName call per peasant per lookup. Maintained at
+        // registration, approved renames, and removal; guarded by
+        // _peasantsMutex alongside _peasants. See _lookupPeasantIdForName.
+        std::unordered_map<std::wstring, uint64_t> _peasantNames;
         std::vector<Remoting::WindowActivatedArgs> _mruPeasants;
         // These should not be locked at the same time to prevent deadlocks
         // unless they are both shared_locks.
@@ -252,6 +252,15 @@ namespace winrt::TerminalApp::implementation
         _ApplyLanguageSettingChange();
         _ApplyStartupTaskStateChange();
 
+        TraceLoggingWrite(
+            g_hTerminalAppProvider,
+            "StartupPhaseReached",
+            TraceLoggingDescription("Event emitted when a startup phase boundary is crossed"),
+            TraceLoggingValue("SettingsLoaded", "Phase"),
+            TraceLoggingInt64(::Microsoft::Console::Utils::MillisecondsSinceProcessLaunch(), "MsSinceLaunch"),
+            TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
+            TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance));
+
         TraceLoggingWrite(
             g_hTerminalAppProvider,
             "AppCreated",
@@ -976,9 +976,16 @@ namespace winrt::TerminalApp::implementation
         target.Clear();
         for (const auto& tab : source)
         {
-            auto tabPaletteItem{ winrt::make<winrt::TerminalApp::implementation::TabPaletteItem>(tab) };
-            auto filteredCommand{ winrt::make<FilteredCommand>(tabPaletteItem) };
-            target.Append(filteredCommand);
+            // Reuse the wrapper made for this tab last time; only genuinely
+            // new tabs pay for palette item construction and subscriptions.
+            const auto key = winrt::get_abi(tab);
+            auto it = _tabCommandCache.find(key);
+            if (it == _tabCommandCache.end())
+            {
+                auto tabPaletteItem{ winrt::make<winrt::TerminalApp::implementation::TabPaletteItem>(tab) };
+                it = _tabCommandCache.emplace(key, winrt::make<FilteredCommand>(tabPaletteItem)).first;
+            }
+            target.Append(it->second);
         }
     }
 
@@ -986,6 +993,16 @@ namespace winrt::TerminalApp::implementation
     {
         _bindTabs(tabs, _tabActions);
         _bindTabs(mruTabs, _mruTabActions);
+
+        // Drop wrappers for tabs that no longer exist, so a closed tab (and
+        // everything its wrapper holds alive) isn't retained here.
+        std::unordered_set<void*> alive;
+        alive.reserve(tabs.Size());
+        for (const auto& tab : tabs)
+        {
+            alive.insert(winrt::get_abi(tab));
+        }
+        std::erase_if(_tabCommandCache, [&](const auto& entry) { return alive.find(entry.first) == alive.end(); });
     }
 
     void CommandPalette::EnableCommandPaletteMode(const CommandPaletteLaunchMode launchMode)
@@ -1085,19 +1102,56 @@ namespace winrt::TerminalApp::implementation
         }
         else if (_currentMode == CommandPaletteMode::TabSearchMode || _currentMode == CommandPaletteMode::ActionMode || _currentMode == CommandPaletteMode::CommandlineMode)
         {
-            for (const auto& action : commandsToFilter)
+            // When the new text merely appends to the previous one, only the
+            // previous round's matches can possibly still match - everyone
+            // else already failed on a prefix of this filter. Any other edit
+            // (backspace, mid-string changes, mode switches resetting the
+            // box) falls back to the full scan.
+            const std::wstring_view searchView{ searchText };
+            const std::wstring_view previousView{ _previousFilterText };
+            const auto narrowing = !previousView.empty() &&
+                                   searchView.size() > previousView.size() &&
+                                   searchView.substr(0, previousView.size()) == previousView;
+
+            if (narrowing)
             {
-                // Update filter for all commands
-                // This will modify the highlighting but will also lead to re-computation of weight (and consequently sorting).
-                // Pay attention that it already updates the highlighting in the UI
-                action.UpdateFilter(searchText);
-
-                // if there is active search we skip commands with 0 weight
-                if (searchText.empty() || action.Weight() > 0)
+                for (const auto& action : _previousFilterResults)
+                {
+                    action.UpdateFilter(searchText);
+                    if (action.Weight() > 0)
+                    {
+                        actions.push_back(action);
+                    }
+                }
+            }
+            else
+            {
+                for (const auto& action : commandsToFilter)
                 {
-                    actions.push_back(action);
+                    // Update filter for all commands
+                    // This will modify the highlighting but will also lead to re-computation of weight (and consequently sorting).
+                    // Pay attention that it already updates the highlighting in the UI
+                    action.UpdateFilter(searchText);
+
+                    // if there is active search we skip commands with 0 weight
+                    if (searchText.empty() || action.Weight() > 0)
+                    {
+                        actions.push_back(action);
+                    }
                 }
             }
+
+            _previousFilterText = searchText;
+            if (searchText.empty())
+            {
+                // An empty filter matches everything; there's nothing useful
+                // to narrow from.
+                _previousFilterResults.clear();
+            }
+            else
+            {
+                _previousFilterResults = actions;
+            }
         }
 
         // We want to present the commands sorted
@@ -71,6 +71,20 @@ namespace winrt::TerminalApp::implementation
 
         bool _lastFilterTextWasEmpty{ true };
 
+        // The previous search text and the commands that matched it: a name
+        // that didn't contain the old filter as a subsequence can't contain
+        // an extension of it, so a keystroke that merely appends characters
+        // only rescores the previous round's survivors.
+        winrt::hstring _previousFilterText;
+        std::vector<winrt::TerminalApp::FilteredCommand> _previousFilterResults;
+
+        // Reuses each tab's FilteredCommand wrapper across switcher
+        // invocations: the switcher repopulates on every ctrl-tab press, and
+        // constructing a palette item + filter state + change subscriptions
+        // per tab each time is what made 80-tab switching sluggish. Keyed by
+        // the tab's identity; pruned when SetTabs sees a tab disappear.
+        std::unordered_map<void*, winrt::TerminalApp::FilteredCommand> _tabCommandCache;
+
         void _filterTextChanged(const Windows::Foundation::IInspectable& sender,
                                 const Windows::UI::Xaml::RoutedEventArgs& args);
         void _previewKeyDownHandler(const Windows::Foundation::IInspectable& sender,
@@ -26,6 +26,7 @@ namespace winrt::TerminalApp::implementation
         _Filter(L""),
         _Weight(0)
     {
+        _lowercaseName = _foldCase(_Item.Name());
         _HighlightedName = _computeHighlightedName();
 
         // Recompute the highlighted name if the item name changes
@@ -33,12 +34,27 @@ namespace winrt::TerminalApp::implementation
             auto filteredCommand{ weakThis.get() };
             if (filteredCommand && e.PropertyName() == L"Name")
             {
+                filteredCommand->_lowercaseName = _foldCase(filteredCommand->_Item.Name());
                 filteredCommand->HighlightedName(filteredCommand->_computeHighlightedName());
                 filteredCommand->Weight(filteredCommand->_computeWeight());
             }
         });
     }
 
+    // Function Description:
+    // - Case-folds the given text once, so the matching loop can compare
+    //   plain characters. CharLowerBuff applies the same locale folding
+    //   family as the lstrcmpi comparisons this replaced.
+    std::wstring FilteredCommand::_foldCase(std::wstring_view text)
+    {
+        std::wstring folded{ text };
+        if (!folded.empty())
+        {
+            ::CharLowerBuffW(folded.data(), gsl::narrow_cast<DWORD>(folded.size()));
+        }
+        return folded;
+    }
+
     void FilteredCommand::UpdateFilter(const winrt::hstring& filter)
     {
         // If the filter was not changed we want to prevent the re-computation of matching
@@ -74,13 +90,18 @@ namespace winrt::TerminalApp::implementation
     {
         const auto segments = winrt::single_threaded_observable_vector<winrt::TerminalApp::HighlightedTextSegment>();
         auto commandName = _Item.Name();
+
+        // The filter may be assigned directly rather than via UpdateFilter
+        // (the unit tests do), so fold it here - it's a handful of
+        // characters. The name's fold is cached: it's maintained by the
+        // constructor and the name-change handler.
+        _lowercaseFilter = _foldCase(_Filter);
         auto isProcessingMatchedSegment = false;
         uint32_t nextOffsetToReport = 0;
         uint32_t currentOffset = 0;
 
-        for (const auto searchChar : _Filter)
+        for (const auto searchChar : _lowercaseFilter)
         {
-            const WCHAR searchCharAsString[] = { searchChar, L'\0' };
             while (true)
             {
                 if (currentOffset == commandName.size())
@@ -93,10 +114,11 @@ namespace winrt::TerminalApp::implementation
                     return winrt::make<HighlightedText>(segments);
                 }
 
-                // GH#9941: search should be locale-aware as well
-                // We use the same comparison method as upon sorting to guarantee consistent behavior
-                const WCHAR currentCharAsString[] = { commandName[currentOffset], L'\0' };
-                auto isCurrentCharMatched = lstrcmpi(searchCharAsString, currentCharAsString) == 0;
+                // GH#9941: search should be locale-aware as well. Both sides
+                // were case-folded up front (see _foldCase), so this is a
+                // plain comparison instead of a per-character lstrcmpi.
+                const auto isCurrentCharMatched = currentOffset < _lowercaseName.size() &&
+                                                  searchChar == _lowercaseName[currentOffset];
                 if (isProcessingMatchedSegment != isCurrentCharMatched)
                 {
                     // We reached the end of the region (matched character came after a series of unmatched or vice versa).
@@ -30,8 +30,16 @@ namespace winrt::TerminalApp::implementation
         WINRT_OBSERVABLE_PROPERTY(int, Weight, _PropertyChangedHandlers);
 
     private:
+        static std::wstring _foldCase(std::wstring_view text);
+
         winrt::TerminalApp::HighlightedText _computeHighlightedName();
         int _computeWeight();
+
+        // Case-folded copies of the item name and the filter, so the
+        // per-keystroke matching loop compares plain characters instead of
+        // case-insensitively comparing one-character strings each time.
+        std::wstring _lowercaseName;
+        std::wstring _lowercaseFilter;
         Windows::UI::Xaml::Data::INotifyPropertyChanged::PropertyChanged_revoker _itemChangedRevoker;
 
         friend class TerminalAppLocalTests::FilteredCommandTests;
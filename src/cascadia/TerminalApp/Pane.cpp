@@ -45,6 +45,12 @@ Pane::Pane(const Profile& profile, const TermControl& control, const bool lastFo
     _warningBellToken = _control.WarningBell({ this, &Pane::_ControlWarningBellHandler });
     _closeTerminalRequestedToken = _control.CloseTerminalRequested({ this, &Pane::_CloseTerminalRequestedHandler });
 
+    // Font changes (including ctrl+scroll zoom) change the control's cell
+    // grid, which the cached snap results depend on.
+    _fontSizeChangedRevoker = _control.FontSizeChanged(winrt::auto_revoke, [this](const int /*width*/, const int /*height*/, const bool /*isInitialChange*/) {
+        _InvalidateSnapCache();
+    });
+
     // Register an event with the control to have it inform us when it gains focus.
     _gotFocusRevoker = _control.GotFocus(winrt::auto_revoke, { this, &Pane::_ControlGotFocusHandler });
     _lostFocusRevoker = _control.LostFocus(winrt::auto_revoke, { this, &Pane::_ControlLostFocusHandler });
@@ -343,6 +349,7 @@ bool Pane::_Resize(const ResizeDirection& direction)
     const auto actualDimension = changeWidth ? actualSize.Width : actualSize.Height;
 
     _desiredSplitPosition = _ClampSplitPosition(changeWidth, _desiredSplitPosition - amount, actualDimension);
+    _InvalidateSnapCache();
 
     // Resize our columns to match the new percentages.
     _CreateRowColDefinitions();
@@ -1508,6 +1515,7 @@ void Pane::UpdateSettings(const TerminalSettingsCreateResult& settings, const Pr
     assert(_IsLeaf());
 
     _profile = profile;
+    _InvalidateSnapCache();
 
     _control.UpdateControlSettings(settings.DefaultSettings(), settings.UnfocusedSettings());
 }
@@ -1601,6 +1609,8 @@ void Pane::_CloseChild(const bool closeFirst, const bool isDetaching)
     // modify our tree
     std::unique_lock lock{ _createCloseLock };
 
+    _InvalidateSnapCache();
+
     // If we're a leaf, then chances are both our children closed in close
     // succession. We waited on the lock while the other child was closed, so
     // now we don't have a child to close anymore. Return here. When we moved
@@ -1645,6 +1655,9 @@ void Pane::_CloseChild(const bool closeFirst, const bool isDetaching)
         _connectionStateChangedToken = _control.ConnectionStateChanged({ this, &Pane::_ControlConnectionStateChangedHandler });
         _warningBellToken = _control.WarningBell({ this, &Pane::_ControlWarningBellHandler });
         _closeTerminalRequestedToken = _control.CloseTerminalRequested({ this, &Pane::_CloseTerminalRequestedHandler });
+        _fontSizeChangedRevoker = _control.FontSizeChanged(winrt::auto_revoke, [this](const int /*width*/, const int /*height*/, const bool /*isInitialChange*/) {
+            _InvalidateSnapCache();
+        });
 
         // Revoke the old event handlers. Remove both the handlers for the panes
         // themselves closing, and remove their handlers for their controls
@@ -2034,6 +2047,8 @@ void Pane::_CreateRowColDefinitions()
 // - <none>
 void Pane::_UpdateBorders()
 {
+    _InvalidateSnapCache();
+
     double top = 0, bottom = 0, left = 0, right = 0;
 
     Thickness newBorders{ 0 };
@@ -2439,6 +2454,7 @@ bool Pane::ToggleSplitOrientation()
     {
         // Switch the split orientation
         _splitState = _splitState == SplitState::Horizontal ? SplitState::Vertical : SplitState::Horizontal;
+        _InvalidateSnapCache();
 
         // then update the borders and positioning on ourselves and our children.
         _borders = _GetCommonBorders();
@@ -2550,6 +2566,7 @@ std::pair<std::shared_ptr<Pane>, std::shared_ptr<Pane>> Pane::_Split(SplitDirect
 
     _splitState = actualSplitType;
     _desiredSplitPosition = 1.0f - splitSize;
+    _InvalidateSnapCache();
     _secondChild = newPane;
     // If we want the new pane to be the first child, swap the children
     if (splitType == SplitDirection::Up || splitType == SplitDirection::Left)
@@ -2866,6 +2883,25 @@ float Pane::CalcSnappedDimension(const bool widthOrHeight, const float dimension
 //   requested size) and second is the size snapped upward (not lower than requested size).
 //   If requested size is already snapped, then both returned values equal this value.
 Pane::SnapSizeResult Pane::_CalcSnappedDimension(const bool widthOrHeight, const float dimension) const
+{
+    // Window-edge snapping and split drags query this at input rate, and the
+    // leaf arithmetic costs cross-component calls into each control. If no
+    // pane in this subtree has mutated since the same question was last
+    // asked, the memoized answer holds; the stamp walk is a few integer
+    // reads per pane rather than a re-measurement.
+    const auto stamp = _SnapCacheStamp();
+    auto& cache = _snapCache[widthOrHeight ? 0 : 1];
+    if (cache.stamp == stamp && cache.dimension == dimension)
+    {
+        return cache.result;
+    }
+
+    const auto result = _CalcSnappedDimensionImpl(widthOrHeight, dimension);
+    cache = { stamp, dimension, result };
+    return result;
+}
+
+Pane::SnapSizeResult Pane::_CalcSnappedDimensionImpl(const bool widthOrHeight, const float dimension) const
 {
     if (_IsLeaf())
     {
@@ -2932,6 +2968,30 @@ Pane::SnapSizeResult Pane::_CalcSnappedDimension(const bool widthOrHeight, const
     }
 }
 
+// Method Description:
+// - Marks this pane as mutated for snap-caching purposes. Stamps come from a
+//   process-wide monotonic counter, so no subtree reshuffle can ever
+//   reproduce an older stamp and revive a stale cache entry.
+void Pane::_InvalidateSnapCache() noexcept
+{
+    static std::atomic<uint64_t> counter{ 1 };
+    _snapMutationStamp = counter.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+// Method Description:
+// - The newest mutation stamp in this subtree; a cached snap result is only
+//   valid if this hasn't moved since it was computed.
+uint64_t Pane::_SnapCacheStamp() const noexcept
+{
+    auto stamp = _snapMutationStamp;
+    if (!_IsLeaf())
+    {
+        stamp = std::max(stamp, _firstChild->_SnapCacheStamp());
+        stamp = std::max(stamp, _secondChild->_SnapCacheStamp());
+    }
+    return stamp;
+}
+
 // Method Description:
 // - Increases size of given LayoutSizeNode to match next possible 'snap'. In case of leaf
 //   pane this means the next cell of the terminal. Otherwise it means that one of its children
@@ -249,6 +249,7 @@ private:
 
     winrt::Windows::UI::Xaml::UIElement::GotFocus_revoker _gotFocusRevoker;
     winrt::Windows::UI::Xaml::UIElement::LostFocus_revoker _lostFocusRevoker;
+    winrt::Microsoft::Terminal::Control::TermControl::FontSizeChanged_revoker _fontSizeChangedRevoker;
 
     std::shared_mutex _createCloseLock{};
 
@@ -304,6 +305,9 @@ private:
     std::pair<float, float> _CalcChildrenSizes(const float fullSize) const;
     SnapChildrenSizeResult _CalcSnappedChildrenSizes(const bool widthOrHeight, const float fullSize) const;
     SnapSizeResult _CalcSnappedDimension(const bool widthOrHeight, const float dimension) const;
+    SnapSizeResult _CalcSnappedDimensionImpl(const bool widthOrHeight, const float dimension) const;
+    void _InvalidateSnapCache() noexcept;
+    uint64_t _SnapCacheStamp() const noexcept;
     void _AdvanceSnappedDimension(const bool widthOrHeight, LayoutSizeNode& sizeNode) const;
     winrt::Windows::Foundation::Size _GetMinSize() const;
     LayoutSizeNode _CreateMinSizeTree(const bool widthOrHeight) const;
@@ -374,6 +378,21 @@ private:
         std::pair<float, float> higher;
     };
 
+    // Memoizes the last _CalcSnappedDimension answer for this subtree. The
+    // entry validates against a stamp of the subtree's mutation counters, so
+    // dragging one split (which restamps only that parent) leaves every
+    // unrelated subtree's cached answer usable. See _SnapCacheStamp.
+    struct SnapCacheEntry
+    {
+        uint64_t stamp = 0; // subtree stamp at computation; 0 = empty
+        float dimension = 0;
+        SnapSizeResult result{ 0, 0 };
+    };
+    // One entry per axis, so resizing along one edge doesn't evict the other
+    // axis's still-valid answer.
+    mutable std::array<SnapCacheEntry, 2> _snapCache;
+    uint64_t _snapMutationStamp = 1;
+
     // Helper structure that builds a (roughly) binary tree corresponding
     // to the pane tree. Used for laying out panes with snapped sizes.
     struct LayoutSizeNode
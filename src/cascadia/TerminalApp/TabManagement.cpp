@@ -213,6 +213,7 @@ namespace winrt::TerminalApp::implementation
 
         auto tabViewItem = newTabImpl->TabViewItem();
         _tabView.TabItems().InsertAt(insertPosition, tabViewItem);
+        _tabByViewItem.insert_or_assign(winrt::get_abi(tabViewItem), *newTabImpl);
 
         // Update the state of the close button to match the current theme
         _updateTabCloseButton(tabViewItem);
@@ -519,6 +520,7 @@ namespace winrt::TerminalApp::implementation
 
         _tabs.RemoveAt(tabIndex);
         _tabView.TabItems().RemoveAt(tabIndex);
+        _tabByViewItem.erase(winrt::get_abi(tab.TabViewItem()));
         _UpdateTabIndices();
 
         // To close the window here, we need to close the hosting window.
@@ -707,6 +709,14 @@ namespace winrt::TerminalApp::implementation
     //   so make sure to check the result!
     winrt::TerminalApp::TabBase TerminalPage::_GetTabByTabViewItem(const Microsoft::UI::Xaml::Controls::TabViewItem& tabViewItem) const noexcept
     {
+        // The common case is one hash probe against the identity index.
+        if (const auto it = _tabByViewItem.find(winrt::get_abi(tabViewItem)); it != _tabByViewItem.end())
+        {
+            return it->second;
+        }
+
+        // Defensive fallback, in case an item reached us that was never
+        // registered (shouldn't happen; keeps the old behavior if it does).
         uint32_t tabIndexFromControl{};
         const auto items{ _tabView.TabItems() };
         if (items.IndexOf(tabViewItem, tabIndexFromControl))
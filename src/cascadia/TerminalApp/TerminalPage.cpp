@@ -594,6 +594,19 @@ namespace winrt::TerminalApp::implementation
                 if (auto page{ weakThis.get() })
                 {
                     _actionDispatch->DoAction(action);
+
+                    // Let the UI thread breathe between actions: restoring a
+                    // large session used to run every tab's creation in one
+                    // turn, gating the first frame - and the first prompt -
+                    // on all of them. Yielding at low priority lets the
+                    // first tab present while the rest materialize across
+                    // subsequent ticks, in the same order as before. (We
+                    // only do this when we haven't changed the process CWD,
+                    // so no unrelated handler can observe the override.)
+                    if (cwd.empty())
+                    {
+                        co_await wil::resume_foreground(Dispatcher(), CoreDispatcherPriority::Low);
+                    }
                 }
                 else
                 {
@@ -627,6 +640,32 @@ namespace winrt::TerminalApp::implementation
     {
         _startupState = StartupState::Initialized;
 
+        const auto msSinceLaunch = ::Microsoft::Console::Utils::MillisecondsSinceProcessLaunch();
+        TraceLoggingWrite(
+            g_hTerminalAppProvider,
+            "StartupPhaseReached",
+            TraceLoggingDescription("Event emitted when a startup phase boundary is crossed"),
+            TraceLoggingValue("PageInitialized", "Phase"),
+            TraceLoggingInt64(msSinceLaunch, "MsSinceLaunch"),
+            TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
+            TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance));
+
+        // For local diagnosis without an ETW session: WT_STARTUP_REPORT=1
+        // appends one line per launch to %TEMP%\WindowsTerminal-startup.log.
+        // (The phase-by-phase breakdown lives in the ETW events above and in
+        // main.cpp/AppLogic; this records the bottom line.)
+        wchar_t reportFlag[2]{};
+        if (GetEnvironmentVariableW(L"WT_STARTUP_REPORT", reportFlag, ARRAYSIZE(reportFlag)) > 0)
+        {
+            try
+            {
+                const auto path = std::filesystem::temp_directory_path() / L"WindowsTerminal-startup.log";
+                std::wofstream report{ path, std::ios::app };
+                report << L"startup to initialized page: " << msSinceLaunch << L" ms" << std::endl;
+            }
+            CATCH_LOG();
+        }
+
         // GH#632 - It's possible that the user tried to create the terminal
         // with only one tab, with only an elevated profile. If that happens,
         // we'll create _another_ process to host the elevated version of that
@@ -2392,30 +2431,64 @@ namespace winrt::TerminalApp::implementation
         // copy text to dataPack
         dataPack.SetText(copiedData.Text());
 
+        // Huge selections arrive with delay-render generators instead of
+        // pre-built HTML/RTF: the expensive formats are produced only when a
+        // paste target actually requests them.
+        auto delayRendered = false;
+
         if (WI_IsFlagSet(copyFormats, CopyFormat::HTML))
         {
-            // copy html to dataPack
-            const auto htmlData = copiedData.Html();
-            if (!htmlData.empty())
+            if (const auto htmlGenerator = copiedData.HtmlGenerator())
             {
-                dataPack.SetHtmlFormat(htmlData);
+                dataPack.SetDataProvider(StandardDataFormats::Html(),
+                                         [htmlGenerator](const auto& request) {
+                                             request.SetData(winrt::box_value(htmlGenerator()));
+                                         });
+                delayRendered = true;
+            }
+            else
+            {
+                // copy html to dataPack
+                const auto htmlData = copiedData.Html();
+                if (!htmlData.empty())
+                {
+                    dataPack.SetHtmlFormat(htmlData);
+                }
             }
         }
 
         if (WI_IsFlagSet(copyFormats, CopyFormat::RTF))
         {
-            // copy rtf data to dataPack
-            const auto rtfData = copiedData.Rtf();
-            if (!rtfData.empty())
+            if (const auto rtfGenerator = copiedData.RtfGenerator())
             {
-                dataPack.SetRtf(rtfData);
+                dataPack.SetDataProvider(StandardDataFormats::Rtf(),
+                                         [rtfGenerator](const auto& request) {
+                                             request.SetData(winrt::box_value(rtfGenerator()));
+                                         });
+                delayRendered = true;
+            }
+            else
+            {
+                // copy rtf data to dataPack
+                const auto rtfData = copiedData.Rtf();
+                if (!rtfData.empty())
+                {
+                    dataPack.SetRtf(rtfData);
+                }
             }
         }
 
         try
         {
             Clipboard::SetContent(dataPack);
-            Clipboard::Flush();
+            // Flushing forces delay-rendered formats to be produced right
+            // here, which would defeat the point - those copies trade
+            // "survives app exit" for not building a giant HTML/RTF string
+            // nobody may ever paste.
+            if (!delayRendered)
+            {
+                Clipboard::Flush();
+            }
         }
         CATCH_LOG();
     }
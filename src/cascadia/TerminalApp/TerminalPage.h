@@ -215,6 +215,13 @@ namespace winrt::TerminalApp::implementation
 
         Windows::Foundation::Collections::IObservableVector<TerminalApp::TabBase> _tabs;
         Windows::Foundation::Collections::IObservableVector<TerminalApp::TabBase> _mruTabs;
+
+        // Identity index from a TabViewItem to its tab, so selection changes
+        // and clicks resolve in one hash probe instead of a linear IndexOf
+        // over the tab row (which costs a WinRT comparison per tab).
+        // Maintained by _InitializeTab/_RemoveTab; reorders don't touch it,
+        // since the mapping is by object identity, not position.
+        std::unordered_map<void*, TerminalApp::TabBase> _tabByViewItem;
         static winrt::com_ptr<TerminalTab> _GetTerminalTabImpl(const TerminalApp::TabBase& tab);
 
         void _UpdateTabIndices();
@@ -22,7 +22,7 @@ static til::size GetConsoleScreenSize(HANDLE outputHandle)
 
 static ConnectionState RunConnectionToCompletion(const ITerminalConnection& connection, HANDLE outputHandle, HANDLE inputHandle)
 {
-    connection.TerminalOutput([outputHandle](const winrt::hstring& output) {
+    connection.TerminalOutput([outputHandle](const winrt::array_view<const char16_t>& output) {
         WriteConsoleW(outputHandle, output.data(), output.size(), nullptr, nullptr);
     });
 
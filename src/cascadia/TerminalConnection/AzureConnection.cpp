@@ -88,7 +88,7 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
     // - str: the string to write.
     void AzureConnection::_WriteStringWithNewline(const std::wstring_view str)
     {
-        _TerminalOutputHandlers(str + L"\r\n");
+        _TerminalOutputHandlers(winrt_wstring_to_array_view(str + L"\r\n"));
     }
 
     // Method description:
@@ -104,7 +104,7 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         catch (const std::exception& runtimeException)
         {
             // This also catches the AzureException, which has a .what()
-            _TerminalOutputHandlers(_colorize(91, til::u8u16(std::string{ runtimeException.what() })));
+            _TerminalOutputHandlers(winrt_wstring_to_array_view(_colorize(91, til::u8u16(std::string{ runtimeException.what() }))));
         }
         catch (...)
         {
@@ -154,13 +154,13 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
 
         _currentInputMode = mode;
 
-        _TerminalOutputHandlers(L"> \x1b[92m"); // Make prompted user input green
+        _TerminalOutputHandlers(winrt_wstring_to_array_view(L"> \x1b[92m")); // Make prompted user input green
 
         _inputEvent.wait(inputLock, [this, mode]() {
             return _currentInputMode != mode || _isStateAtOrBeyond(ConnectionState::Closing);
         });
 
-        _TerminalOutputHandlers(L"\x1b[m");
+        _TerminalOutputHandlers(winrt_wstring_to_array_view(L"\x1b[m"));
 
         if (_isStateAtOrBeyond(ConnectionState::Closing))
         {
@@ -198,19 +198,19 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
             if (_userInput.size() > 0)
             {
                 _userInput.pop_back();
-                _TerminalOutputHandlers(L"\x08 \x08"); // overstrike the character with a space
+                _TerminalOutputHandlers(winrt_wstring_to_array_view(L"\x08 \x08")); // overstrike the character with a space
             }
         }
         else
         {
-            _TerminalOutputHandlers(data); // echo back
+            _TerminalOutputHandlers(winrt_wstring_to_array_view(data)); // echo back
 
             switch (_currentInputMode)
             {
             case InputMode::Line:
                 if (data.size() > 0 && gsl::at(data, 0) == UNICODE_CARRIAGERETURN)
                 {
-                    _TerminalOutputHandlers(L"\r\n"); // we probably got a \r, so we need to advance to the next line.
+                    _TerminalOutputHandlers(winrt_wstring_to_array_view(L"\r\n")); // we probably got a \r, so we need to advance to the next line.
                     _currentInputMode = InputMode::None; // toggling the mode indicates completion
                     _inputEvent.notify_one();
                     break;
@@ -390,6 +390,13 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
                 {
                     _transitionToState(ConnectionState::Connected);
 
+                    // Accumulated UTF-16 text that hasn't been handed to the
+                    // terminal yet. Fragments of a large message coalesce
+                    // here and go out as one handoff at the message boundary,
+                    // instead of one lock-acquiring handler invocation per
+                    // fragment - which is what capped log-tailing throughput.
+                    std::wstring pendingText;
+
                     while (true)
                     {
                         WINHTTP_WEB_SOCKET_BUFFER_TYPE bufferType{};
@@ -409,13 +416,24 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
                                 return gsl::narrow<DWORD>(result);
                             }
 
-                            if (_u16Str.empty())
+                            pendingText.append(_u16Str);
+
+                            // Keep draining while the message is fragmented;
+                            // flush at the message boundary (or if a malicious
+                            // stream never ends its message, at a size cap).
+                            if (bufferType == WINHTTP_WEB_SOCKET_UTF8_FRAGMENT_BUFFER_TYPE && pendingText.size() < 1024 * 1024)
+                            {
+                                continue;
+                            }
+
+                            if (pendingText.empty())
                             {
                                 continue;
                             }
 
                             // Pass the output to our registered event handlers
-                            _TerminalOutputHandlers(_u16Str);
+                            _TerminalOutputHandlers(winrt_wstring_to_array_view(pendingText));
+                            pendingText.clear();
                             break;
                         }
                         case WINHTTP_WEB_SOCKET_CLOSE_BUFFER_TYPE:
@@ -749,7 +767,7 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         const auto shellType = _ParsePreferredShellType(settingsResponse);
         _WriteStringWithNewline(RS_(L"AzureRequestingTerminal"));
         const auto socketUri = _GetTerminal(shellType);
-        _TerminalOutputHandlers(L"\r\n");
+        _TerminalOutputHandlers(winrt_wstring_to_array_view(L"\r\n"));
 
         //// Step 8: connecting to said terminal
         {
@@ -99,7 +99,10 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
 
         til::u8state _u8State{};
         std::wstring _u16Str;
-        std::array<char, 4096> _buffer{};
+        // Sized so a bulky log-tailing message usually arrives in one
+        // receive; cloud shell fragments large messages, and per-fragment
+        // processing was the throughput ceiling.
+        std::array<char, 64 * 1024> _buffer{};
 
         static winrt::hstring _ParsePreferredShellType(const winrt::Windows::Data::Json::JsonObject& settingsResponse);
     };
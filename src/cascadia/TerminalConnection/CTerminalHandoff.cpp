@@ -11,9 +11,31 @@ using namespace Microsoft::WRL;
 static NewHandoffFunction _pfnHandoff = nullptr;
 // The registration ID of the class object for clean up later
 static DWORD g_cTerminalHandoffRegistration = 0;
+// The class factory, made once and kept warm across registrations: each
+// REGCLS_SINGLEUSE activation consumes the registration, and re-registering
+// the cached factory is all it takes to be ready for the next handoff.
+static Microsoft::WRL::ComPtr<IUnknown> g_cTerminalHandoffFactory;
 // Mutex so we only do start/stop/establish one at a time.
 static std::shared_mutex _mtx;
 
+// Routine Description:
+// - Registers the (cached) class factory with COM. Must be called under _mtx.
+// Return Value:
+// - S_OK, or relevant COM registration error.
+HRESULT CTerminalHandoff::s_RegisterLocked()
+{
+    if (!g_cTerminalHandoffFactory)
+    {
+        const auto classFactory = Make<SimpleClassFactory<CTerminalHandoff>>();
+
+        RETURN_IF_NULL_ALLOC(classFactory);
+
+        RETURN_IF_FAILED(classFactory.As(&g_cTerminalHandoffFactory));
+    }
+
+    return CoRegisterClassObject(__uuidof(CTerminalHandoff), g_cTerminalHandoffFactory.Get(), CLSCTX_LOCAL_SERVER, REGCLS_SINGLEUSE, &g_cTerminalHandoffRegistration);
+}
+
 // Routine Description:
 // - Starts listening for TerminalHandoff requests by registering
 //   our class and interface with COM.
@@ -28,14 +50,7 @@ try
 
     RETURN_HR_IF(E_NOT_VALID_STATE, _pfnHandoff != nullptr);
 
-    const auto classFactory = Make<SimpleClassFactory<CTerminalHandoff>>();
-
-    RETURN_IF_NULL_ALLOC(classFactory);
-
-    ComPtr<IUnknown> unk;
-    RETURN_IF_FAILED(classFactory.As(&unk));
-
-    RETURN_IF_FAILED(CoRegisterClassObject(__uuidof(CTerminalHandoff), unk.Get(), CLSCTX_LOCAL_SERVER, REGCLS_SINGLEUSE, &g_cTerminalHandoffRegistration));
+    RETURN_IF_FAILED(s_RegisterLocked());
 
     _pfnHandoff = pfnHandoff;
 
@@ -108,18 +123,29 @@ HRESULT CTerminalHandoff::EstablishPtyHandoff(HANDLE in, HANDLE out, HANDLE sign
     {
         std::unique_lock lock{ _mtx };
 
-        // s_StopListeningLocked sets _pfnHandoff to nullptr.
-        // localPfnHandoff is tested for nullness below.
 #pragma warning(suppress : 26429) // Symbol '...' is never tested for nullness, it can be marked as not_null (f.23).
         auto localPfnHandoff = _pfnHandoff;
 
-        // Because we are REGCLS_SINGLEUSE... we need to `CoRevokeClassObject` after we handle this ONE call.
-        // COM does not automatically clean that up for us. We must do it.
-        LOG_IF_FAILED(s_StopListeningLocked());
+        // Because we are REGCLS_SINGLEUSE, this ONE activation consumed the
+        // registration, and we need to `CoRevokeClassObject` it ourselves -
+        // COM does not automatically clean that up for us.
+        if (g_cTerminalHandoffRegistration)
+        {
+            LOG_IF_FAILED(CoRevokeClassObject(g_cTerminalHandoffRegistration));
+            g_cTerminalHandoffRegistration = 0;
+        }
 
         // Report an error if no one registered a handoff function before calling this.
         THROW_HR_IF_NULL(E_NOT_VALID_STATE, localPfnHandoff);
 
+        // Re-register the cached factory right away, before we even process
+        // this handoff: the next conhost's activation then finds a live
+        // registration in a warm process, instead of DCOM cold-starting a
+        // whole new terminal - that launch, not connection construction, is
+        // where defterm handoff latency goes. The page already handles any
+        // number of inbound connections arriving this way.
+        LOG_IF_FAILED(s_RegisterLocked());
+
         // Duplicate the handles from what we received.
         // The contract with COM specifies that any HANDLEs we receive from the caller belong
         // to the caller and will be freed when we leave the scope of this method.
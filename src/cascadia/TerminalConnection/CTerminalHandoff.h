@@ -46,6 +46,7 @@ struct __declspec(uuid(__CLSID_CTerminalHandoff))
     static HRESULT s_StopListening();
 
 private:
+    static HRESULT s_RegisterLocked();
     static HRESULT s_StopListeningLocked();
 };
 
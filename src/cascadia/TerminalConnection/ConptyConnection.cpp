@@ -21,6 +21,107 @@ using namespace std::string_view_literals;
 // Format is: "DecimalResult (HexadecimalForm)"
 static constexpr auto _errorFormat = L"{0} ({0:#010x})"sv;
 
+namespace
+{
+    // Caches the result of til::env::regenerate() - the dozens of registry
+    // reads behind "compat.reloadEnvironmentVariables" - across launches.
+    // Registry change notifications on the three environment keys invalidate
+    // it; the non-registry pieces (computer/user names, profile directories)
+    // are stable for the lifetime of the session. Each launch receives a copy
+    // it can overlay with its per-connection values (WT_SESSION etc.) and
+    // securely zero afterwards without disturbing the cache.
+    struct CachedEnvironment
+    {
+        std::mutex mutex;
+        ::Microsoft::Console::Utils::EnvironmentVariableMapW map;
+        bool valid = false;
+        wil::unique_hkey keys[3];
+        wil::unique_event events[3];
+    };
+
+    CachedEnvironment& cachedEnvironment()
+    {
+        static CachedEnvironment c;
+        return c;
+    }
+
+    // Arms (or re-arms) the registry watches. Returns false if any of them
+    // couldn't be set up, in which case the cache must not be trusted beyond
+    // the current launch.
+    bool _armEnvironmentWatches(CachedEnvironment& cache) noexcept
+    {
+        static constexpr struct
+        {
+            HKEY root;
+            const wchar_t* subkey;
+        } watchedKeys[3]{
+            { HKEY_CURRENT_USER, L"Environment" },
+            { HKEY_CURRENT_USER, L"Volatile Environment" },
+            { HKEY_LOCAL_MACHINE, L"SYSTEM\\CurrentControlSet\\Control\\Session Manager\\Environment" },
+        };
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            if (!cache.keys[i])
+            {
+                if (FAILED_WIN32(RegOpenKeyExW(watchedKeys[i].root, watchedKeys[i].subkey, 0, KEY_NOTIFY, cache.keys[i].addressof())))
+                {
+                    return false;
+                }
+            }
+            if (!cache.events[i])
+            {
+                cache.events[i].create(wil::EventOptions::None);
+            }
+            // THREAD_AGNOSTIC matters: launches happen on short-lived
+            // background threads, and a plain async notification is
+            // abandoned (and its event signaled) when its thread exits.
+            if (FAILED_WIN32(RegNotifyChangeKeyValue(cache.keys[i].get(),
+                                                     TRUE,
+                                                     REG_NOTIFY_CHANGE_NAME | REG_NOTIFY_CHANGE_LAST_SET | REG_NOTIFY_THREAD_AGNOSTIC,
+                                                     cache.events[i].get(),
+                                                     TRUE)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Returns a copy of the regenerated environment map, rebuilding it only
+    // when a watched registry key changed since the last launch.
+    ::Microsoft::Console::Utils::EnvironmentVariableMapW _refreshedEnvironmentMap()
+    {
+        auto& cache = cachedEnvironment();
+        std::lock_guard lock{ cache.mutex };
+
+        if (cache.valid)
+        {
+            for (const auto& event : cache.events)
+            {
+                if (event && event.is_signaled())
+                {
+                    cache.valid = false;
+                    break;
+                }
+            }
+        }
+
+        if (!cache.valid)
+        {
+            til::env refreshedEnvironment;
+            refreshedEnvironment.regenerate();
+            cache.map = std::move(refreshedEnvironment.as_map());
+            // A registry notification fires once per arming, so the watches
+            // are re-armed after every rebuild. Only keep the result if all
+            // of them are actually watching.
+            cache.valid = _armEnvironmentWatches(cache);
+        }
+
+        return cache.map;
+    }
+}
+
 // Notes:
 // There is a number of ways that the Conpty connection can be terminated (voluntarily or not):
 // 1. The connection is Close()d
@@ -49,8 +150,17 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         wil::unique_hfile outPipeOurSide, outPipePseudoConsoleSide;
         wil::unique_hfile inPipeOurSide, inPipePseudoConsoleSide;
 
-        RETURN_IF_WIN32_BOOL_FALSE(CreatePipe(&inPipePseudoConsoleSide, &inPipeOurSide, nullptr, 0));
-        RETURN_IF_WIN32_BOOL_FALSE(CreatePipe(&outPipeOurSide, &outPipePseudoConsoleSide, nullptr, 0));
+        // Ask for a roomy output pipe (the size is only a suggestion to the
+        // kernel): with the default 4KiB, a burst of output fills the pipe
+        // while our reader thread is descheduled and conhost's VT writer
+        // blocks mid-frame. The input pipe carries keystrokes and pastes;
+        // 64KiB comfortably covers a large paste. Anonymous pipes are always
+        // byte mode - there's no message framing to request here, which is
+        // why frame boundaries travel in-band instead.
+        constexpr DWORD inputPipeSize = 64 * 1024;
+        constexpr DWORD outputPipeSize = 1024 * 1024;
+        RETURN_IF_WIN32_BOOL_FALSE(CreatePipe(&inPipePseudoConsoleSide, &inPipeOurSide, nullptr, inputPipeSize));
+        RETURN_IF_WIN32_BOOL_FALSE(CreatePipe(&outPipeOurSide, &outPipePseudoConsoleSide, nullptr, outputPipeSize));
         RETURN_IF_FAILED(ConptyCreatePseudoConsole(size, inPipePseudoConsoleSide.get(), outPipePseudoConsoleSide.get(), dwFlags, phPC));
         *phInput = inPipeOurSide.release();
         *phOutput = outPipeOurSide.release();
@@ -98,10 +208,7 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         // Populate the environment map with the current environment.
         if (_reloadEnvironmentVariables)
         {
-            til::env refreshedEnvironment;
-            refreshedEnvironment.regenerate();
-
-            for (auto& [key, value] : refreshedEnvironment.as_map())
+            for (auto& [key, value] : _refreshedEnvironmentMap())
             {
                 environment.try_emplace(key, std::move(value));
             }
@@ -328,6 +435,45 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
 
         _transitionToState(ConnectionState::Connecting);
 
+        // A fresh connection costs two process launches (conhost, then the
+        // client) - the slowest part of which is usually the shell's own
+        // startup. Spawn it off the caller's thread, so the UI keeps
+        // bringing itself up concurrently; the class already degrades
+        // gracefully while Connecting (input drops, resize and show/hide
+        // stash), and Close() serializes against the spawn via _startMutex.
+        // Inbound defterm handoffs already have their processes; their
+        // remaining work is cheap and some callers rely on it completing
+        // synchronously, so they stay on this thread.
+        if (!_inPipe)
+        {
+            auto strongThis{ get_strong() };
+            std::thread([strongThis, usingExistingBuffer]() noexcept {
+                strongThis->_CompleteStart(usingExistingBuffer);
+            }).detach();
+            return;
+        }
+
+        _CompleteStart(usingExistingBuffer);
+    }
+    catch (...)
+    {
+        LOG_CAUGHT_EXCEPTION();
+        _transitionToState(ConnectionState::Failed);
+    }
+
+    void ConptyConnection::_CompleteStart(const bool usingExistingBuffer) noexcept
+    try
+    {
+        std::lock_guard guard{ _startMutex };
+
+        // The connection may have been closed before this (possibly
+        // background) completion ran; spawning processes for a dead tab
+        // would orphan them.
+        if (_isStateAtOrBeyond(ConnectionState::Closing))
+        {
+            return;
+        }
+
         const til::size dimensions{ gsl::narrow<til::CoordType>(_cols), gsl::narrow<til::CoordType>(_rows) };
 
         // If we do not have pipes already, then this is a fresh connection... not an inbound one that is a received
@@ -429,15 +575,15 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         winrt::hstring failureText{ fmt::format(std::wstring_view{ RS_(L"ProcessFailedToLaunch") },
                                                 fmt::format(_errorFormat, static_cast<unsigned int>(hr)),
                                                 _commandline) };
-        _TerminalOutputHandlers(failureText);
+        _TerminalOutputHandlers(winrt_wstring_to_array_view(failureText));
 
         // If the path was invalid, let's present an informative message to the user
         if (hr == HRESULT_FROM_WIN32(ERROR_DIRECTORY))
         {
             winrt::hstring badPathText{ fmt::format(std::wstring_view{ RS_(L"BadPathText") },
                                                     _startingDirectory) };
-            _TerminalOutputHandlers(L"\r\n");
-            _TerminalOutputHandlers(badPathText);
+            _TerminalOutputHandlers(winrt_wstring_to_array_view(L"\r\n"));
+            _TerminalOutputHandlers(winrt_wstring_to_array_view(badPathText));
         }
 
         _transitionToState(ConnectionState::Failed);
@@ -456,11 +602,11 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         {
             // GH#11556 - make sure to format the error code to this string as an UNSIGNED int
             winrt::hstring exitText{ fmt::format(std::wstring_view{ RS_(L"ProcessExited") }, fmt::format(_errorFormat, status)) };
-            _TerminalOutputHandlers(L"\r\n");
-            _TerminalOutputHandlers(exitText);
-            _TerminalOutputHandlers(L"\r\n");
-            _TerminalOutputHandlers(RS_(L"CtrlDToClose"));
-            _TerminalOutputHandlers(L"\r\n");
+            _TerminalOutputHandlers(winrt_wstring_to_array_view(L"\r\n"));
+            _TerminalOutputHandlers(winrt_wstring_to_array_view(exitText));
+            _TerminalOutputHandlers(winrt_wstring_to_array_view(L"\r\n"));
+            _TerminalOutputHandlers(winrt_wstring_to_array_view(RS_(L"CtrlDToClose")));
+            _TerminalOutputHandlers(winrt_wstring_to_array_view(L"\r\n"));
         }
         CATCH_LOG();
     }
@@ -550,6 +696,11 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
     {
         _transitionToState(ConnectionState::Closing);
 
+        // If a background spawn (see Start) is still in flight, wait for it
+        // here: we must not reset handles it's mid-way through creating. A
+        // finished spawn holds this only momentarily.
+        std::lock_guard startGuard{ _startMutex };
+
         // .reset()ing either of these two will signal ConPTY to send out a CTRL_CLOSE_EVENT to all attached clients.
         // FYI: The other members of this class are concurrently read by the _hOutputThread
         // thread running in the background and so they're not safe to be .reset().
@@ -623,12 +774,20 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         return commandline.to_hstring();
     }
 
+    // The output thread starts with a 64KiB read buffer and doubles it up to
+    // 1MiB whenever a drain fills it completely, so a client that produces
+    // faster than we hand off gets correspondingly larger batches.
+    static constexpr size_t OutputBufferInitialSize = 64 * 1024;
+    static constexpr size_t OutputBufferMaxSize = 1024 * 1024;
+
     DWORD ConptyConnection::_OutputThread()
     {
         // Keep us alive until the output thread terminates; the destructor
         // won't wait for us, and the known exit points _do_.
         auto strongThis{ get_strong() };
 
+        _buffer.resize(OutputBufferInitialSize);
+
         // process the data of the output pipe in a loop
         while (true)
         {
@@ -659,7 +818,35 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
                 }
             }
 
-            const auto result{ til::u8u16(std::string_view{ _buffer.data(), read }, _u16Str, _u8State) };
+            // Before handing the data off, drain whatever else the pipe has
+            // already accumulated. conhost emits a frame as several small
+            // writes, and firing the output event once per write costs a lock
+            // acquisition and a parser spin-up for every few hundred bytes.
+            // Batching everything that's already arrived turns sustained
+            // output into a few large handoffs instead of thousands of tiny
+            // event invocations per second.
+            auto total = size_t{ read };
+            DWORD available{};
+            while (total < _buffer.size() &&
+                   PeekNamedPipe(_outPipe.get(), nullptr, 0, nullptr, &available, nullptr) &&
+                   available > 0)
+            {
+                const auto want = gsl::narrow_cast<DWORD>(std::min<size_t>(available, _buffer.size() - total));
+                if (!ReadFile(_outPipe.get(), _buffer.data() + total, want, &read, nullptr))
+                {
+                    // Hand off what we have; the next blocking read above
+                    // will hit the same error and take the proper exit point.
+                    break;
+                }
+                total += read;
+            }
+
+            if (total == 0)
+            {
+                return 0;
+            }
+
+            const auto result{ til::u8u16(std::string_view{ _buffer.data(), total }, _u16Str, _u8State) };
             if (FAILED(result))
             {
                 // EXIT POINT
@@ -668,9 +855,18 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
                 return gsl::narrow_cast<DWORD>(result);
             }
 
+            // If we filled the buffer to the brim, the client is outpacing
+            // our handoffs - give ourselves more room for the next batch.
+            if (total == _buffer.size() && _buffer.size() < OutputBufferMaxSize)
+            {
+                _buffer.resize(std::min<size_t>(_buffer.size() * 2, OutputBufferMaxSize));
+            }
+
             if (_u16Str.empty())
             {
-                return 0;
+                // Everything we read was the prefix of an incomplete UTF-8
+                // sequence; the remainder will arrive with the next read.
+                continue;
             }
 
             if (!_receivedFirstByte)
@@ -689,8 +885,10 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
                 _receivedFirstByte = true;
             }
 
-            // Pass the output to our registered event handlers
-            _TerminalOutputHandlers(_u16Str);
+            // Pass the output to our registered event handlers. The handlers
+            // borrow our conversion buffer for the duration of the call - no
+            // copy is made, which is why we only reuse _u16Str afterwards.
+            _TerminalOutputHandlers(winrt_wstring_to_array_view(_u16Str));
         }
 
         return 0;
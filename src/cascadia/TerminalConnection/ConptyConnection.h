@@ -62,6 +62,7 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         static winrt::hstring _commandlineFromProcess(HANDLE process);
 
         HRESULT _LaunchAttachedClient() noexcept;
+        void _CompleteStart(const bool usingExistingBuffer) noexcept;
         void _indicateExitWithStatus(unsigned int status) noexcept;
         void _LastConPtyClientDisconnected() noexcept;
 
@@ -85,9 +86,15 @@ namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
         wil::unique_process_information _piClient;
         wil::unique_any<HPCON, decltype(closePseudoConsoleAsync), closePseudoConsoleAsync> _hPC;
 
+        // Serializes the (possibly background) spawn in _CompleteStart
+        // against Close() tearing the handles down mid-creation.
+        std::mutex _startMutex;
+
         til::u8state _u8State{};
         std::wstring _u16Str{};
-        std::array<char, 4096> _buffer{};
+        // The output thread's read buffer. Sized (and grown) by _OutputThread
+        // so that sustained output is handed off in large batches.
+        std::vector<char> _buffer;
         bool _passthroughMode{};
         bool _reloadEnvironmentVariables{};
 
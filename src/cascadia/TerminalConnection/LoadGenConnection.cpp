@@ -0,0 +1,216 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "pch.h"
+#include "LoadGenConnection.h"
+
+#include "LoadGenConnection.g.cpp"
+
+using namespace std::chrono;
+
+namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
+{
+    // How much text each handoff carries. Large enough that the event and
+    // lock overhead amortizes the way a healthy ConPTY batch does; the
+    // pacing loop throttles between chunks.
+    static constexpr size_t ChunkSize = 64 * 1024;
+
+    LoadGenConnection::~LoadGenConnection()
+    {
+        Close();
+    }
+
+    void LoadGenConnection::Initialize(const Windows::Foundation::Collections::ValueSet& settings)
+    {
+        if (!settings)
+        {
+            return;
+        }
+
+        if (const auto value{ settings.TryLookup(L"workload") })
+        {
+            const auto name{ winrt::unbox_value_or<hstring>(value, L"flood") };
+            if (name == L"sgr")
+            {
+                _workload = Workload::SgrStorm;
+            }
+            else if (name == L"scroll")
+            {
+                _workload = Workload::ScrollFlood;
+            }
+            else if (name == L"diff")
+            {
+                _workload = Workload::FrameDiff;
+            }
+            else
+            {
+                _workload = Workload::Flood;
+            }
+        }
+
+        if (const auto value{ settings.TryLookup(L"targetMBps") })
+        {
+            _targetMBps = winrt::unbox_value_or<double>(value, 0.0);
+        }
+
+        if (const auto value{ settings.TryLookup(L"seconds") })
+        {
+            _seconds = winrt::unbox_value_or<double>(value, 10.0);
+        }
+    }
+
+    void LoadGenConnection::Start()
+    {
+        _startTime = steady_clock::now();
+        _thread = std::thread{ [this]() { _generatorThread(); } };
+    }
+
+    void LoadGenConnection::WriteInput(const hstring& /*data*/) noexcept
+    {
+        // A generator has no client to echo; input is deliberately ignored.
+    }
+
+    void LoadGenConnection::Resize(uint32_t rows, uint32_t columns) noexcept
+    {
+        _rows = rows ? rows : _rows;
+        _cols = columns ? columns : _cols;
+    }
+
+    void LoadGenConnection::Close() noexcept
+    {
+        _closing.store(true, std::memory_order_relaxed);
+        if (_thread.joinable())
+        {
+            _thread.join();
+        }
+    }
+
+    double LoadGenConnection::SecondsElapsed() const noexcept
+    {
+        return duration<double>(steady_clock::now() - _startTime).count();
+    }
+
+    // Method Description:
+    // - Builds one chunk of the configured workload. Deterministic per
+    //   iteration, so separate runs compare like-for-like.
+    std::wstring LoadGenConnection::_makeChunk(const size_t iteration) const
+    {
+        std::wstring chunk;
+        chunk.reserve(ChunkSize);
+
+        switch (_workload)
+        {
+        case Workload::SgrStorm:
+        {
+            // Short colored runs: one SGR per couple of glyphs, the worst
+            // case for attribute run-length handling.
+            auto i = iteration;
+            while (chunk.size() < ChunkSize - 32)
+            {
+                chunk.append(L"\x1b[38;5;");
+                chunk.append(std::to_wstring(i % 256));
+                chunk.push_back(L'm');
+                chunk.append(L"wt");
+                if (++i % 64 == 0)
+                {
+                    chunk.append(L"\r\n");
+                }
+            }
+            chunk.append(L"\x1b[m");
+            break;
+        }
+        case Workload::ScrollFlood:
+        {
+            // One short line per unit: dominated by newline handling and
+            // buffer circling, not by glyph volume.
+            auto line = iteration * 1024;
+            while (chunk.size() < ChunkSize - 32)
+            {
+                chunk.append(L"line ");
+                chunk.append(std::to_wstring(line++));
+                chunk.append(L"\r\n");
+            }
+            break;
+        }
+        case Workload::FrameDiff:
+        {
+            // Full-screen-app shape: home the cursor, rewrite a few
+            // scattered rows per "frame".
+            const auto rows = _rows;
+            const auto cols = _cols;
+            auto frame = iteration;
+            while (chunk.size() < ChunkSize - (cols + 64))
+            {
+                chunk.append(L"\x1b[H");
+                for (uint32_t l = 0; l < 4; ++l)
+                {
+                    const auto row = (frame * 7 + l * 13) % rows;
+                    chunk.append(L"\x1b[");
+                    chunk.append(std::to_wstring(row + 1));
+                    chunk.append(L";1H");
+                    chunk.append(cols, static_cast<wchar_t>(L'a' + (frame + l) % 26));
+                }
+                ++frame;
+            }
+            break;
+        }
+        case Workload::Flood:
+        default:
+        {
+            // Plain text lines of varying length - the cat/build-log shape.
+            auto seed = gsl::narrow_cast<unsigned>((iteration * 2654435761u) ^ 0x5eed);
+            while (chunk.size() < ChunkSize - 256)
+            {
+                seed = seed * 1103515245 + 12345;
+                const size_t len = 20 + (seed >> 16) % 160;
+                for (size_t i = 0; i < len; ++i)
+                {
+                    chunk.push_back(gsl::narrow_cast<wchar_t>(L'a' + (seed >> (i % 16)) % 26));
+                }
+                chunk.append(L"\r\n");
+            }
+            break;
+        }
+        }
+
+        return chunk;
+    }
+
+    // Method Description:
+    // - The generator loop: builds chunks, hands them to the output event
+    //   exactly the way a real connection would, and paces itself against
+    //   the configured target rate. Runs until the duration elapses or
+    //   Close() joins us. The delivered counters let the harness around the
+    //   terminal compute MB/s and chunk rates without instrumenting the
+    //   pipeline under test.
+    void LoadGenConnection::_generatorThread()
+    {
+        const auto bytesPerSecond = _targetMBps * 1024.0 * 1024.0;
+        size_t iteration = 0;
+
+        while (!_closing.load(std::memory_order_relaxed))
+        {
+            if (_seconds > 0 && SecondsElapsed() >= _seconds)
+            {
+                break;
+            }
+
+            const auto chunk = _makeChunk(iteration++);
+            _TerminalOutputHandlers(winrt_wstring_to_array_view(chunk));
+            _bytesDelivered.fetch_add(chunk.size() * sizeof(wchar_t), std::memory_order_relaxed);
+            _chunksDelivered.fetch_add(1, std::memory_order_relaxed);
+
+            if (bytesPerSecond > 0)
+            {
+                // Sleep off whatever remains of this chunk's time slice, so
+                // delivery averages out to the target rate.
+                const auto target = _bytesDelivered.load(std::memory_order_relaxed) / bytesPerSecond;
+                const auto elapsed = SecondsElapsed();
+                if (target > elapsed)
+                {
+                    std::this_thread::sleep_for(duration<double>(target - elapsed));
+                }
+            }
+        }
+    }
+}
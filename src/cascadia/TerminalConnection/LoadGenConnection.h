@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include "LoadGenConnection.g.h"
+
+namespace winrt::Microsoft::Terminal::TerminalConnection::implementation
+{
+    struct LoadGenConnection : LoadGenConnectionT<LoadGenConnection>
+    {
+        LoadGenConnection() noexcept = default;
+        ~LoadGenConnection();
+
+        void Initialize(const Windows::Foundation::Collections::ValueSet& settings);
+
+        void Start();
+        void WriteInput(const hstring& data) noexcept;
+        void Resize(uint32_t rows, uint32_t columns) noexcept;
+        void Close() noexcept;
+
+        uint64_t BytesDelivered() const noexcept { return _bytesDelivered.load(std::memory_order_relaxed); }
+        uint64_t ChunksDelivered() const noexcept { return _chunksDelivered.load(std::memory_order_relaxed); }
+        double SecondsElapsed() const noexcept;
+
+        ConnectionState State() const noexcept { return _closing ? ConnectionState::Closed : ConnectionState::Connected; }
+
+        WINRT_CALLBACK(TerminalOutput, TerminalOutputHandler);
+        TYPED_EVENT(StateChanged, ITerminalConnection, IInspectable);
+
+    private:
+        enum class Workload
+        {
+            Flood,
+            SgrStorm,
+            ScrollFlood,
+            FrameDiff,
+        };
+
+        void _generatorThread();
+        std::wstring _makeChunk(size_t iteration) const;
+
+        Workload _workload{ Workload::Flood };
+        double _targetMBps{ 0 };
+        double _seconds{ 10 };
+        uint32_t _rows{ 30 };
+        uint32_t _cols{ 120 };
+
+        std::atomic<uint64_t> _bytesDelivered{ 0 };
+        std::atomic<uint64_t> _chunksDelivered{ 0 };
+        std::atomic<bool> _closing{ false };
+        std::chrono::steady_clock::time_point _startTime{};
+        std::thread _thread;
+    };
+}
+
+namespace winrt::Microsoft::Terminal::TerminalConnection::factory_implementation
+{
+    BASIC_FACTORY(LoadGenConnection);
+}
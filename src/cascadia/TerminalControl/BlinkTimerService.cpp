@@ -0,0 +1,104 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "pch.h"
+#include "BlinkTimerService.h"
+
+using namespace winrt::Windows::UI::Xaml;
+
+namespace winrt::Microsoft::Terminal::Control::implementation
+{
+    BlinkTimerService& BlinkTimerService::ForCurrentThread()
+    {
+        // One service (and thus at most one blink timer) per UI thread. Each
+        // window runs its own XAML island thread, so this is per-window in
+        // practice. The instance lives for the lifetime of the thread; it's
+        // the timer inside that comes and goes with the registrants.
+        static thread_local BlinkTimerService instance;
+        return instance;
+    }
+
+    uint64_t BlinkTimerService::Register(Callback callback)
+    {
+        const auto token = _nextToken++;
+        _entries.push_back({ token, std::move(callback) });
+
+        if (!_timer)
+        {
+            // The interval is sampled when the first registrant arrives.
+            // Registrants are expected to check for a disabled blink rate
+            // (INFINITE) themselves before registering.
+            DispatcherTimer timer;
+            timer.Interval(std::chrono::milliseconds(GetCaretBlinkTime()));
+            timer.Tick([this](auto&&, auto&&) { _tick(); });
+            timer.Start();
+            _timer.emplace(std::move(timer));
+        }
+
+        return token;
+    }
+
+    void BlinkTimerService::Unregister(const uint64_t token) noexcept
+    {
+        // A callback may unregister (itself or a sibling) from inside a tick;
+        // in that case just blank the entry and let _tick sweep it up, so the
+        // vector isn't mutated under the iteration.
+        if (_ticking)
+        {
+            for (auto& entry : _entries)
+            {
+                if (entry.token == token)
+                {
+                    entry.callback = nullptr;
+                    break;
+                }
+            }
+            return;
+        }
+
+        std::erase_if(_entries, [token](const auto& entry) { return entry.token == token; });
+        _stopIfEmpty();
+    }
+
+    void BlinkTimerService::ResetPhase()
+    {
+        if (_timer)
+        {
+            _timer->Stop();
+            _timer->Start();
+        }
+    }
+
+    void BlinkTimerService::_tick()
+    {
+        _ticking = true;
+        // Index-based on purpose: a callback may register new entries (growing
+        // the vector) or unregister existing ones (blanked, not erased, while
+        // we're ticking).
+        for (size_t i = 0; i < _entries.size(); ++i)
+        {
+            // Copy before invoking: a reentrant Register may reallocate the
+            // vector while the stored function object is still on the stack.
+            const auto callback = _entries[i].callback;
+            if (callback && !callback())
+            {
+                _entries[i].callback = nullptr;
+            }
+        }
+        _ticking = false;
+
+        std::erase_if(_entries, [](const auto& entry) { return !entry.callback; });
+        _stopIfEmpty();
+    }
+
+    void BlinkTimerService::_stopIfEmpty()
+    {
+        if (_entries.empty() && _timer)
+        {
+            // Safe even mid-Tick: the framework keeps the timer alive for the
+            // duration of the event dispatch.
+            _timer->Stop();
+            _timer.reset();
+        }
+    }
+}
@@ -0,0 +1,43 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+
+namespace winrt::Microsoft::Terminal::Control::implementation
+{
+    // A per-UI-thread blink metronome. One DispatcherTimer drives every
+    // registered callback, so all cursors and blinking attributes on a thread
+    // tick in phase, and the timer only exists while somebody is registered -
+    // a control that isn't blinking costs nothing.
+    class BlinkTimerService
+    {
+    public:
+        // Return false from a callback to unregister it (the registrant is
+        // gone); the service prunes it on that tick.
+        using Callback = std::function<bool()>;
+
+        static BlinkTimerService& ForCurrentThread();
+
+        uint64_t Register(Callback callback);
+        void Unregister(uint64_t token) noexcept;
+
+        // Restarts the shared interval, so the next toggle happens a full
+        // blink period from now. Used to keep the cursor solid while typing.
+        void ResetPhase();
+
+    private:
+        void _tick();
+        void _stopIfEmpty();
+
+        struct Entry
+        {
+            uint64_t token;
+            Callback callback;
+        };
+
+        std::vector<Entry> _entries;
+        std::optional<Windows::UI::Xaml::DispatcherTimer> _timer;
+        uint64_t _nextToken = 1;
+        bool _ticking = false;
+    };
+}
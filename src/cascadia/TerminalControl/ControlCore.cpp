@@ -29,16 +29,47 @@ using namespace winrt::Windows::Graphics::Display;
 using namespace winrt::Windows::System;
 using namespace winrt::Windows::ApplicationModel::DataTransfer;
 
-// The minimum delay between updates to the scroll bar's values.
-// The updates are throttled to limit power usage.
+// The scroll bar and TSF updates are throttled adaptively: when output is
+// interactive they fire after the minimum interval, and during sustained
+// floods the effective interval doubles per cycle up to the maximum, so a
+// `cat bigfile` coalesces into a few wide updates instead of hammering the
+// UI (and, for TSF, the cross-process hop) at the minimum rate.
 constexpr const auto ScrollBarUpdateInterval = std::chrono::milliseconds(8);
-
-// The minimum delay between updating the TSF input control.
-constexpr const auto TsfRedrawInterval = std::chrono::milliseconds(100);
+constexpr const auto ScrollBarUpdateMaxInterval = std::chrono::milliseconds(100);
+constexpr const auto TsfRedrawInterval = std::chrono::milliseconds(16);
+constexpr const auto TsfRedrawMaxInterval = std::chrono::milliseconds(100);
 
 // The minimum delay between updating the locations of regex patterns
 constexpr const auto UpdatePatternLocationsInterval = std::chrono::milliseconds(500);
 
+// How many buffer positions a background search examines per chunk before
+// releasing the terminal lock, so output can keep flowing mid-scan.
+constexpr size_t SearchChunkBudget = 16 * 1024;
+
+// Pastes larger than this stream to the connection in chunks of this size
+// from a background thread, instead of pushing the whole payload through
+// WriteInput on the UI thread in one blocking call.
+constexpr size_t PasteChunkSize = 128 * 1024;
+
+// While a pane is unfocused its connection output is coalesced: chunks
+// accumulate until this much text is pending (or the trailing flush timer
+// below fires), then parse as one batch. A background flood then costs a
+// few parses per second instead of one per line, while the buffer stays
+// eventually correct.
+constexpr size_t BackgroundParseBatchSize = 256 * 1024;
+
+// Before Initialize has built the terminal there's nowhere to parse INTO;
+// output parks in the coalescing buffer up to this limit, past which the
+// connection's thread blocks - the pipe backs up and the client stalls, the
+// same backpressure a full pipe applies, with no data loss.
+constexpr size_t PreInitBufferLimit = 4 * 1024 * 1024;
+constexpr const auto BackgroundParseFlushInterval = std::chrono::milliseconds(250);
+
+// Selections of more rows than this hand the clipboard delay-rendered
+// HTML/RTF generators instead of pre-built strings, so the (far larger)
+// formatted payloads are only produced if a paste target requests them.
+constexpr size_t DelayRenderCopyThresholdRows = 10000;
+
 namespace winrt::Microsoft::Terminal::Control::implementation
 {
     static winrt::Microsoft::Terminal::Core::OptionalColor OptionalFromColor(const til::color& c)
@@ -186,9 +217,14 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         //   need to hop across the process boundary every time text is output.
         //   We can throttle this to once every 8ms, which will get us out of
         //   the way of the main output & rendering threads.
+        // The TSF and scroll bar throttles are adaptive: their intervals
+        // widen during sustained output floods and snap back when idle, and
+        // input events fast-flush them so echo feedback is never the thing
+        // waiting on a batching delay.
         _tsfTryRedrawCanvas = std::make_shared<ThrottledFuncTrailing<>>(
             _dispatcher,
             TsfRedrawInterval,
+            TsfRedrawMaxInterval,
             [weakThis = get_weak()]() {
                 if (auto core{ weakThis.get() }; !core->_IsClosing())
                 {
@@ -208,15 +244,43 @@ namespace winrt::Microsoft::Terminal::Control::implementation
                 }
             });
 
-        _updateScrollBar = std::make_shared<ThrottledFuncTrailing<Control::ScrollPositionChangedArgs>>(
+        _flushBufferedOutputThrottle = std::make_unique<til::throttled_func_trailing<>>(
+            BackgroundParseFlushInterval,
+            [weakThis = get_weak()]() {
+                if (auto core{ weakThis.get() })
+                {
+                    core->_flushBufferedOutput();
+                }
+            });
+
+        _updateScrollBar = std::make_shared<ThrottledFuncTrailing<int, int, int>>(
             _dispatcher,
             ScrollBarUpdateInterval,
-            [weakThis = get_weak()](const auto& update) {
+            ScrollBarUpdateMaxInterval,
+            [weakThis = get_weak()](const int viewTop, const int viewHeight, const int bufferSize) {
                 if (auto core{ weakThis.get() }; !core->_IsClosing())
                 {
+                    // The WinRT args object is only built here, once per
+                    // delivered update - not once per line of output.
+                    auto update{ winrt::make<ScrollPositionChangedArgs>(viewTop, viewHeight, bufferSize) };
                     core->_ScrollPositionChangedHandlers(*core, update);
                 }
             });
+
+        // Start ConPTY connections now, so conhost and the shell spawn while
+        // XAML is still bringing the control up - the two longest parts of
+        // "wt to first prompt" then overlap instead of queuing. The profile's
+        // initial rows/cols (which the connection was built with) are the
+        // size the control will almost always come up at; Initialize still
+        // resizes if layout disagrees. Output arriving before Initialize is
+        // parked in the coalescing buffer and flushed once the terminal
+        // exists. Other connection types keep starting at Initialize: only
+        // the conpty spawn is heavyweight enough to be worth overlapping.
+        if (_connection && _connection.try_as<TerminalConnection::ConptyConnection>())
+        {
+            _connection.Start();
+            _connectionStartedEarly = true;
+        }
     }
 
     ControlCore::~ControlCore()
@@ -241,6 +305,9 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         _tsfTryRedrawCanvas.reset();
         _updatePatternLocations.reset();
         _updateScrollBar.reset();
+        // The new control will need an initial scrollbar update even if the
+        // values haven't moved since the last one we delivered here.
+        _lastEnqueuedScrollBarUpdate.reset();
     }
 
     void ControlCore::AttachToNewControl(const Microsoft::Terminal::Control::IKeyBindings& keyBindings)
@@ -358,8 +425,25 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         } // scope for TerminalLock
 
         // Start the connection outside of lock, because it could
-        // start writing output immediately.
-        _connection.Start();
+        // start writing output immediately. (ConPTY connections were already
+        // started by the constructor; see there.)
+        if (!_connectionStartedEarly)
+        {
+            _connection.Start();
+        }
+
+        // Anything the early-started connection produced before the terminal
+        // existed is waiting in the coalescing buffer; a connection thread
+        // blocked at the pre-init cap is released too. Taking (and dropping)
+        // the buffer mutex before notifying closes the window where that
+        // thread has evaluated its wait predicate as false but hasn't blocked
+        // yet - a notify slipping into that gap would be lost and leave the
+        // thread asleep at the cap forever.
+        {
+            std::lock_guard guard{ _bufferedOutputMutex };
+        }
+        _bufferedOutputCV.notify_all();
+        _flushBufferedOutput();
 
         return true;
     }
@@ -395,6 +479,27 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         }
         else
         {
+            // Input is the user's echo clock: flush any pending (and
+            // possibly flood-widened) UI updates now, so the feedback for
+            // this very keystroke doesn't wait out a batching delay meant
+            // for bulk output.
+            if (_tsfTryRedrawCanvas)
+            {
+                _tsfTryRedrawCanvas->FastFlush();
+            }
+            if (_updateScrollBar)
+            {
+                _updateScrollBar->FastFlush();
+            }
+
+            // Arm the input-to-output latency measurement, but only if no
+            // earlier keystroke is still unanswered: measuring the oldest
+            // outstanding input is what matches a user's perception of lag.
+            int64_t expected = 0;
+            LARGE_INTEGER qpc;
+            QueryPerformanceCounter(&qpc);
+            _pendingInputTimestamp.compare_exchange_strong(expected, qpc.QuadPart, std::memory_order_relaxed);
+
             _connection.WriteInput(wstr);
         }
     }
@@ -460,6 +565,66 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         _midiAudioSkipTimer.Start();
     }
 
+    // Method Description:
+    // - Requests a full redraw, spreading simultaneous requests across
+    //   consecutive frame intervals. A settings broadcast hits every pane in
+    //   the process nearly at once; presenting 40 full frames in the same
+    //   instant freezes every window for the duration of the storm. The first
+    //   arrival in a burst redraws immediately, and each follower defers by
+    //   one extra frame interval.
+    void ControlCore::_triggerStaggeredRedraw(const bool backgroundChanged, const bool frameChanged)
+    {
+        // Roughly one 60Hz frame per slot, with the total spread bounded so
+        // the last pane of a huge session still updates promptly.
+        static constexpr auto slotInterval = std::chrono::milliseconds{ 8 };
+        static constexpr uint32_t maxSlots = 32;
+        static constexpr int64_t burstWindowMs = 250;
+
+        // Process-wide burst bookkeeping. This is deliberately tolerant of
+        // races: a miscounted slot just means two panes share an interval.
+        static std::atomic<int64_t> s_lastRequestMs{ 0 };
+        static std::atomic<uint32_t> s_nextSlot{ 0 };
+
+        const auto nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        if (nowMs - s_lastRequestMs.exchange(nowMs, std::memory_order_relaxed) > burstWindowMs)
+        {
+            s_nextSlot.store(0, std::memory_order_relaxed);
+        }
+        const auto slot = std::min(s_nextSlot.fetch_add(1, std::memory_order_relaxed), maxSlots - 1);
+
+        if (slot == 0 || !_dispatcher)
+        {
+            _renderer->TriggerRedrawAll(backgroundChanged, frameChanged);
+            return;
+        }
+
+        _staggeredRedrawBackground |= backgroundChanged;
+        _staggeredRedrawFrame |= frameChanged;
+
+        if (!_staggeredRedrawTimer)
+        {
+            _staggeredRedrawTimer = _dispatcher.CreateTimer();
+            _staggeredRedrawTimer.IsRepeating(false);
+            _staggeredRedrawTimer.Tick([weakSelf = get_weak()](auto&&, auto&&) {
+                if (const auto self = weakSelf.get(); self && !self->_IsClosing())
+                {
+                    const auto background = std::exchange(self->_staggeredRedrawBackground, false);
+                    const auto frame = std::exchange(self->_staggeredRedrawFrame, false);
+                    const auto lock = self->_terminal->LockForWriting();
+                    self->_renderer->TriggerRedrawAll(background, frame);
+                }
+            });
+        }
+
+        // If a redraw is already pending, fold this request into it rather
+        // than pushing the deadline out again.
+        if (!_staggeredRedrawTimer.IsRunning())
+        {
+            _staggeredRedrawTimer.Interval(slot * slotInterval);
+            _staggeredRedrawTimer.Start();
+        }
+    }
+
     bool ControlCore::_shouldTryUpdateSelection(const WORD vkey)
     {
         // GH#6423 - don't update selection if the key that was pressed was a
@@ -703,9 +868,29 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         decltype(_terminal->GetHyperlinkIntervalFromViewportPosition({})) newInterval{ std::nullopt };
         if (terminalPosition.has_value())
         {
-            auto lock = _terminal->LockForReading(); // Lock for the duration of our reads.
-            newId = _terminal->GetHyperlinkIdAtViewportPosition(*terminalPosition);
-            newInterval = _terminal->GetHyperlinkIntervalFromViewportPosition(*terminalPosition);
+            // Fast path: if the pattern tree hasn't changed since the last
+            // query and we're still inside the interval it resolved, the
+            // answer can't be different - skip the terminal lock. Sweeping
+            // the pointer along a long hyperlink then costs one locked query
+            // at its first cell, not one per cell crossed.
+            const auto generation = _terminal->GetPatternGeneration();
+            if (generation == _lastHoveredPatternGeneration &&
+                _lastHoveredInterval.has_value() &&
+                _lastHoveredInterval->start <= *terminalPosition &&
+                *terminalPosition <= _lastHoveredInterval->stop)
+            {
+                newId = _lastHoveredId;
+                newInterval = _lastHoveredInterval;
+            }
+            else
+            {
+                auto lock = _terminal->LockForReading(); // Lock for the duration of our reads.
+                newId = _terminal->GetHyperlinkIdAtViewportPosition(*terminalPosition);
+                newInterval = _terminal->GetHyperlinkIntervalFromViewportPosition(*terminalPosition);
+                // Re-read under the lock: the tree can't change while we
+                // hold it, so this pins the generation the results match.
+                _lastHoveredPatternGeneration = _terminal->GetPatternGeneration();
+            }
         }
 
         // If the hyperlink ID changed or the interval changed, trigger a redraw all
@@ -789,7 +974,9 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         _renderEngine->EnableTransparentBackground(_isBackgroundTransparent());
 
         // Trigger a redraw to repaint the window background and tab colors.
-        _renderer->TriggerRedrawAll(true, true);
+        // Settings reloads are broadcast to every pane at once; stagger the
+        // resulting full redraws so they don't all present the same instant.
+        _triggerStaggeredRedraw(true, true);
 
         _updateAntiAliasingMode();
 
@@ -1122,22 +1309,68 @@ namespace winrt::Microsoft::Terminal::Control::implementation
 
         // extract text from buffer
         // RetrieveSelectedTextFromBuffer will lock while it's reading
-        const auto bufferData = _terminal->RetrieveSelectedTextFromBuffer(singleLine);
+        auto bufferData = _terminal->RetrieveSelectedTextFromBuffer(singleLine);
 
         // convert text: vector<string> --> string
+        // One pass with the final size reserved up front; appending row by
+        // row into an unreserved string reallocates repeatedly on big copies.
         std::wstring textData;
-        for (const auto& text : bufferData.text)
         {
-            textData += text;
+            size_t totalSize = 0;
+            for (const auto& text : bufferData.text)
+            {
+                totalSize += text.size();
+            }
+            textData.reserve(totalSize);
+            for (const auto& text : bufferData.text)
+            {
+                textData += text;
+            }
         }
 
         const auto bgColor = _terminal->GetAttributeColors({}).second;
+        const auto wantHtml = formats == nullptr || WI_IsFlagSet(formats.Value(), CopyFormat::HTML);
+        const auto wantRtf = formats == nullptr || WI_IsFlagSet(formats.Value(), CopyFormat::RTF);
+
+        if (bufferData.text.size() > DelayRenderCopyThresholdRows)
+        {
+            // A huge selection: don't render HTML/RTF now. Hand the
+            // clipboard generators over a shared snapshot of the selection
+            // instead; the formats are produced only on a paste target's
+            // request. (The page skips Clipboard::Flush for these, since
+            // flushing would force the deferred formats to render anyway.)
+            const auto snapshot = std::make_shared<TextAndColor>(std::move(bufferData));
+            const auto fontHeight = _actualFont.GetUnscaledSize().height;
+            const auto faceName = std::wstring{ _actualFont.GetFaceName() };
+
+            Control::ClipboardDataGenerator htmlGenerator{ nullptr };
+            Control::ClipboardDataGenerator rtfGenerator{ nullptr };
+            if (wantHtml)
+            {
+                htmlGenerator = [=]() {
+                    return winrt::to_hstring(TextBuffer::GenHTML(*snapshot, fontHeight, faceName, bgColor));
+                };
+            }
+            if (wantRtf)
+            {
+                rtfGenerator = [=]() {
+                    return winrt::to_hstring(TextBuffer::GenRTF(*snapshot, fontHeight, faceName, bgColor));
+                };
+            }
+
+            _CopyToClipboardHandlers(*this,
+                                     winrt::make<CopyToClipboardEventArgs>(winrt::hstring{ textData },
+                                                                           htmlGenerator,
+                                                                           rtfGenerator,
+                                                                           formats));
+            return true;
+        }
 
         // convert text to HTML format
         // GH#5347 - Don't provide a title for the generated HTML, as many
         // web applications will paste the title first, followed by the HTML
         // content, which is unexpected.
-        const auto htmlData = formats == nullptr || WI_IsFlagSet(formats.Value(), CopyFormat::HTML) ?
+        const auto htmlData = wantHtml ?
                                   TextBuffer::GenHTML(bufferData,
                                                       _actualFont.GetUnscaledSize().height,
                                                       _actualFont.GetFaceName(),
@@ -1145,7 +1378,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
                                   "";
 
         // convert to RTF format
-        const auto rtfData = formats == nullptr || WI_IsFlagSet(formats.Value(), CopyFormat::RTF) ?
+        const auto rtfData = wantRtf ?
                                  TextBuffer::GenRTF(bufferData,
                                                     _actualFont.GetUnscaledSize().height,
                                                     _actualFont.GetFaceName(),
@@ -1229,12 +1462,99 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     //   before sending it over the terminal's connection.
     void ControlCore::PasteText(const winrt::hstring& hstr)
     {
-        _terminal->WritePastedText(hstr);
+        // Small pastes keep the old path: one synchronous WriteInput, atomic
+        // with respect to concurrent keystrokes. Large ones would block the
+        // UI thread on a full pipe (and balloon a second copy for the
+        // bracketed-paste wrapping), so they stream from a background thread
+        // instead, paced by the pipe's own backpressure.
+        if (hstr.size() <= PasteChunkSize)
+        {
+            _terminal->WritePastedText(hstr);
+        }
+        else if (_isReadOnly)
+        {
+            _raiseReadOnlyWarning();
+        }
+        else
+        {
+            const auto options = ::Microsoft::Console::Utils::FilterOption::CarriageReturnNewline |
+                                 ::Microsoft::Console::Utils::FilterOption::ControlCodes;
+            auto filtered = ::Microsoft::Console::Utils::FilterStringForPaste(hstr, options);
+            // Starting a new streaming paste supersedes any previous one
+            // still in flight, the same way Close() does.
+            const auto generation = _pasteGeneration.fetch_add(1, std::memory_order_relaxed) + 1;
+            _pasteAsync(std::move(filtered),
+                        _terminal->IsXtermBracketedPasteModeEnabled(),
+                        generation);
+        }
+
         _terminal->ClearSelection();
         _updateSelectionUI();
         _terminal->TrySnapOnInput();
     }
 
+    winrt::fire_and_forget ControlCore::_pasteAsync(std::wstring text, bool bracketed, uint64_t generation)
+    {
+        auto weakThis{ get_weak() };
+        co_await winrt::resume_background();
+
+        const auto strongThis = weakThis.get();
+        if (!strongThis)
+        {
+            co_return;
+        }
+
+        if (bracketed)
+        {
+            _connection.WriteInput(L"\x1b[200~");
+        }
+
+        const std::wstring_view view{ text };
+        for (size_t offset = 0; offset < view.size();)
+        {
+            // Close() bumps the generation, which cancels us between chunks.
+            if (_pasteGeneration.load(std::memory_order_relaxed) != generation)
+            {
+                break;
+            }
+
+            auto length = std::min(PasteChunkSize, view.size() - offset);
+            if (length < view.size() - offset)
+            {
+                // Never split a surrogate pair across chunks: each WriteInput
+                // is converted to UTF-8 independently on the other side.
+                const auto last = view[offset + length - 1];
+                if (last >= 0xD800 && last <= 0xDBFF)
+                {
+                    --length;
+                }
+            }
+
+            // WriteInput blocks when the conpty input pipe is full - that's
+            // the backpressure that paces us, and it only ever stalls this
+            // background thread, never the UI.
+            _connection.WriteInput(winrt::hstring{ view.substr(offset, length) });
+            offset += length;
+        }
+
+        if (bracketed)
+        {
+            // Close the bracket when we're still the current paste (the
+            // normal case) or when Close() cancelled us - leaving the client
+            // in paste mode would corrupt everything typed after. But if a
+            // NEWER paste superseded us, its opening bracket is already on
+            // the wire and its writer is streaming concurrently with no
+            // ordering against ours: our stray 201~ could land mid-stream
+            // and terminate the client's paste mode under it. The newer
+            // paste's own closing bracket covers the client.
+            const auto current = _pasteGeneration.load(std::memory_order_relaxed) == generation;
+            if (current || _outputThreadShutdown.load(std::memory_order_relaxed))
+            {
+                _connection.WriteInput(L"\x1b[201~");
+            }
+        }
+    }
+
     FontInfo ControlCore::GetFont() const
     {
         return _actualFont;
@@ -1395,17 +1715,26 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         // TODO GH#9617: refine locking around pattern tree
         _terminal->ClearPatternTree();
 
-        // Start the throttled update of our scrollbar.
-        auto update{ winrt::make<ScrollPositionChangedArgs>(viewTop,
-                                                            viewHeight,
-                                                            bufferSize) };
+        // Start the throttled update of our scrollbar - but only if the
+        // values actually moved. At max scrollback, every line of output
+        // renotifies the same position/viewport/history triple, and
+        // re-running the throttle for identical values just churns timers
+        // and the dispatcher.
+        const std::tuple<int, int, int> update{ viewTop, viewHeight, bufferSize };
         if (!_inUnitTests && _updateScrollBar)
         {
-            _updateScrollBar->Run(update);
+            if (_lastEnqueuedScrollBarUpdate != update)
+            {
+                _lastEnqueuedScrollBarUpdate = update;
+                _updateScrollBar->Run(viewTop, viewHeight, bufferSize);
+            }
         }
         else
         {
-            _ScrollPositionChangedHandlers(*this, update);
+            auto args{ winrt::make<ScrollPositionChangedArgs>(viewTop,
+                                                              viewHeight,
+                                                              bufferSize) };
+            _ScrollPositionChangedHandlers(*this, args);
         }
 
         // Additionally, start the throttled update of where our links are.
@@ -1448,10 +1777,10 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     // - duration - How long the note should be sustained (in microseconds).
     void ControlCore::_terminalPlayMidiNote(const int noteNumber, const int velocity, const std::chrono::microseconds duration)
     {
-        // The UI thread might try to acquire the console lock from time to time.
-        // --> Unlock it, so the UI doesn't hang while we're busy.
+        // PlayNote just enqueues for the audio thread these days, but keep
+        // the lock suspended around it anyway: if the queue design ever
+        // regresses to blocking, this callsite mustn't hang the UI.
         const auto suspension = _terminal->SuspendLock();
-        // This call will block for the duration, unless shutdown early.
         _midiAudio.PlayNote(reinterpret_cast<HWND>(_owningHwnd), noteNumber, velocity, std::chrono::duration_cast<std::chrono::milliseconds>(duration));
     }
 
@@ -1502,6 +1831,26 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             return;
         }
 
+        // Every call supersedes whatever scan might still be running; the old
+        // one notices the bumped generation at its next chunk boundary. The
+        // scan itself runs off-thread so a search through a huge scrollback
+        // can't freeze the pane.
+        const auto generation = _searchGeneration.fetch_add(1, std::memory_order_relaxed) + 1;
+        _searchAsync(std::wstring{ text }, goForward, caseSensitive, generation);
+    }
+
+    winrt::fire_and_forget ControlCore::_searchAsync(std::wstring text, bool goForward, bool caseSensitive, uint64_t generation)
+    {
+        auto weakThis{ get_weak() };
+        co_await winrt::resume_background();
+
+        // Keep ourselves alive for the duration of the scan.
+        const auto strongThis = weakThis.get();
+        if (!strongThis)
+        {
+            co_return;
+        }
+
         const auto direction = goForward ?
                                    Search::Direction::Forward :
                                    Search::Direction::Backward;
@@ -1510,18 +1859,53 @@ namespace winrt::Microsoft::Terminal::Control::implementation
                                      Search::Sensitivity::CaseSensitive :
                                      Search::Sensitivity::CaseInsensitive;
 
-        ::Search search(*GetRenderData(), text.c_str(), direction, sensitivity);
-        auto lock = _terminal->LockForWriting();
-        const auto foundMatch{ search.FindNext() };
-        if (foundMatch)
+        // Scan in bounded chunks, taking the terminal lock only for the
+        // duration of each chunk: the parser keeps running between them, and
+        // another keystroke in the search box cancels us via the generation.
+        std::optional<::Search> search;
+        auto result = ::Search::Result::BudgetExhausted;
+        while (result == ::Search::Result::BudgetExhausted)
         {
-            _terminal->SetBlockSelection(false);
-            search.Select();
+            // (Close() bumps the generation too, so we also bail out here
+            // during teardown; _IsClosing() itself is main-thread-only.)
+            if (_searchGeneration.load(std::memory_order_relaxed) != generation)
+            {
+                co_return;
+            }
 
-            // this is used for search,
-            // DO NOT call _updateSelectionUI() here.
-            // We don't want to show the markers so manually tell it to clear it.
-            _renderer->TriggerSelection();
+            auto lock = _terminal->LockForWriting();
+            if (!search)
+            {
+                // The constructor reads the buffer to place its anchor, so it
+                // has to happen under the lock too.
+                search.emplace(*GetRenderData(), text, direction, sensitivity);
+            }
+
+            result = search->FindNext(SearchChunkBudget);
+            if (result == ::Search::Result::Found)
+            {
+                _terminal->SetBlockSelection(false);
+                search->Select();
+
+                // this is used for search,
+                // DO NOT call _updateSelectionUI() here.
+                // We don't want to show the markers so manually tell it to clear it.
+                _renderer->TriggerSelection();
+            }
+        }
+
+        // The notifications touch XAML (narrator, selection markers), so get
+        // back onto the control's dispatcher before raising them.
+        co_await wil::resume_foreground(_dispatcher);
+
+        if (_searchGeneration.load(std::memory_order_relaxed) != generation || _IsClosing())
+        {
+            co_return;
+        }
+
+        const auto foundMatch = result == ::Search::Result::Found;
+        if (foundMatch)
+        {
             _UpdateSelectionMarkersHandlers(*this, winrt::make<implementation::UpdateSelectionMarkersEventArgs>(true));
         }
 
@@ -1537,6 +1921,20 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         {
             _closing = true;
 
+            // Release a connection thread blocked on the pre-init buffer cap.
+            // The empty critical section orders the store against the wait
+            // predicate, so the notify can't be lost (see Initialize).
+            _outputThreadShutdown.store(true, std::memory_order_relaxed);
+            {
+                std::lock_guard guard{ _bufferedOutputMutex };
+            }
+            _bufferedOutputCV.notify_all();
+
+            // Cancel any background search scan or streaming paste at its
+            // next chunk boundary.
+            _searchGeneration.fetch_add(1, std::memory_order_relaxed);
+            _pasteGeneration.fetch_add(1, std::memory_order_relaxed);
+
             // Ensure Close() doesn't hang, waiting for MidiAudio to finish playing an hour long song.
             _midiAudio.BeginSkip();
 
@@ -1642,8 +2040,10 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             return { 0, 0 };
         }
 
-        auto lock = _terminal->LockForReading();
-        return _terminal->GetViewportRelativeCursorPosition().to_core_point();
+        // This is polled from the UI thread for IME/TSF placement, and an
+        // output flood holding the terminal lock used to stall it. Read the
+        // seqlock snapshot instead - no lock, writers never blocked.
+        return _terminal->GetViewSnapshot().viewportRelativeCursorPosition.to_core_point();
     }
 
     // This one's really pushing the boundary of what counts as "encapsulation".
@@ -1749,11 +2149,100 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         auto noticeArgs = winrt::make<NoticeEventArgs>(NoticeLevel::Info, RS_(L"TermControlReadOnly"));
         _RaiseNoticeHandlers(*this, std::move(noticeArgs));
     }
-    void ControlCore::_connectionOutputHandler(const hstring& hstr)
+    void ControlCore::_connectionOutputHandler(const winrt::array_view<const char16_t>& data)
     {
         try
         {
-            _terminal->Write(hstr);
+            // Output can arrive before Initialize has built the terminal,
+            // now that ConPTY connections start from the constructor; park
+            // it in the coalescing buffer until the flush in Initialize. A
+            // pane that never initializes (created hidden and flooding)
+            // blocks here at the cap instead of growing without bound.
+            if (!_initializedTerminal)
+            {
+                std::unique_lock guard{ _bufferedOutputMutex };
+                _bufferedOutputCV.wait(guard, [this]() {
+                    return _initializedTerminal ||
+                           _outputThreadShutdown.load(std::memory_order_relaxed) ||
+                           _bufferedOutput.size() < PreInitBufferLimit;
+                });
+                if (_outputThreadShutdown.load(std::memory_order_relaxed))
+                {
+                    return;
+                }
+                if (!_initializedTerminal)
+                {
+                    _bufferedOutput.append(winrt_array_to_wstring_view(data));
+                    return;
+                }
+                // Initialized while we waited: fall through to the normal
+                // path below, which drains the parked text first.
+            }
+
+            // Close the input-to-output latency measurement: this is the
+            // first connection output since a keystroke went out. It isn't
+            // echo-matched - a shell may transform or swallow input - but
+            // "first output after input" is the half of keypress-to-photon
+            // the terminal can measure without guessing, and the renderer's
+            // frame events carry the present half on the same QPC timeline
+            // for offline correlation.
+            if (const auto sentAt = _pendingInputTimestamp.exchange(0, std::memory_order_relaxed))
+            {
+                LARGE_INTEGER qpc, freq;
+                QueryPerformanceCounter(&qpc);
+                QueryPerformanceFrequency(&freq);
+                const auto latencyUs = (qpc.QuadPart - sentAt) * 1'000'000 / freq.QuadPart;
+#pragma warning(suppress : 26477) // We don't control TraceLoggingWrite
+                TraceLoggingWrite(g_hTerminalControlProvider,
+                                  "InputToOutputLatency",
+                                  TraceLoggingDescription("Microseconds from a keystroke reaching the connection to the first subsequent output"),
+                                  TraceLoggingInt64(latencyUs, "LatencyMicroseconds"),
+                                  TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+                                  TraceLoggingKeyword(TIL_KEYWORD_TRACE));
+            }
+
+            // An unfocused pane doesn't need to parse at line rate: coalesce
+            // the output and parse it in large batches, deferring the
+            // pattern bookkeeping until the flush. The batch-size cap flushes
+            // synchronously, so a flood still parses (just in big pieces) and
+            // memory stays bounded; the trailing timer guarantees quiet
+            // output lands within its interval.
+            if (!_focusedForThrottle.load(std::memory_order_relaxed))
+            {
+                auto flushNow = false;
+                {
+                    std::lock_guard guard{ _bufferedOutputMutex };
+                    const auto view = winrt_array_to_wstring_view(data);
+                    _bufferedOutput.append(view);
+                    flushNow = _bufferedOutput.size() >= BackgroundParseBatchSize;
+                }
+                if (flushNow)
+                {
+                    _flushBufferedOutput();
+                }
+                else if (_flushBufferedOutputThrottle)
+                {
+                    (*_flushBufferedOutputThrottle)();
+                }
+                return;
+            }
+
+            {
+                // The mutex serializes us against the background flush paths,
+                // so output accumulated right before a focus change always
+                // parses ahead of this chunk - stream order is sacred.
+                std::lock_guard guard{ _bufferedOutputMutex };
+                if (!_bufferedOutput.empty())
+                {
+                    _terminal->Write(_bufferedOutput);
+                    _bufferedOutput.clear();
+                }
+
+                // The view borrows the connection's conversion buffer; Write
+                // parses it into the buffer before returning, so nothing
+                // outlives the handler invocation.
+                _terminal->Write(winrt_array_to_wstring_view(data));
+            }
 
             // Start the throttled update of where our hyperlinks are.
             if (_updatePatternLocations)
@@ -1768,6 +2257,40 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         }
     }
 
+    // Method Description:
+    // - Parses everything a backgrounded pane accumulated. Called by the
+    //   trailing flush timer, by the accumulator hitting its size cap, and
+    //   by focus returning to the pane.
+    void ControlCore::_flushBufferedOutput()
+    try
+    {
+        // Nothing to write INTO before Initialize; the flush there picks the
+        // parked output up.
+        if (!_initializedTerminal)
+        {
+            return;
+        }
+
+        {
+            // Write under the same mutex the direct path serializes on (the
+            // lock ordering is always buffer mutex, then terminal lock).
+            std::lock_guard guard{ _bufferedOutputMutex };
+            if (_bufferedOutput.empty())
+            {
+                return;
+            }
+            _terminal->Write(_bufferedOutput);
+            _bufferedOutput.clear();
+            _bufferedOutput.shrink_to_fit();
+        }
+
+        if (_updatePatternLocations)
+        {
+            (*_updatePatternLocations)();
+        }
+    }
+    CATCH_LOG()
+
     uint64_t ControlCore::SwapChainHandle() const
     {
         // This is only ever called by TermControl::AttachContent, which occurs
@@ -1969,6 +2492,20 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     {
         if (_initializedTerminal)
         {
+            // An invisible window doesn't need frames. Park the render thread
+            // entirely while hidden: invalidations keep accumulating in the
+            // engines' dirty state and paint notifications stay pending, so
+            // re-enabling wakes the thread for exactly one catch-up frame of
+            // whatever changed in the meantime.
+            if (showOrHide)
+            {
+                _renderer->EnablePainting();
+            }
+            else
+            {
+                _renderer->WaitForPaintCompletionAndDisable(INFINITE);
+            }
+
             // show is true, hide is false
             if (auto conpty{ _connection.try_as<TerminalConnection::ConptyConnection>() })
             {
@@ -2000,6 +2537,14 @@ namespace winrt::Microsoft::Terminal::Control::implementation
 
     void ControlCore::_focusChanged(bool focused)
     {
+        _focusedForThrottle.store(focused, std::memory_order_relaxed);
+        if (focused)
+        {
+            // Everything the pane accumulated while backgrounded has to be
+            // visible the moment it's foregrounded again.
+            _flushBufferedOutput();
+        }
+
         // GH#13461 - temporarily turn off read-only mode, send the focus event,
         // then turn it back on. Even in focus mode, focus events are fine to
         // send. We don't want to pop a warning every time the control is
@@ -246,7 +246,9 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         // clang-format on
 
     private:
-        bool _initializedTerminal{ false };
+        // Atomic: written on the UI thread (under the terminal lock), but
+        // read by the connection thread's pre-init park predicate.
+        std::atomic<bool> _initializedTerminal{ false };
         bool _closing{ false };
 
         TerminalConnection::ITerminalConnection _connection{ nullptr };
@@ -277,6 +279,9 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         std::optional<wchar_t> _leadingSurrogate{ std::nullopt };
 
         std::optional<til::point> _lastHoveredCell{ std::nullopt };
+        // The pattern-tree generation the cached hover lookup below was
+        // resolved against; see _updateHoveredCell.
+        uint64_t _lastHoveredPatternGeneration{ 0 };
         // Track the last hyperlink ID we hovered over
         uint16_t _lastHoveredId{ 0 };
 
@@ -295,7 +300,25 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         winrt::Windows::System::DispatcherQueue _dispatcher{ nullptr };
         std::shared_ptr<ThrottledFuncTrailing<>> _tsfTryRedrawCanvas;
         std::unique_ptr<til::throttled_func_trailing<>> _updatePatternLocations;
-        std::shared_ptr<ThrottledFuncTrailing<Control::ScrollPositionChangedArgs>> _updateScrollBar;
+
+        // Background-pane output coalescing (see _connectionOutputHandler):
+        // while unfocused, connection chunks accumulate here and are parsed
+        // in large, infrequent batches instead of at line rate.
+        std::mutex _bufferedOutputMutex;
+        std::condition_variable _bufferedOutputCV;
+        // Set from Close() so a connection thread blocked on the pre-init
+        // buffer cap (below) wakes up and bails; _closing itself is
+        // main-thread-only by contract.
+        std::atomic<bool> _outputThreadShutdown{ false };
+        std::wstring _bufferedOutput;
+        std::atomic<bool> _focusedForThrottle{ true };
+        std::unique_ptr<til::throttled_func_trailing<>> _flushBufferedOutputThrottle;
+        std::shared_ptr<ThrottledFuncTrailing<int, int, int>> _updateScrollBar;
+        // The last values handed to _updateScrollBar, so identical
+        // notifications (every line of output at max scrollback) skip the
+        // throttle/dispatcher machinery entirely. Guarded by the terminal
+        // lock, like the notifications themselves.
+        std::optional<std::tuple<int, int, int>> _lastEnqueuedScrollBarUpdate;
 
         void _setupDispatcherAndCallbacks();
 
@@ -304,6 +327,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         void _refreshSizeUnderLock();
         void _updateSelectionUI();
         bool _shouldTryUpdateSelection(const WORD vkey);
+        void _triggerStaggeredRedraw(const bool backgroundChanged, const bool frameChanged);
 
         void _handleControlC();
         void _sendInputToConnection(std::wstring_view wstr);
@@ -326,6 +350,27 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         MidiAudio _midiAudio;
         winrt::Windows::System::DispatcherQueueTimer _midiAudioSkipTimer{ nullptr };
 
+        // Staggers settings-broadcast redraws; see _triggerStaggeredRedraw.
+        winrt::Windows::System::DispatcherQueueTimer _staggeredRedrawTimer{ nullptr };
+        bool _staggeredRedrawBackground{ false };
+        bool _staggeredRedrawFrame{ false };
+
+        // Bumped by every Search() call; an in-flight background scan gives
+        // up at its next chunk boundary once it no longer matches.
+        std::atomic<uint64_t> _searchGeneration{ 0 };
+
+        // Bumped on Close() to cancel an in-flight streaming paste.
+        std::atomic<uint64_t> _pasteGeneration{ 0 };
+
+        // QPC timestamp of the most recent keystroke that hasn't seen output
+        // yet (0 = none pending); the output handler closes the measurement.
+        // See the latency event in _connectionOutputHandler.
+        std::atomic<int64_t> _pendingInputTimestamp{ 0 };
+
+        // True once the constructor has started the connection, so
+        // Initialize doesn't start it a second time.
+        bool _connectionStartedEarly{ false };
+
 #pragma region RendererCallbacks
         void _rendererWarning(const HRESULT hr);
         winrt::fire_and_forget _renderEngineSwapChainChanged(const HANDLE handle);
@@ -333,9 +378,14 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         void _rendererTabColorChanged();
 #pragma endregion
 
+        winrt::fire_and_forget _searchAsync(std::wstring text, bool goForward, bool caseSensitive, uint64_t generation);
+        winrt::fire_and_forget _pasteAsync(std::wstring text, bool bracketed, uint64_t generation);
+
+        void _flushBufferedOutput();
+
         void _raiseReadOnlyWarning();
         void _updateAntiAliasingMode();
-        void _connectionOutputHandler(const hstring& hstr);
+        void _connectionOutputHandler(const winrt::array_view<const char16_t>& data);
         void _updateHoveredCell(const std::optional<til::point> terminalPosition);
         void _setOpacity(const double opacity);
 
@@ -42,15 +42,28 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             _rtf(rtf),
             _formats(formats) {}
 
+        CopyToClipboardEventArgs(hstring text,
+                                 Control::ClipboardDataGenerator htmlGenerator,
+                                 Control::ClipboardDataGenerator rtfGenerator,
+                                 Windows::Foundation::IReference<CopyFormat> formats) :
+            _text(text),
+            _htmlGenerator(htmlGenerator),
+            _rtfGenerator(rtfGenerator),
+            _formats(formats) {}
+
         hstring Text() { return _text; };
         hstring Html() { return _html; };
         hstring Rtf() { return _rtf; };
+        Control::ClipboardDataGenerator HtmlGenerator() { return _htmlGenerator; };
+        Control::ClipboardDataGenerator RtfGenerator() { return _rtfGenerator; };
         Windows::Foundation::IReference<CopyFormat> Formats() { return _formats; };
 
     private:
         hstring _text;
         hstring _html;
         hstring _rtf;
+        Control::ClipboardDataGenerator _htmlGenerator{ nullptr };
+        Control::ClipboardDataGenerator _rtfGenerator{ nullptr };
         Windows::Foundation::IReference<CopyFormat> _formats;
     };
 
@@ -8,6 +8,7 @@
 #include <LibraryResources.h>
 
 #include "TermControlAutomationPeer.h"
+#include "BlinkTimerService.h"
 #include "../../types/inc/GlyphWidth.hpp"
 #include "../../renderer/atlas/AtlasEngine.h"
 
@@ -61,8 +62,6 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         _autoScrollingPointerPoint{ std::nullopt },
         _autoScrollTimer{},
         _lastAutoScrollUpdateTime{ std::nullopt },
-        _cursorTimer{},
-        _blinkTimer{},
         _searchBox{ nullptr }
     {
         InitializeComponent();
@@ -967,50 +966,38 @@ namespace winrt::Microsoft::Terminal::Control::implementation
         ScrollBar().ViewportSize(bufferHeight);
         ScrollBar().LargeChange(std::max(bufferHeight - 1, 0)); // scroll one "screenful" at a time when the scroll bar is clicked
 
-        // Set up blinking cursor
+        // Set up the blinking cursor. Blinking is driven by the per-thread
+        // BlinkTimerService, so every cursor and blinking attribute on this
+        // thread shares (and stays in phase with) a single timer.
         int blinkTime = GetCaretBlinkTime();
-        if (blinkTime != INFINITE)
-        {
-            // Create a timer
-            DispatcherTimer cursorTimer;
-            cursorTimer.Interval(std::chrono::milliseconds(blinkTime));
-            cursorTimer.Tick({ get_weak(), &TermControl::_CursorTimerTick });
-            _cursorTimer.emplace(std::move(cursorTimer));
-            // As of GH#6586, don't start the cursor timer immediately, and
-            // don't show the cursor initially. We'll show the cursor and start
-            // the timer when the control is first focused.
+        _cursorBlinkEnabled = blinkTime != INFINITE;
+        if (_cursorBlinkEnabled)
+        {
+            // As of GH#6586, don't start blinking immediately, and don't show
+            // the cursor initially. We'll show the cursor and register with
+            // the blink service when the control is first focused.
             //
             // As of GH#11411, turn on the cursor if we've already been marked
             // as focused. We suspect that it's possible for the Focused event
             // to fire before the LayoutUpdated. In that case, the
-            // _GotFocusHandler would mark us _focused, but find that a
-            // _cursorTimer doesn't exist, and it would never turn on the
-            // cursor. To mitigate, we'll initialize the cursor's 'on' state
-            // with `_focused` here.
+            // _GotFocusHandler would mark us _focused before blinking was set
+            // up, and the cursor would never turn on. To mitigate, we'll
+            // initialize the cursor's 'on' state with `_focused` here, and
+            // pick up blinking right away if we're already focused.
             _core.CursorOn(_focused);
-        }
-        else
-        {
-            // The user has disabled cursor blinking
-            _cursorTimer = std::nullopt;
+            if (_focused)
+            {
+                _registerCursorBlink();
+            }
         }
 
         // Set up blinking attributes
         auto animationsEnabled = TRUE;
         SystemParametersInfoW(SPI_GETCLIENTAREAANIMATION, 0, &animationsEnabled, 0);
-        if (animationsEnabled && blinkTime != INFINITE)
-        {
-            // Create a timer
-            DispatcherTimer blinkTimer;
-            blinkTimer.Interval(std::chrono::milliseconds(blinkTime));
-            blinkTimer.Tick({ get_weak(), &TermControl::_BlinkTimerTick });
-            blinkTimer.Start();
-            _blinkTimer.emplace(std::move(blinkTimer));
-        }
-        else
+        _attributeBlinkEnabled = animationsEnabled && blinkTime != INFINITE;
+        if (_attributeBlinkEnabled)
         {
-            // The user has disabled blinking
-            _blinkTimer = std::nullopt;
+            _registerAttributeBlink();
         }
 
         // Now that the renderer is set up, update the appearance for initialization
@@ -1337,12 +1324,12 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             get_self<TermControlAutomationPeer>(_automationPeer)->RecordKeyEvent(vkey);
         }
 
-        if (_cursorTimer)
+        if (_cursorBlinkToken)
         {
-            // Manually show the cursor when a key is pressed. Restarting
-            // the timer prevents flickering.
+            // Manually show the cursor when a key is pressed. Resetting the
+            // blink phase prevents flickering.
             _core.CursorOn(_core.SelectionMode() != SelectionInteractionMode::Mark);
-            _cursorTimer->Start();
+            BlinkTimerService::ForCurrentThread().ResetPhase();
         }
 
         return handled;
@@ -1813,16 +1800,16 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             TSFInputControl().NotifyFocusEnter();
         }
 
-        if (_cursorTimer)
+        if (_cursorBlinkEnabled)
         {
             // When the terminal focuses, show the cursor immediately
             _core.CursorOn(_core.SelectionMode() != SelectionInteractionMode::Mark);
-            _cursorTimer->Start();
+            _registerCursorBlink();
         }
 
-        if (_blinkTimer)
+        if (_attributeBlinkEnabled)
         {
-            _blinkTimer->Start();
+            _registerAttributeBlink();
         }
 
         // Only update the appearance here if an unfocused config exists - if an
@@ -1863,17 +1850,12 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             TSFInputControl().NotifyFocusLeave();
         }
 
-        if (_cursorTimer)
+        _unregisterBlinkCallbacks();
+        if (_cursorBlinkEnabled)
         {
-            _cursorTimer->Stop();
             _core.CursorOn(false);
         }
 
-        if (_blinkTimer)
-        {
-            _blinkTimer->Stop();
-        }
-
         // Check if there is an unfocused config we should set the appearance to
         // upon losing focus
         if (_core.HasUnfocusedAppearance())
@@ -1940,30 +1922,57 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     }
 
     // Method Description:
-    // - Toggle the cursor on and off when called by the cursor blink timer.
-    // Arguments:
-    // - sender: not used
-    // - e: not used
-    void TermControl::_CursorTimerTick(const Windows::Foundation::IInspectable& /* sender */,
-                                       const Windows::Foundation::IInspectable& /* e */)
+    // - Hook this control's cursor up to the shared blink service. The
+    //   callback unregisters itself once the control is gone or closing.
+    void TermControl::_registerCursorBlink()
     {
-        if (!_IsClosing())
+        if (!_cursorBlinkToken)
         {
-            _core.BlinkCursor();
+            _cursorBlinkToken = BlinkTimerService::ForCurrentThread().Register([weak = get_weak()]() {
+                const auto control{ weak.get() };
+                if (!control || control->_IsClosing())
+                {
+                    return false;
+                }
+                control->_core.BlinkCursor();
+                return true;
+            });
         }
     }
 
     // Method Description:
-    // - Toggle the blinking rendition state when called by the blink timer.
-    // Arguments:
-    // - sender: not used
-    // - e: not used
-    void TermControl::_BlinkTimerTick(const Windows::Foundation::IInspectable& /* sender */,
-                                      const Windows::Foundation::IInspectable& /* e */)
+    // - Same as above, for the blinking text rendition.
+    void TermControl::_registerAttributeBlink()
     {
-        if (!_IsClosing())
+        if (!_attributeBlinkToken)
+        {
+            _attributeBlinkToken = BlinkTimerService::ForCurrentThread().Register([weak = get_weak()]() {
+                const auto control{ weak.get() };
+                if (!control || control->_IsClosing())
+                {
+                    return false;
+                }
+                control->_core.BlinkAttributeTick();
+                return true;
+            });
+        }
+    }
+
+    // Method Description:
+    // - Drop both blink registrations. Called on focus loss, close, and
+    //   detach; the weak-ref callbacks are the safety net if this is missed.
+    void TermControl::_unregisterBlinkCallbacks() noexcept
+    {
+        auto& service = BlinkTimerService::ForCurrentThread();
+        if (_cursorBlinkToken)
+        {
+            service.Unregister(*_cursorBlinkToken);
+            _cursorBlinkToken.reset();
+        }
+        if (_attributeBlinkToken)
         {
-            _core.BlinkAttributeTick();
+            service.Unregister(*_attributeBlinkToken);
+            _attributeBlinkToken.reset();
         }
     }
 
@@ -2117,6 +2126,7 @@ namespace winrt::Microsoft::Terminal::Control::implementation
             // Disconnect the TSF input control so it doesn't receive EditContext events.
             TSFInputControl().Close();
             _autoScrollTimer.Stop();
+            _unregisterBlinkCallbacks();
 
             if (!_detached)
             {
@@ -2128,6 +2138,10 @@ namespace winrt::Microsoft::Terminal::Control::implementation
     {
         _revokers = {};
 
+        // The blink service belongs to the thread we're leaving; drop our
+        // registrations here and re-register on focus after reattachment.
+        _unregisterBlinkCallbacks();
+
         Control::ControlInteractivity old{ nullptr };
         std::swap(old, _interactivity);
         old.Detach();
@@ -75,6 +75,8 @@ void Terminal::Create(til::size viewportSize, til::CoordType scrollbackLines, Re
     // passed through in some situations, so it's important that our state
     // machine is always prepared to accept them.
     _stateMachine->SetParserMode(StateMachine::Mode::AlwaysAcceptC1, true);
+
+    _publishViewSnapshot();
 }
 
 // Method Description:
@@ -283,6 +285,7 @@ std::wstring_view Terminal::GetWorkingDirectory() noexcept
         // viewport, then update our _altBufferSize tracker we're using to help
         // us out here.
         _altBufferSize = viewportSize;
+        _publishViewSnapshot();
         return S_OK;
     }
 
@@ -474,6 +477,7 @@ std::wstring_view Terminal::GetWorkingDirectory() noexcept
     }
     CATCH_LOG();
     _NotifyScrollEvent();
+    _publishViewSnapshot();
 
     return S_OK;
 }
@@ -489,6 +493,8 @@ void Terminal::Write(std::wstring_view stringView)
 
     const til::point cursorPosAfter{ cursor.GetPosition() };
 
+    _publishViewSnapshot();
+
     // Firing the CursorPositionChanged event is very expensive so we try not to
     // do that when the cursor does not need to be redrawn.
     if (cursorPosBefore != cursorPosAfter)
@@ -1230,6 +1236,7 @@ void Terminal::UpdatePatternsUnderLock()
 {
     auto oldTree = _patternIntervalTree;
     _patternIntervalTree = _activeBuffer().GetPatterns(_VisibleStartIndex(), _VisibleEndIndex());
+    _patternsGeneration.fetch_add(1, std::memory_order_release);
     _InvalidatePatternTree(oldTree);
     _InvalidatePatternTree(_patternIntervalTree);
 }
@@ -1242,9 +1249,19 @@ void Terminal::ClearPatternTree()
 {
     auto oldTree = _patternIntervalTree;
     _patternIntervalTree = {};
+    _patternsGeneration.fetch_add(1, std::memory_order_release);
     _InvalidatePatternTree(oldTree);
 }
 
+// Method Description:
+// - The current generation of the pattern interval tree. Readable without
+//   the terminal lock; callers that cached a pattern lookup can compare
+//   generations to learn whether it could still be valid.
+uint64_t Terminal::GetPatternGeneration() const noexcept
+{
+    return _patternsGeneration.load(std::memory_order_acquire);
+}
+
 // Method Description:
 // - Returns the tab color
 // If the starting color exists, its value is preferred
@@ -1356,7 +1373,9 @@ void Terminal::_updateUrlDetection()
     {
         // Add regex pattern recognizers to the buffer
         // For now, we only add the URI regex pattern
-        _hyperlinkPatternId = _activeBuffer().AddPatternRecognizer(linkPattern);
+        // Every URL the pattern can match contains a ':' - letting the scan
+        // skip viewports that can't possibly hold one.
+        _hyperlinkPatternId = _activeBuffer().AddPatternRecognizer(linkPattern, L':');
         UpdatePatternsUnderLock();
     }
     else
@@ -1520,6 +1539,44 @@ til::point Terminal::GetViewportRelativeCursorPosition() const noexcept
     return absoluteCursorPosition - viewport.Origin();
 }
 
+// Method Description:
+// - Reads the published view snapshot without taking the terminal lock.
+//   Classic seqlock read: grab the version, copy the data, and retry if a
+//   writer published in between (the version went odd or moved on).
+Terminal::ViewSnapshot Terminal::GetViewSnapshot() const noexcept
+{
+    for (;;)
+    {
+        const auto before = _viewSnapshotVersion.load(std::memory_order_acquire);
+        if (before & 1)
+        {
+            // A writer is mid-publish; the window is a handful of stores.
+            continue;
+        }
+
+        const auto copy = _viewSnapshot;
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (_viewSnapshotVersion.load(std::memory_order_relaxed) == before)
+        {
+            return copy;
+        }
+    }
+}
+
+// Method Description:
+// - Publishes a fresh view snapshot. Must be called under the write lock
+//   (there is only ever one publisher at a time); readers never block on it.
+void Terminal::_publishViewSnapshot() noexcept
+{
+    _viewSnapshotVersion.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    _viewSnapshot.viewportRelativeCursorPosition = GetViewportRelativeCursorPosition();
+
+    _viewSnapshotVersion.fetch_add(1, std::memory_order_release);
+}
+
 // These functions are used by TerminalInput, which must build in conhost
 // against OneCore compatible signatures. See the definitions in
 // VtApiRedirection.hpp (which we cannot include cross-project.)
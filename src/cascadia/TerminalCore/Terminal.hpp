@@ -79,6 +79,20 @@ public:
 
     til::point GetViewportRelativeCursorPosition() const noexcept;
 
+    // A seqlock-style snapshot of the small, hot state that UI-thread
+    // readers poll constantly (IME/TSF placement today). Writers publish a
+    // new version under the write lock; readers copy it with a retry loop
+    // instead of taking the lock, so an output flood holding the terminal
+    // lock can't stall them. Extend the struct (and _publishViewSnapshot)
+    // as further read paths migrate off the big lock.
+    struct ViewSnapshot
+    {
+        til::point viewportRelativeCursorPosition;
+    };
+    ViewSnapshot GetViewSnapshot() const noexcept;
+
+    uint64_t GetPatternGeneration() const noexcept;
+
     // Write comes from the PTY and goes to our parser to be stored in the output buffer
     void Write(std::wstring_view stringView);
 
@@ -304,6 +318,17 @@ private:
     // (std::function is like 64 bytes) to create some natural padding without wasting space.
     til::recursive_ticket_lock _readWriteLock;
 
+    // See GetViewSnapshot. The version is odd while a writer is mid-publish;
+    // readers retry until they observe the same even version on both sides
+    // of their copy.
+    void _publishViewSnapshot() noexcept;
+    std::atomic<uint64_t> _viewSnapshotVersion{ 0 };
+    ViewSnapshot _viewSnapshot{};
+
+    // Bumped whenever the pattern interval tree is rebuilt or cleared, so
+    // lock-free readers can tell whether a cached pattern lookup is stale.
+    std::atomic<uint64_t> _patternsGeneration{ 0 };
+
     std::function<void(const int, const int, const int)> _pfnScrollPositionChanged;
     std::function<void()> _pfnCursorPositionChanged;
     std::function<void()> _pfnTaskbarProgressChanged;
@@ -17,9 +17,9 @@ namespace winrt::Microsoft::Terminal::Settings::Editor::implementation
     void PreviewConnection::Start() noexcept
     {
         // First send a sequence to disable cursor blinking
-        _TerminalOutputHandlers(L"\x1b[?12l");
+        _TerminalOutputHandlers(winrt_wstring_to_array_view(L"\x1b[?12l"));
         // Send the preview text
-        _TerminalOutputHandlers(PreviewText);
+        _TerminalOutputHandlers(winrt_wstring_to_array_view(PreviewText));
     }
 
     void PreviewConnection::Initialize(const Windows::Foundation::Collections::ValueSet& /*settings*/) noexcept
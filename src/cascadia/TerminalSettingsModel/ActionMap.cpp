@@ -432,6 +432,7 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
         _NameMapCache = nullptr;
         _GlobalHotkeysCache = nullptr;
         _KeyBindingMapCache = nullptr;
+        _ResolvedKeyActionCacheValid = false;
 
         // Handle nested commands
         const auto cmdImpl{ get_self<Command>(cmd) };
@@ -710,7 +711,22 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
     // - nullptr if the key chord doesn't exist
     Model::Command ActionMap::GetActionByKeyChord(const Control::KeyChord& keys) const
     {
-        return _GetActionByKeyChordInternal(keys).value_or(nullptr);
+        // This is the per-keystroke path: resolve through the flattened
+        // table instead of recursing through the layer chain. The table is
+        // rebuilt lazily after any binding mutation (AddAction invalidates
+        // it together with the other keybinding caches), and collapses the
+        // explicitly-unbound and never-bound cases to nullptr exactly like
+        // the recursive walk did.
+        if (!_ResolvedKeyActionCacheValid)
+        {
+            _ResolvedKeyActionCache.clear();
+            std::unordered_set<Control::KeyChord, KeyChordHash, KeyChordEquality> unboundKeys;
+            _PopulateKeyBindingMapWithStandardCommands(_ResolvedKeyActionCache, unboundKeys);
+            _ResolvedKeyActionCacheValid = true;
+        }
+
+        const auto it = _ResolvedKeyActionCache.find(keys);
+        return it != _ResolvedKeyActionCache.end() ? it->second : nullptr;
     }
 
     // Method Description:
@@ -101,6 +101,13 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
         Windows::Foundation::Collections::IMap<Control::KeyChord, Model::Command> _GlobalHotkeysCache{ nullptr };
         Windows::Foundation::Collections::IMap<Control::KeyChord, Model::Command> _KeyBindingMapCache{ nullptr };
 
+        // The fully resolved chord->command table consulted on every
+        // keystroke: one hash probe instead of a recursive walk through the
+        // layered maps. Mutable because the const per-keystroke lookup
+        // rebuilds it lazily after a binding mutation invalidates it.
+        mutable std::unordered_map<Control::KeyChord, Model::Command, KeyChordHash, KeyChordEquality> _ResolvedKeyActionCache;
+        mutable bool _ResolvedKeyActionCacheValid{ false };
+
         Windows::Foundation::Collections::IVector<Model::Command> _ExpandedCommandsCache{ nullptr };
 
         std::unordered_map<winrt::hstring, Model::Command> _NestedCommands;
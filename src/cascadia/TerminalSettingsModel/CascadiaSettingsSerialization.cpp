@@ -149,15 +149,88 @@ SettingsLoader::SettingsLoader(const std::string_view& userJSON, const std::stri
 
 // Generate dynamic profiles and add them to the list of "inbox" profiles
 // (meaning profiles specified by the application rather by the user).
+// Each generator enumerates a different external source - filesystem for
+// PowerShell installs, the Lxss registry key for WSL, the Visual Studio
+// setup COM API, ssh config files. Running them one after the other put the
+// sum of those waits on the first window's startup path; instead, each
+// enumeration runs on its own thread and the results are spliced in the old
+// fixed order afterwards, so profile ordering (and everything derived from
+// it) is identical to the serial version while the wall time shrinks to the
+// slowest single source.
 void SettingsLoader::GenerateProfiles()
 {
-    _executeGenerator(PowershellCoreProfileGenerator{});
-    _executeGenerator(WslDistroGenerator{});
-    _executeGenerator(AzureCloudShellGenerator{});
-    _executeGenerator(VisualStudioGenerator{});
+    const PowershellCoreProfileGenerator powershellGenerator;
+    const WslDistroGenerator wslGenerator;
+    const AzureCloudShellGenerator azureGenerator;
+    const VisualStudioGenerator vsGenerator;
 #if TIL_FEATURE_DYNAMICSSHPROFILES_ENABLED
-    _executeGenerator(SshHostGenerator{});
+    const SshHostGenerator sshGenerator;
 #endif
+
+    const std::array generators{
+        static_cast<const IDynamicProfileGenerator*>(&powershellGenerator),
+        static_cast<const IDynamicProfileGenerator*>(&wslGenerator),
+        static_cast<const IDynamicProfileGenerator*>(&azureGenerator),
+        static_cast<const IDynamicProfileGenerator*>(&vsGenerator),
+#if TIL_FEATURE_DYNAMICSSHPROFILES_ENABLED
+        static_cast<const IDynamicProfileGenerator*>(&sshGenerator),
+#endif
+    };
+
+    std::array<std::vector<winrt::com_ptr<implementation::Profile>>, generators.size()> generated;
+
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(generators.size());
+        // Joined via scope guard, so a throw mid-spawn can't leave a
+        // joinable thread behind (which would terminate the process).
+        const auto joinAll = wil::scope_exit([&]() {
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        });
+        for (size_t i = 0; i < generators.size(); ++i)
+        {
+            if (_ignoredNamespaces.count(generators[i]->GetNamespace()))
+            {
+                continue;
+            }
+
+            threads.emplace_back([i, &generators, &generated]() noexcept {
+                const auto generatorNamespace = generators[i]->GetNamespace();
+                try
+                {
+                    // Some generators (Visual Studio) enumerate through COM.
+                    const auto coUninit = wil::CoInitializeEx(COINIT_MULTITHREADED);
+                    generators[i]->GenerateProfiles(generated[i]);
+                }
+                CATCH_LOG_MSG("Dynamic Profile Namespace: \"%.*s\"", gsl::narrow<int>(generatorNamespace.size()), generatorNamespace.data())
+            });
+        }
+    }
+
+    for (size_t i = 0; i < generators.size(); ++i)
+    {
+        auto& profiles = generated[i];
+        if (profiles.empty())
+        {
+            continue;
+        }
+
+        // By setting the Origin/Source here, we deduplicate some code and
+        // ensure they aren't missing accidentally.
+        const winrt::hstring source{ generators[i]->GetNamespace() };
+        for (const auto& profile : profiles)
+        {
+            profile->Origin(OriginTag::Generated);
+            profile->Source(source);
+        }
+
+        inboxSettings.profiles.insert(inboxSettings.profiles.end(),
+                                      std::make_move_iterator(profiles.begin()),
+                                      std::make_move_iterator(profiles.end()));
+    }
 }
 
 // A new settings.json gets a special treatment:
@@ -541,14 +614,31 @@ std::span<const winrt::com_ptr<Profile>> SettingsLoader::_getNonUserOriginProfil
 // This function is to be used for user settings files.
 void SettingsLoader::_parse(const OriginTag origin, const winrt::hstring& source, const std::string_view& content, ParsedSettings& settings)
 {
-    const auto json = _parseJson(content);
+    // The inbox defaults.json is a compile-time constant, yet we used to pay
+    // a full jsoncpp parse of it on every load - including every settings
+    // reload. Parse it once per process and share the DOM: everything below
+    // only reads it (FromJson builds fresh objects), so reuse is safe. The
+    // pointer comparison makes sure a test-provided inbox string with the
+    // same contents doesn't alias the cache.
+    const JsonSettings* json = nullptr;
+    std::optional<JsonSettings> parsedHolder;
+    if (origin == OriginTag::InBox && content.data() == DefaultJson.data() && content.size() == DefaultJson.size())
+    {
+        static const JsonSettings cachedInboxJson{ _parseJson(DefaultJson) };
+        json = &cachedInboxJson;
+    }
+    else
+    {
+        parsedHolder.emplace(_parseJson(content));
+        json = &*parsedHolder;
+    }
 
     settings.clear();
 
     {
-        settings.globals = GlobalAppSettings::FromJson(json.root);
+        settings.globals = GlobalAppSettings::FromJson(json->root);
 
-        for (const auto& schemeJson : json.colorSchemes)
+        for (const auto& schemeJson : json->colorSchemes)
         {
             if (const auto scheme = ColorScheme::FromJson(schemeJson))
             {
@@ -558,7 +648,7 @@ void SettingsLoader::_parse(const OriginTag origin, const winrt::hstring& source
     }
 
     {
-        for (const auto& themeJson : json.themes)
+        for (const auto& themeJson : json->themes)
         {
             if (const auto theme = Theme::FromJson(themeJson))
             {
@@ -577,7 +667,7 @@ void SettingsLoader::_parse(const OriginTag origin, const winrt::hstring& source
     }
 
     {
-        settings.baseLayerProfile = Profile::FromJson(json.profileDefaults);
+        settings.baseLayerProfile = Profile::FromJson(json->profileDefaults);
         // Remove the `guid` member from the default settings.
         // That will hyper-explode, so just don't let them do that.
         settings.baseLayerProfile->ClearGuid();
@@ -585,11 +675,11 @@ void SettingsLoader::_parse(const OriginTag origin, const winrt::hstring& source
     }
 
     {
-        const auto size = json.profilesList.size();
+        const auto size = json->profilesList.size();
         settings.profiles.reserve(size);
         settings.profilesByGuid.reserve(size);
 
-        for (const auto& profileJson : json.profilesList)
+        for (const auto& profileJson : json->profilesList)
         {
             auto profile = _parseProfile(origin, source, profileJson);
             // GH#9962: Discard Guid-less, Name-less profiles.
@@ -768,37 +858,6 @@ void SettingsLoader::_addUserProfileParent(const winrt::com_ptr<implementation::
 }
 
 // As the name implies it executes a generator.
-// Generated profiles are added to .inboxSettings. Used by GenerateProfiles().
-void SettingsLoader::_executeGenerator(const IDynamicProfileGenerator& generator)
-{
-    const auto generatorNamespace = generator.GetNamespace();
-    if (_ignoredNamespaces.count(generatorNamespace))
-    {
-        return;
-    }
-
-    const auto previousSize = inboxSettings.profiles.size();
-
-    try
-    {
-        generator.GenerateProfiles(inboxSettings.profiles);
-    }
-    CATCH_LOG_MSG("Dynamic Profile Namespace: \"%.*s\"", gsl::narrow<int>(generatorNamespace.size()), generatorNamespace.data())
-
-    // If the generator produced some profiles we're going to give them default attributes.
-    // By setting the Origin/Source/etc. here, we deduplicate some code and ensure they aren't missing accidentally.
-    if (inboxSettings.profiles.size() > previousSize)
-    {
-        const winrt::hstring source{ generatorNamespace };
-
-        for (const auto& profile : std::span(inboxSettings.profiles).subspan(previousSize))
-        {
-            profile->Origin(OriginTag::Generated);
-            profile->Source(source);
-        }
-    }
-}
-
 // Method Description:
 // - Creates a CascadiaSettings from whatever's saved on disk, or instantiates
 //      a new one with the default values. If we're running as a packaged app,
@@ -309,6 +309,32 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
         return 0;
     }
 
+    // The decoded bitmaps extracted from binaries (exe/dll/lnk icons), keyed
+    // by "path,index" and validated against the file's write time. Extraction
+    // costs SHDefExtractIcon plus a WIC decode, and the new-tab dropdown
+    // re-resolves every profile's icon per open - with this, only the first
+    // use (or a changed file) pays, and it pays off the UI thread. Shared
+    // across every window in the process; entries are a handful of 32x32
+    // bitmaps. Extraction failures are cached too (as null), so a bad path
+    // doesn't retry per open.
+    struct CachedBinaryIcon
+    {
+        FILETIME lastWrite{};
+        SoftwareBitmap bitmap{ nullptr };
+    };
+    static std::mutex s_binaryIconCacheMutex;
+    static std::unordered_map<std::wstring, CachedBinaryIcon> s_binaryIconCache;
+
+    static FILETIME _lastWriteTime(const std::wstring& path) noexcept
+    {
+        WIN32_FILE_ATTRIBUTE_DATA data{};
+        if (GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &data))
+        {
+            return data.ftLastWriteTime;
+        }
+        return {};
+    }
+
     winrt::Windows::UI::Xaml::Media::Imaging::SoftwareBitmapSource _getImageIconSourceForBinary(std::wstring_view iconPathWithoutIndex,
                                                                                                 int index)
     {
@@ -318,14 +344,73 @@ namespace winrt::Microsoft::Terminal::Settings::Model::implementation
         // * C:\Program Files\PowerShell\6-preview\pwsh.exe, 0 (this doesn't exist for me)
         // * C:\Program Files\PowerShell\7\pwsh.exe, 0
 
-        const auto swBitmap{ _getBitmapFromIconFileAsync(winrt::hstring{ iconPathWithoutIndex }, index, 32) };
-        if (swBitmap == nullptr)
+        const std::wstring path{ iconPathWithoutIndex };
+        auto key = path;
+        key.push_back(L',');
+        key.append(std::to_wstring(index));
+
+        const auto lastWrite = _lastWriteTime(path);
+
         {
-            return nullptr;
+            std::lock_guard guard{ s_binaryIconCacheMutex };
+            if (const auto it = s_binaryIconCache.find(key); it != s_binaryIconCache.end() &&
+                                                            it->second.lastWrite.dwLowDateTime == lastWrite.dwLowDateTime &&
+                                                            it->second.lastWrite.dwHighDateTime == lastWrite.dwHighDateTime)
+            {
+                if (!it->second.bitmap)
+                {
+                    return nullptr;
+                }
+                winrt::Windows::UI::Xaml::Media::Imaging::SoftwareBitmapSource cachedSource{};
+                cachedSource.SetBitmapAsync(it->second.bitmap);
+                return cachedSource;
+            }
         }
 
+        // First use (or the file changed): hand back an empty source now and
+        // fill it in when the background extraction completes, so the UI
+        // thread never waits on file I/O or the decoder. Until then the icon
+        // is blank - the same thing a failed extraction has always shown.
         winrt::Windows::UI::Xaml::Media::Imaging::SoftwareBitmapSource bitmapSource{};
-        bitmapSource.SetBitmapAsync(swBitmap);
+
+        const auto dispatcher = winrt::Windows::System::DispatcherQueue::GetForCurrentThread();
+        if (!dispatcher)
+        {
+            // No dispatcher to get back to (tests): decode synchronously.
+            const auto swBitmap{ _getBitmapFromIconFileAsync(winrt::hstring{ path }, index, 32) };
+            {
+                std::lock_guard guard{ s_binaryIconCacheMutex };
+                s_binaryIconCache.insert_or_assign(key, CachedBinaryIcon{ lastWrite, swBitmap });
+            }
+            if (swBitmap == nullptr)
+            {
+                return nullptr;
+            }
+            bitmapSource.SetBitmapAsync(swBitmap);
+            return bitmapSource;
+        }
+
+        std::thread([path, index, key, lastWrite, bitmapSource, dispatcher]() noexcept {
+            try
+            {
+                const auto coUninit = wil::CoInitializeEx(COINIT_MULTITHREADED);
+                const auto swBitmap{ _getBitmapFromIconFileAsync(winrt::hstring{ path }, index, 32) };
+
+                {
+                    std::lock_guard guard{ s_binaryIconCacheMutex };
+                    s_binaryIconCache.insert_or_assign(key, CachedBinaryIcon{ lastWrite, swBitmap });
+                }
+
+                if (swBitmap)
+                {
+                    dispatcher.TryEnqueue([bitmapSource, swBitmap]() {
+                        bitmapSource.SetBitmapAsync(swBitmap);
+                    });
+                }
+            }
+            CATCH_LOG();
+        }).detach();
+
         return bitmapSource;
     }
 
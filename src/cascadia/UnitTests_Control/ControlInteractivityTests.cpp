@@ -101,7 +101,8 @@ namespace ControlUnitTests
         auto _addInputCallback(const winrt::com_ptr<MockConnection>& conn,
                                std::deque<std::wstring>& expectedOutput)
         {
-            conn->TerminalOutput([&](const hstring& hstr) {
+            conn->TerminalOutput([&](const winrt::array_view<const char16_t>& data) {
+                const std::wstring hstr{ winrt_array_to_wstring_view(data) };
                 VERIFY_IS_GREATER_THAN(expectedOutput.size(), 0u);
                 const auto expected = expectedOutput.front();
                 expectedOutput.pop_front();
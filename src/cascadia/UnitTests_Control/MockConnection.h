@@ -18,7 +18,7 @@ namespace ControlUnitTests
         void Start() noexcept {};
         void WriteInput(const winrt::hstring& data)
         {
-            _TerminalOutputHandlers(data);
+            _TerminalOutputHandlers(winrt_wstring_to_array_view(data));
         }
         void Resize(uint32_t /*rows*/, uint32_t /*columns*/) noexcept {}
         void Close() noexcept {}
@@ -31,13 +31,63 @@ public:
         _func{ std::move(func) },
         _timer{ _create_timer() }
     {
-        const auto d = -delay.count();
-        if (d >= 0)
+        if (delay.count() <= 0)
         {
             throw std::invalid_argument("non-positive delay specified");
         }
 
-        memcpy(&_delay, &d, sizeof(d));
+        _currentDelay.store(delay.count(), std::memory_order_relaxed);
+
+        // Let the kernel coalesce this timer with others due within a
+        // quarter of the delay; throttles don't care about sub-delay
+        // precision, and batched expirations keep idle cores asleep.
+        _coalesceWindow = gsl::narrow_cast<DWORD>(std::chrono::duration_cast<std::chrono::milliseconds>(delay).count() / 4);
+    }
+
+    // Constructs an adaptive ThrottledFunc. The effective delay starts at
+    // minDelay, doubles each time a new throttle cycle begins hot on the
+    // heels of the previous one (a sustained flood), saturating at maxDelay,
+    // and snaps back to minDelay as soon as the calls go quiet. Interactive
+    // callers get minDelay latency; floods coalesce into ever-wider batches.
+    ThrottledFunc(
+        winrt::Windows::System::DispatcherQueue dispatcher,
+        filetime_duration minDelay,
+        filetime_duration maxDelay,
+        function func) :
+        ThrottledFunc{ std::move(dispatcher), minDelay, std::move(func) }
+    {
+        if (maxDelay < minDelay)
+        {
+            throw std::invalid_argument("maxDelay smaller than minDelay");
+        }
+
+        _minDelay = minDelay.count();
+        _maxDelay = maxDelay.count();
+        _currentDelay.store(_minDelay, std::memory_order_relaxed);
+    }
+
+    // Makes a pending trailing invocation fire as soon as possible instead
+    // of waiting out the rest of its delay, and resets an adaptive delay
+    // back to its minimum. Use this on user-input events: echo feedback
+    // must not wait out a delay that an output flood widened.
+    void FastFlush()
+    {
+        // FastFlush runs on the UI thread while Run's leading edge runs on
+        // whatever thread produced the burst; the delay lives in one atomic
+        // (and the FILETIME handed to the kernel is always built locally in
+        // _relativeDueTime), so the two never tear each other's state.
+        if (_maxDelay)
+        {
+            _currentDelay.store(_minDelay, std::memory_order_relaxed);
+        }
+
+        if (_storage)
+        {
+            // Re-arm the existing timer to fire immediately; the trailing
+            // edge then consumes the pending arguments as usual.
+            FILETIME now{};
+            SetThreadpoolTimerEx(_timer.get(), &now, 0, 0);
+        }
     }
 
     // ThrottledFunc uses its `this` pointer when creating _timer.
@@ -79,6 +129,11 @@ private:
 
     void _leading_edge()
     {
+        if (_maxDelay)
+        {
+            _adjustDelayForRate();
+        }
+
         if constexpr (leading)
         {
             _dispatcher.TryEnqueue(winrt::Windows::System::DispatcherQueuePriority::Normal, [weakSelf = this->weak_from_this()]() {
@@ -90,13 +145,15 @@ private:
                     }
                     CATCH_LOG();
 
-                    SetThreadpoolTimerEx(self->_timer.get(), &self->_delay, 0, 0);
+                    auto due = self->_relativeDueTime();
+                    SetThreadpoolTimerEx(self->_timer.get(), &due, 0, self->_coalesceWindow);
                 }
             });
         }
         else
         {
-            SetThreadpoolTimerEx(_timer.get(), &_delay, 0, 0);
+            auto due = _relativeDueTime();
+            SetThreadpoolTimerEx(_timer.get(), &due, 0, _coalesceWindow);
         }
     }
 
@@ -121,6 +178,35 @@ private:
         }
     }
 
+    // Called at the start of each throttle cycle in adaptive mode: widen
+    // the delay while cycles chain back-to-back, snap back once they don't.
+    void _adjustDelayForRate()
+    {
+        const auto now = std::chrono::steady_clock::now();
+        const auto gap = now - _lastCycleStart;
+        _lastCycleStart = now;
+
+        // "Back-to-back" = the next cycle began within two current delays of
+        // the previous one; anything slower counts as interactive. Work on a
+        // local copy and publish with one store, so a concurrent FastFlush
+        // either lands before or after this cycle's verdict, never inside it.
+        const auto current = _currentDelay.load(std::memory_order_relaxed);
+        const auto next = gap <= filetime_duration{ current * 2 } ? std::min(current * 2, _maxDelay) : _minDelay;
+        _currentDelay.store(next, std::memory_order_relaxed);
+    }
+
+    // Builds the relative due time for SetThreadpoolTimerEx from the current
+    // delay. Always constructed locally at the call site: the delay is a
+    // single atomic, so a racing FastFlush can shorten the next arm but can
+    // never hand the kernel a torn FILETIME.
+    FILETIME _relativeDueTime() const noexcept
+    {
+        const auto d = -_currentDelay.load(std::memory_order_relaxed);
+        FILETIME ft;
+        memcpy(&ft, &d, sizeof(d));
+        return ft;
+    }
+
     inline wil::unique_threadpool_timer _create_timer()
     {
         wil::unique_threadpool_timer timer{ CreateThreadpoolTimer(&_timer_callback, this, nullptr) };
@@ -128,7 +214,11 @@ private:
         return timer;
     }
 
-    FILETIME _delay;
+    DWORD _coalesceWindow = 0;
+    int64_t _minDelay = 0;
+    int64_t _maxDelay = 0; // nonzero = adaptive mode
+    std::atomic<int64_t> _currentDelay{ 0 };
+    std::chrono::steady_clock::time_point _lastCycleStart{};
     winrt::Windows::System::DispatcherQueue _dispatcher;
     function _func;
 
@@ -215,7 +215,9 @@ void AppHost::_HandleCommandlineArgs(const Remoting::WindowRequestedArgs& window
         // use to send the actions to the app.
         //
         // MORE EVENT HANDLERS, same rules as the ones above.
-        _revokers.peasantExecuteCommandlineRequested = _peasant.ExecuteCommandlineRequested(winrt::auto_revoke, { this, &AppHost::_DispatchCommandline });
+        // (Lambda rather than a member pointer: the handler is a coroutine
+        // now, and the delegate wants a void-returning callable.)
+        _revokers.peasantExecuteCommandlineRequested = _peasant.ExecuteCommandlineRequested(winrt::auto_revoke, [this](auto&& sender, auto&& args) { _DispatchCommandline(sender, args); });
         _revokers.peasantSummonRequested = _peasant.SummonRequested(winrt::auto_revoke, { this, &AppHost::_HandleSummon });
         _revokers.peasantDisplayWindowIdRequested = _peasant.DisplayWindowIdRequested(winrt::auto_revoke, { this, &AppHost::_DisplayWindowId });
         _revokers.peasantQuitRequested = _peasant.QuitRequested(winrt::auto_revoke, { this, &AppHost::_QuitRequested });
@@ -806,9 +808,18 @@ void AppHost::_WindowMouseWheeled(const til::point coord, const int32_t delta)
 // - args: the bundle of a commandline and working directory to use for this invocation.
 // Return Value:
 // - <none>
-void AppHost::_DispatchCommandline(winrt::Windows::Foundation::IInspectable sender,
-                                   Remoting::CommandlineArgs args)
+winrt::fire_and_forget AppHost::_DispatchCommandline(winrt::Windows::Foundation::IInspectable sender,
+                                                     Remoting::CommandlineArgs args)
 {
+    // We're called on the RPC thread of the cross-process ExecuteCommandline
+    // call. Everything below copies what it needs (sender and args are
+    // refcounted), so hop to the UI thread and let the RPC call return as
+    // soon as the work is queued: the `wt -w 0 new-tab` that proposed this
+    // commandline then pays one round trip, not the full cost of summoning
+    // the window and executing the actions. The call's success only ever
+    // signaled "the peasant is alive", which the RPC layer still reports.
+    co_await wil::resume_foreground(_windowLogic.GetRoot().Dispatcher());
+
     const Remoting::SummonWindowBehavior summonArgs{};
     summonArgs.MoveToCurrentDesktop(false);
     summonArgs.DropdownDuration(0);
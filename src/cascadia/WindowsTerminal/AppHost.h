@@ -66,7 +66,7 @@ private:
     winrt::fire_and_forget _WindowActivated(bool activated);
     void _WindowMoved();
 
-    void _DispatchCommandline(winrt::Windows::Foundation::IInspectable sender,
+    winrt::fire_and_forget _DispatchCommandline(winrt::Windows::Foundation::IInspectable sender,
                               winrt::Microsoft::Terminal::Remoting::CommandlineArgs args);
 
     winrt::Windows::Foundation::IAsyncOperation<winrt::hstring> _GetWindowLayoutAsync();
@@ -334,6 +334,17 @@ void IslandWindow::Initialize()
 
 void IslandWindow::OnSize(const UINT width, const UINT height)
 {
+    // Geometry messages arrive in bursts (maximize and DPI transitions
+    // deliver several WM_SIZEs for the same final size), and each pass here
+    // costs an interop-window SetWindowPos plus a XAML island re-layout
+    // that cascades into swapchain reallocation. Fold exact duplicates away;
+    // only a size we haven't applied yet does the work.
+    if (_lastAppliedSize && _lastAppliedSize->width == static_cast<til::CoordType>(width) && _lastAppliedSize->height == static_cast<til::CoordType>(height))
+    {
+        return;
+    }
+    _lastAppliedSize = til::size{ static_cast<til::CoordType>(width), static_cast<til::CoordType>(height) };
+
     // update the interop window size
     SetWindowPos(_interopWindowHandle, nullptr, 0, 0, width, height, SWP_SHOWWINDOW | SWP_NOACTIVATE);
 
@@ -523,8 +534,41 @@ long IslandWindow::_calculateTotalSize(const bool isWidth, const long clientSize
     {
         return _OnMoving(wparam, lparam);
     }
+    case WM_DPICHANGED:
+    {
+        // A DPI change can deliver the same pixel size with a different
+        // scale; the logical layout must recompute then, so forget the
+        // duplicate-size suppression before the base handler resizes us.
+        _lastAppliedSize.reset();
+        break;
+    }
+    case WM_ENTERSIZEMOVE:
+    {
+        _inModalSizeMove = true;
+        _movedDuringModalLoop = false;
+        break;
+    }
+    case WM_EXITSIZEMOVE:
+    {
+        _inModalSizeMove = false;
+        break;
+    }
     case WM_MOVE:
     {
+        // An interactive drag delivers WM_MOVE continuously, and the moved
+        // handlers walk the XAML tree for popups to dismiss. Once per drag
+        // is enough - nothing can reopen a popup while the modal size/move
+        // loop has the input - so coalesce the burst to its first message.
+        // Moves outside the modal loop (scripts, Aero Snap) still fire
+        // every time.
+        if (_inModalSizeMove)
+        {
+            if (_movedDuringModalLoop)
+            {
+                break;
+            }
+            _movedDuringModalLoop = true;
+        }
         _WindowMovedHandlers();
         break;
     }
@@ -795,6 +839,9 @@ void IslandWindow::OnAppInitialized()
 {
     // Do a quick resize to force the island to paint
     const auto size = GetPhysicalSize();
+    // This call is deliberately redundant with the size we already hold, so
+    // it must not be folded away by the duplicate-size suppression.
+    _lastAppliedSize.reset();
     OnSize(size.width, size.height);
 }
 
@@ -138,6 +138,11 @@ protected:
     void _moveToMonitor(const MONITORINFO activeMonitor);
 
     bool _isQuakeWindow{ false };
+
+    // Geometry-burst coalescing state; see OnSize and WM_MOVE handling.
+    std::optional<til::size> _lastAppliedSize;
+    bool _inModalSizeMove{ false };
+    bool _movedDuringModalLoop{ false };
     bool _autoHideWindow{ false };
 
     void _enterQuakeMode();
@@ -246,6 +246,12 @@ void WindowEmperor::_becomeMonarch()
     // Set the number of open windows (so we know if we are the last window)
     // and subscribe for updates if there are any changes to that number.
 
+    // One notification-icon scan per quiescence interval is plenty; the
+    // icon only materializes or vanishes, and the scan walks every window.
+    _checkNotificationIconDebounce = std::make_unique<til::throttled_func_trailing<>>(
+        std::chrono::milliseconds(100),
+        [this]() { _checkWindowsForNotificationIcon(); });
+
     _revokers.WindowCreated = _manager.WindowCreated(winrt::auto_revoke, { this, &WindowEmperor::_numberOfWindowsChanged });
     _revokers.WindowClosed = _manager.WindowClosed(winrt::auto_revoke, { this, &WindowEmperor::_numberOfWindowsChanged });
 
@@ -287,8 +293,16 @@ void WindowEmperor::_numberOfWindowsChanged(const winrt::Windows::Foundation::II
     }
 
     // If we closed out the quake window, and don't otherwise need the tray
-    // icon, let's get rid of it.
-    _checkWindowsForNotificationIcon();
+    // icon, let's get rid of it. Debounced: a burst of created/closed
+    // events (session restore) folds into one scan after the burst.
+    if (_checkNotificationIconDebounce)
+    {
+        (*_checkNotificationIconDebounce)();
+    }
+    else
+    {
+        _checkWindowsForNotificationIcon();
+    }
 }
 
 // Raised from our windowManager (on behalf of the monarch). We respond by
@@ -45,6 +45,11 @@ private:
 
     std::optional<til::throttled_func_trailing<>> _getWindowLayoutThrottler;
 
+    // Debounces the per-window-created/closed notification icon scan: bulk
+    // operations (multi-window session restore) raise one event per window,
+    // and scanning every window on each event made the burst quadratic.
+    std::unique_ptr<til::throttled_func_trailing<>> _checkNotificationIconDebounce;
+
     winrt::event_token _WindowCreatedToken;
     winrt::event_token _WindowClosedToken;
 
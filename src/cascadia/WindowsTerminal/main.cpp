@@ -5,6 +5,11 @@
 #include "WindowEmperor.h"
 #include "resource.h"
 #include "../types/inc/User32Utils.hpp"
+#include "../types/inc/utils.hpp"
+
+#include <d3d11.h>
+#include <evntrace.h>
+#include <evntcons.h>
 #include <WilErrorReporting.h>
 
 using namespace winrt;
@@ -31,6 +36,133 @@ TRACELOGGING_DEFINE_PROVIDER(
 #include <LibraryResources.h>
 UTILS_DEFINE_LIBRARY_RESOURCE_SCOPE(L"TerminalApp/Resources");
 
+// Function Description:
+// - Creates and immediately releases a throwaway D3D11 device on a background
+//   thread. The first device creation in a process pays for loading
+//   dxgi/d3d11 and initializing the graphics driver - tens of milliseconds
+//   cold - and that cost otherwise lands serialized inside the first
+//   control's renderer bring-up. Warming it here overlaps it with XAML and
+//   settings work instead; only the process-global warm state matters.
+// - Loads d3d11 dynamically, so this project doesn't grow a static link for
+//   the sake of a warm-up call, and any failure is simply a skipped warm-up.
+static void _warmGraphicsDriverAsync() noexcept
+try
+{
+    std::thread([]() noexcept {
+        if (const auto d3dModule = LoadLibraryExW(L"d3d11.dll", nullptr, LOAD_LIBRARY_SEARCH_SYSTEM32))
+        {
+            const auto createDevice = reinterpret_cast<PFN_D3D11_CREATE_DEVICE>(GetProcAddress(d3dModule, "D3D11CreateDevice"));
+            if (createDevice)
+            {
+                wil::com_ptr<ID3D11Device> device;
+                std::ignore = createDevice(nullptr,
+                                           D3D_DRIVER_TYPE_HARDWARE,
+                                           nullptr,
+                                           D3D11_CREATE_DEVICE_BGRA_SUPPORT,
+                                           nullptr,
+                                           0,
+                                           D3D11_SDK_VERSION,
+                                           device.put(),
+                                           nullptr,
+                                           nullptr);
+            }
+            // Deliberately keep d3d11.dll loaded: unloading would throw the
+            // warmth away.
+        }
+    }).detach();
+}
+catch (...)
+{
+    // A failed warm-up costs nothing but the warmth.
+}
+
+// Function Description:
+// - Implements `wt --trace <seconds>`: starts an ETW file session enabling
+//   the terminal's own providers (the same set Terminal.wprp configures),
+//   captures for the requested duration, and drops the .etl into %TEMP%
+//   where a support engineer can ask for it by name. This process acts as
+//   the trace controller only - the events come from whichever terminal
+//   windows are actually running - so "start a trace, reproduce the
+//   slowness, send us the file" becomes one command.
+// - Creating a trace session needs admin (or Performance Log Users)
+//   rights; we say so instead of failing cryptically.
+static int _runSelfTrace(const int seconds)
+{
+    // The providers this binary and its components register, GUIDs as
+    // declared at their TRACELOGGING_DEFINE_PROVIDER sites.
+    static constexpr GUID providers[] = {
+        { 0x56c06166, 0x2e2e, 0x5f4d, { 0x7f, 0xf3, 0x74, 0xf4, 0xb7, 0x8c, 0x87, 0xd6 } }, // Microsoft.Windows.Terminal.Win32Host
+        { 0x6f1b4e63, 0x7e1f, 0x5bd0, { 0xa4, 0xc1, 0x9a, 0x3d, 0x2f, 0x8b, 0x11, 0xc4 } }, // Microsoft.Windows.Console.Render.Frame
+    };
+    static constexpr wchar_t sessionName[] = L"WindowsTerminalSelfTrace";
+
+    wchar_t etlPath[MAX_PATH];
+    const auto tempLen = GetTempPathW(MAX_PATH, etlPath);
+    if (!tempLen)
+    {
+        return 1;
+    }
+    wcscat_s(etlPath, L"WindowsTerminal-trace.etl");
+
+    // EVENT_TRACE_PROPERTIES wants the session name and file name appended
+    // to one allocation.
+    const auto bufferSize = sizeof(EVENT_TRACE_PROPERTIES) + sizeof(sessionName) + (MAX_PATH * sizeof(wchar_t));
+    auto buffer = std::make_unique<std::byte[]>(bufferSize);
+    memset(buffer.get(), 0, bufferSize);
+    const auto props = reinterpret_cast<EVENT_TRACE_PROPERTIES*>(buffer.get());
+    props->Wnode.BufferSize = static_cast<ULONG>(bufferSize);
+    props->Wnode.Flags = WNODE_FLAG_TRACED_GUID;
+    props->Wnode.ClientContext = 1; // QPC timestamps
+    props->LogFileMode = EVENT_TRACE_FILE_MODE_SEQUENTIAL;
+    props->LoggerNameOffset = sizeof(EVENT_TRACE_PROPERTIES);
+    props->LogFileNameOffset = sizeof(EVENT_TRACE_PROPERTIES) + sizeof(sessionName);
+    wcscpy_s(reinterpret_cast<wchar_t*>(buffer.get() + props->LogFileNameOffset), MAX_PATH, etlPath);
+
+    TRACEHANDLE session{};
+    // A stale session from a crashed run blocks the name; clear it first.
+    // (With scratch properties: ControlTrace writes session stats back into
+    // the buffer it's given, and ours has to stay pristine for StartTrace.)
+    {
+        auto scratch = std::make_unique<std::byte[]>(bufferSize);
+        memset(scratch.get(), 0, bufferSize);
+        const auto scratchProps = reinterpret_cast<EVENT_TRACE_PROPERTIES*>(scratch.get());
+        scratchProps->Wnode.BufferSize = static_cast<ULONG>(bufferSize);
+        scratchProps->LoggerNameOffset = sizeof(EVENT_TRACE_PROPERTIES);
+        ControlTraceW(0, sessionName, scratchProps, EVENT_TRACE_CONTROL_STOP);
+    }
+    auto status = StartTraceW(&session, sessionName, props);
+    if (status == ERROR_ACCESS_DENIED)
+    {
+        MessageBoxW(nullptr,
+                    L"Capturing a trace requires administrator rights (or membership in Performance Log Users). Re-run `wt --trace` from an elevated prompt.",
+                    L"Windows Terminal",
+                    MB_OK | MB_ICONERROR);
+        return 1;
+    }
+    if (status != ERROR_SUCCESS)
+    {
+        return 1;
+    }
+
+    for (const auto& provider : providers)
+    {
+        EnableTraceEx2(session, &provider, EVENT_CONTROL_CODE_ENABLE_PROVIDER, TRACE_LEVEL_VERBOSE, 0, 0, 0, nullptr);
+    }
+
+    Sleep(static_cast<DWORD>(std::clamp(seconds, 1, 600)) * 1000);
+
+    for (const auto& provider : providers)
+    {
+        EnableTraceEx2(session, &provider, EVENT_CONTROL_CODE_DISABLE_PROVIDER, TRACE_LEVEL_VERBOSE, 0, 0, 0, nullptr);
+    }
+    ControlTraceW(session, nullptr, props, EVENT_TRACE_CONTROL_STOP);
+
+    wchar_t message[MAX_PATH + 128];
+    swprintf_s(message, L"Trace captured to:\n%s\n\nAttach this file to the issue.", etlPath);
+    MessageBoxW(nullptr, message, L"Windows Terminal", MB_OK | MB_ICONINFORMATION);
+    return 0;
+}
+
 // Routine Description:
 // - Takes an image architecture and locates a string resource that maps to that architecture.
 // Arguments:
@@ -83,11 +215,40 @@ static void EnsureNativeArchitecture()
     }
 }
 
-int __stdcall wWinMain(HINSTANCE, HINSTANCE, LPWSTR, int)
+int __stdcall wWinMain(HINSTANCE, HINSTANCE, LPWSTR pCmdLine, int)
 {
+    // `wt --trace <seconds>`: act as a trace controller instead of a
+    // terminal; see _runSelfTrace. Handled before anything else spins up so
+    // the controller process stays featherweight.
+    if (pCmdLine)
+    {
+        // Token match, not substring: `wt foo.exe --tracefile x` must not
+        // trip this. Only a leading `--trace [seconds]` engages.
+        int argc = 0;
+        const auto argv = CommandLineToArgvW(GetCommandLineW(), &argc);
+        const auto freeArgv = wil::scope_exit([&]() { LocalFree(argv); });
+        if (argv && argc >= 2 && wcscmp(argv[1], L"--trace") == 0)
+        {
+            const auto seconds = argc >= 3 ? _wtoi(argv[2]) : 0;
+            return _runSelfTrace(seconds > 0 ? seconds : 10);
+        }
+    }
+
     TraceLoggingRegister(g_hWindowsTerminalProvider);
     ::Microsoft::Console::ErrorReporting::EnableFallbackFailureReporting(g_hWindowsTerminalProvider);
 
+    // Startup timeline: each phase boundary during launch emits one of these
+    // (here and in TerminalApp), all stamped in milliseconds since process
+    // creation, so fleet telemetry can histogram where a cold start went.
+    TraceLoggingWrite(
+        g_hWindowsTerminalProvider,
+        "StartupPhaseReached",
+        TraceLoggingDescription("Event emitted when a startup phase boundary is crossed"),
+        TraceLoggingValue("WinMainStart", "Phase"),
+        TraceLoggingInt64(::Microsoft::Console::Utils::MillisecondsSinceProcessLaunch(), "MsSinceLaunch"),
+        TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
+        TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance));
+
     // If Terminal is spawned by a shortcut that requests that it run in a new process group
     // while attached to a console session, that request is nonsense. That request will, however,
     // cause WT to start with Ctrl-C disabled. This wouldn't matter, because it's a Windows-subsystem
@@ -103,6 +264,9 @@ int __stdcall wWinMain(HINSTANCE, HINSTANCE, LPWSTR, int)
     // Make sure to call this so we get WM_POINTER messages.
     EnableMouseInPointer(true);
 
+    // Overlap graphics driver initialization with the rest of startup.
+    _warmGraphicsDriverAsync();
+
     // !!! LOAD BEARING !!!
     // We must initialize the main thread as a single-threaded apartment before
     // constructing any Xaml objects. Failing to do so will cause some issues
@@ -115,6 +279,16 @@ int __stdcall wWinMain(HINSTANCE, HINSTANCE, LPWSTR, int)
     winrt::init_apartment(winrt::apartment_type::single_threaded);
 
     const auto emperor = std::make_shared<::WindowEmperor>();
+
+    TraceLoggingWrite(
+        g_hWindowsTerminalProvider,
+        "StartupPhaseReached",
+        TraceLoggingDescription("Event emitted when a startup phase boundary is crossed"),
+        TraceLoggingValue("XamlApartmentReady", "Phase"),
+        TraceLoggingInt64(::Microsoft::Console::Utils::MillisecondsSinceProcessLaunch(), "MsSinceLaunch"),
+        TraceLoggingKeyword(MICROSOFT_KEYWORD_MEASURES),
+        TelemetryPrivacyDataTag(PDT_ProductAndServicePerformance));
+
     if (emperor->HandleCommandlineArgs())
     {
         emperor->WaitForWindows();
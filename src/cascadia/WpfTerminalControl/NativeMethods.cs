@@ -19,6 +19,14 @@ namespace Microsoft.Terminal.Wpf
         [UnmanagedFunctionPointer(CallingConvention.StdCall)]
         public delegate void WriteCallback([In, MarshalAs(UnmanagedType.LPWStr)] string data);
 
+        /// <summary>
+        /// Receives the shared texture handle when shared-texture presentation
+        /// is enabled; called again with a new handle on every resize. Open it
+        /// on a D3D9Ex device and hand the surface to a D3DImage.
+        /// </summary>
+        [UnmanagedFunctionPointer(CallingConvention.StdCall)]
+        public delegate void SharedTextureChangedCallback(IntPtr sharedTextureHandle);
+
         public enum WindowMessage : int
         {
             /// <summary>
@@ -200,6 +208,9 @@ namespace Microsoft.Terminal.Wpf
         [DllImport("PublicTerminalCore.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.StdCall)]
         public static extern void TerminalRegisterScrollCallback(IntPtr terminal, [MarshalAs(UnmanagedType.FunctionPtr)] ScrollCallback callback);
 
+        [DllImport("PublicTerminalCore.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.StdCall)]
+        public static extern uint TerminalEnableSharedTexturePresentation(IntPtr terminal, [MarshalAs(UnmanagedType.FunctionPtr)] SharedTextureChangedCallback callback);
+
         [DllImport("PublicTerminalCore.dll", CharSet = CharSet.Unicode, CallingConvention = CallingConvention.StdCall)]
         public static extern void TerminalRegisterWriteCallback(IntPtr terminal, [MarshalAs(UnmanagedType.FunctionPtr)] WriteCallback callback);
 
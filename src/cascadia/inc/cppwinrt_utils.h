@@ -201,6 +201,24 @@ std::vector<wil::com_ptr<T>> SafeArrayToOwningVector(SAFEARRAY* safeArray)
     return result;
 }
 
+// These two wrap the characters of a wide string in a non-owning array_view
+// (and back), for firing borrowed text through a WinRT delegate without
+// copying it into an hstring first. Within a process an array_view marshals
+// as pointer+length, so the callee reads the caller's buffer in place. The
+// view is only valid for the duration of the (synchronous) delegate
+// invocation - a handler that needs the text afterwards must copy it.
+inline winrt::array_view<const char16_t> winrt_wstring_to_array_view(const std::wstring_view& str) noexcept
+{
+#pragma warning(suppress : 26490) // wchar_t and char16_t are layout-compatible; the projection insists on char16_t.
+    return { reinterpret_cast<const char16_t*>(str.data()), gsl::narrow_cast<uint32_t>(str.size()) };
+}
+
+inline std::wstring_view winrt_array_to_wstring_view(const winrt::array_view<const char16_t>& chars) noexcept
+{
+#pragma warning(suppress : 26490) // see above.
+    return { reinterpret_cast<const wchar_t*>(chars.data()), chars.size() };
+}
+
 #define DECLARE_CONVERTER(nameSpace, className)                                                                   \
     namespace nameSpace::implementation                                                                           \
     {                                                                                                             \
@@ -137,6 +137,15 @@ try
                 return S_OK;
             }
 
+            // A drag-resize delivers a burst of these, and each one pays for
+            // a full buffer resize, reflow, and repaint. If the pipe already
+            // holds another complete resize message, the size in hand is
+            // already stale - supersede it with the newer one, so that only
+            // the last size of a burst does the work.
+            while (_PeekResizeMessage(resizeMsg))
+            {
+            }
+
             _DoResizeWindow(resizeMsg);
             break;
         }
@@ -281,6 +290,39 @@ void PtySignalInputThread::_DoSetWindowParent(const SetParentData& data)
     }
 }
 
+// Method Description:
+// - Checks whether the next complete message waiting in the signal pipe is
+//   another resize. If it is, consumes it and overwrites data with the newer
+//   dimensions.
+// Arguments:
+// - data - Overwritten with the newer resize dimensions, if there were any.
+// Return Value:
+// - True if a newer resize superseded the given one. False if the pipe is
+//   empty, doesn't yet hold a whole resize message, or holds some other
+//   signal next - those are left for the main loop to read normally.
+[[nodiscard]] bool PtySignalInputThread::_PeekResizeMessage(ResizeWindowData& data)
+{
+    if (!_hFile)
+    {
+        return false;
+    }
+
+    // Peek without consuming: anything that isn't a complete resize message
+    // must stay in the pipe for the main loop.
+    unsigned short peekBuffer[3];
+    DWORD bytesRead = 0;
+    if (!PeekNamedPipe(_hFile.get(), peekBuffer, sizeof(peekBuffer), &bytesRead, nullptr, nullptr) ||
+        bytesRead < sizeof(peekBuffer) ||
+        peekBuffer[0] != static_cast<unsigned short>(PtySignal::ResizeWindow))
+    {
+        return false;
+    }
+
+    // It's a whole resize message - now actually consume it from the pipe.
+    PtySignal signalId;
+    return _GetData(&signalId, sizeof(signalId)) && _GetData(&data, sizeof(data));
+}
+
 // Method Description:
 // - Retrieves bytes from the file stream and exits or throws errors should the pipe state
 //   be compromised.
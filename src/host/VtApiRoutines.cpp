@@ -39,7 +39,10 @@ VtApiRoutines::VtApiRoutines() :
     m_outputMode(),
     m_pUsualRoutines(),
     m_pVtEngine(),
-    m_listeningForDSR(false)
+    m_listeningForDSR(false),
+    m_title(),
+    m_cursorSize(25),
+    m_cursorVisible(true)
 {
 }
 
@@ -324,8 +327,10 @@ void VtApiRoutines::GetConsoleCursorInfoImpl(const SCREEN_INFORMATION& context,
                                              ULONG& size,
                                              bool& isVisible) noexcept
 {
-    // TODO GH10001: good luck capturing this out of the input buffer when it comes back in.
-    //m_pVtEngine->RequestCursor();
+    // The terminal owns the real cursor, but we remember what the client last
+    // asked for, which is also what the terminal is presenting on its behalf.
+    size = m_cursorSize;
+    isVisible = m_cursorVisible;
     return;
 }
 
@@ -333,6 +338,8 @@ void VtApiRoutines::GetConsoleCursorInfoImpl(const SCREEN_INFORMATION& context,
                                                               const ULONG size,
                                                               const bool isVisible) noexcept
 {
+    m_cursorSize = size;
+    m_cursorVisible = isVisible;
     isVisible ? (void)m_pVtEngine->_ShowCursor() : (void)m_pVtEngine->_HideCursor();
     (void)m_pVtEngine->_Flush();
     return S_OK;
@@ -377,6 +384,10 @@ void VtApiRoutines::GetConsoleScreenBufferInfoExImpl(const SCREEN_INFORMATION& c
     }
     else
     {
+        // Mirror the position into our cursor too, so a subsequent
+        // GetConsoleScreenBufferInfo reflects at least the last position the
+        // client explicitly set, without asking the terminal.
+        context.GetActiveBuffer().GetTextBuffer().GetCursor().SetPosition(position);
         (void)m_pVtEngine->_CursorPosition(position);
         (void)m_pVtEngine->_Flush();
     }
@@ -416,6 +427,14 @@ void VtApiRoutines::GetLargestConsoleWindowSizeImpl(const SCREEN_INFORMATION& co
 [[nodiscard]] HRESULT VtApiRoutines::SetConsoleTextAttributeImpl(SCREEN_INFORMATION& context,
                                                                  const WORD attribute) noexcept
 {
+    // Mirror the attributes locally so GetConsoleScreenBufferInfo can report
+    // them back without asking the terminal.
+    try
+    {
+        context.SetAttributes(TextAttribute{ attribute });
+    }
+    CATCH_LOG();
+
     (void)m_pVtEngine->_SetGraphicsRendition16Color(static_cast<BYTE>(attribute), true);
     (void)m_pVtEngine->_SetGraphicsRendition16Color(static_cast<BYTE>(attribute >> 4), false);
     (void)m_pVtEngine->_Flush();
@@ -599,6 +618,7 @@ extern HRESULT _ConvertCellsToWInplace(const UINT codepage,
 [[nodiscard]] HRESULT VtApiRoutines::GetConsoleTitleAImpl(std::span<char> title,
                                                           size_t& written,
                                                           size_t& needed) noexcept
+try
 {
     written = 0;
     needed = 0;
@@ -608,12 +628,42 @@ extern HRESULT _ConvertCellsToWInplace(const UINT codepage,
         title.front() = ANSI_NULL;
     }
 
+    if (m_title.empty())
+    {
+        return S_OK;
+    }
+
+    const auto converted = ConvertToA(m_inputCodepage, m_title);
+
+    // Match the legacy A behavior (see GetConsoleTitleAImplHelper): a buffer
+    // that can't hold the whole unterminated string gets nothing copied and
+    // no size reported; an exact-length buffer gets an unterminated copy.
+    if (title.size() > converted.size())
+    {
+        needed = converted.size();
+        std::copy_n(converted.data(), converted.size(), title.data());
+        til::at(title, converted.size()) = ANSI_NULL;
+        written = converted.size() + 1;
+    }
+    else if (!title.empty() && title.size() == converted.size())
+    {
+        needed = converted.size();
+        std::copy_n(converted.data(), converted.size(), title.data());
+        written = title.size();
+    }
+    else if (!title.empty())
+    {
+        written = 1;
+    }
+
     return S_OK;
 }
+CATCH_RETURN()
 
 [[nodiscard]] HRESULT VtApiRoutines::GetConsoleTitleWImpl(std::span<wchar_t> title,
                                                           size_t& written,
                                                           size_t& needed) noexcept
+try
 {
     written = 0;
     needed = 0;
@@ -623,8 +673,18 @@ extern HRESULT _ConvertCellsToWInplace(const UINT codepage,
         title.front() = UNICODE_NULL;
     }
 
+    needed = m_title.size();
+
+    if (!title.empty())
+    {
+        written = std::min(title.size() - 1, m_title.size());
+        std::copy_n(m_title.data(), written, title.data());
+        til::at(title, written) = UNICODE_NULL;
+    }
+
     return S_OK;
 }
+CATCH_RETURN()
 
 [[nodiscard]] HRESULT VtApiRoutines::GetConsoleOriginalTitleAImpl(std::span<char> title,
                                                                   size_t& written,
@@ -663,6 +723,14 @@ extern HRESULT _ConvertCellsToWInplace(const UINT codepage,
 
 [[nodiscard]] HRESULT VtApiRoutines::SetConsoleTitleWImpl(const std::wstring_view title) noexcept
 {
+    // Remember the title so GetConsoleTitle can be answered locally - the
+    // terminal never reports it back to us.
+    try
+    {
+        m_title = title;
+    }
+    CATCH_RETURN();
+
     (void)m_pVtEngine->UpdateTitle(title);
     (void)m_pVtEngine->_Flush();
     return S_OK;
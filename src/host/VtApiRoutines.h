@@ -385,6 +385,11 @@ public:
     ULONG m_inputMode;
     ULONG m_outputMode;
     bool m_listeningForDSR;
+    // The minimal state we track locally, so the corresponding queries can be
+    // answered without consulting the buffer machinery (or the terminal).
+    std::wstring m_title;
+    ULONG m_cursorSize;
+    bool m_cursorVisible;
     Microsoft::Console::Render::Xterm256Engine* m_pVtEngine;
 
 private:
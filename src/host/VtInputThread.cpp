@@ -107,9 +107,19 @@ DWORD WINAPI VtInputThread::StaticVtInputThreadProc(_In_ LPVOID lpParameter)
 // - <none>
 void VtInputThread::DoReadInput(const bool throwOnFail)
 {
-    char buffer[256];
+    // Each _HandleRunInput costs one console lock acquisition, and input
+    // bursts (mouse-reporting storms, large pastes) arrive as a stream of
+    // small pipe writes. Read what's there, then drain whatever else is
+    // already sitting in the pipe, and hand the whole burst to the parser
+    // under a single lock instead of one lock per few hundred bytes.
+    //
+    // Bounds how much we'll batch before letting the parser run, so a
+    // producer that outpaces us can't grow the buffer without limit.
+    static constexpr size_t maxBatchSize = 1024 * 1024;
+
     DWORD dwRead = 0;
-    auto fSuccess = !!ReadFile(_hFile.get(), buffer, ARRAYSIZE(buffer), &dwRead, nullptr);
+    _readBuffer.resize(_readSize);
+    auto fSuccess = !!ReadFile(_hFile.get(), _readBuffer.data(), gsl::narrow_cast<DWORD>(_readBuffer.size()), &dwRead, nullptr);
 
     if (!fSuccess)
     {
@@ -117,7 +127,36 @@ void VtInputThread::DoReadInput(const bool throwOnFail)
         return;
     }
 
-    auto hr = _HandleRunInput({ buffer, gsl::narrow_cast<size_t>(dwRead) });
+    size_t totalRead = dwRead;
+
+    DWORD available = 0;
+    while (totalRead < maxBatchSize &&
+           PeekNamedPipe(_hFile.get(), nullptr, 0, nullptr, &available, nullptr) &&
+           available > 0)
+    {
+        const auto offset = totalRead;
+        _readBuffer.resize(offset + available);
+        if (!ReadFile(_hFile.get(), _readBuffer.data() + offset, available, &dwRead, nullptr))
+        {
+            _exitRequested = true;
+            return;
+        }
+        totalRead += dwRead;
+    }
+
+    // Adapt the blocking read size to the stream: megabyte pastes fill
+    // every read and migrate to 64KB reads within a few iterations, while a
+    // quiet interactive session falls back to the small read.
+    if (totalRead >= _readSize)
+    {
+        _readSize = std::min(_readSize * 2, MaxReadSize);
+    }
+    else if (totalRead < _readSize / 4)
+    {
+        _readSize = std::max(_readSize / 2, MinReadSize);
+    }
+
+    auto hr = _HandleRunInput({ _readBuffer.data(), totalRead });
     if (FAILED(hr))
     {
         if (throwOnFail)
@@ -42,5 +42,13 @@ namespace Microsoft::Console
 
         std::unique_ptr<Microsoft::Console::VirtualTerminal::StateMachine> _pInputStateMachine;
         til::u8state _u8State;
+        // Retained between reads so burst draining doesn't reallocate.
+        std::string _readBuffer;
+        // Adaptive size of the blocking read: grows while input sustains
+        // full reads, shrinks back when the stream goes quiet.
+        size_t _readSize = MinReadSize;
+
+        static constexpr size_t MinReadSize = 4096;
+        static constexpr size_t MaxReadSize = 64 * 1024;
     };
 }
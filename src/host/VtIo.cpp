@@ -126,6 +126,17 @@ VtIo::VtIo() :
 
 // Method Description:
 // - Create the VtRenderer and the VtInputThread for this console.
+// - On thread count: each ConPTY conhost carries the VT input thread, the
+//   signal thread, and the driver IO thread - mostly idle, but ~3 stacks per
+//   pane. Folding them into one IOCP pump isn't a local change: the input
+//   thread owns blocking parser state and must be able to block on the
+//   console lock; the signal thread does blocking resize work under the same
+//   lock; and the device IO thread's wait is inside the condrv driver API
+//   (IoCompletePacket-style), not a pipe read we can multiplex. A pump needs
+//   the pipes reopened overlapped at creation (winconpty) and lock-aware
+//   continuation scheduling. Until then, the cheap mitigations are the burst
+//   batching on the input thread (fewer wakes) and the threads' small
+//   default stacks.
 // MUST BE DONE AFTER CONSOLE IS INITIALIZED, to make sure we've gotten the
 //  buffer size from the attached client application.
 // Arguments:
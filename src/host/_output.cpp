@@ -49,7 +49,14 @@ void WriteToScreen(SCREEN_INFORMATION& screenInfo, const Viewport& region)
     {
         if (ServiceLocator::LocateGlobals().pRender != nullptr)
         {
-            ServiceLocator::LocateGlobals().pRender->TriggerRedraw(region);
+            // Only the part of the write that's actually visible needs to be
+            // invalidated - we already computed the clip above. Per-call
+            // batching beyond this isn't needed: the render thread coalesces
+            // any number of these notifications into a single frame, so a
+            // thousand cell writes between two frames cost one repaint of
+            // their merged dirty region, and deferring the notification
+            // server-side would only add latency machinery on top of that.
+            ServiceLocator::LocateGlobals().pRender->TriggerRedraw(clippedRegion);
         }
     }
 
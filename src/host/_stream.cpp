@@ -198,6 +198,33 @@ using Microsoft::Console::VirtualTerminal::StateMachine;
             // WCL-NOTE: to be identical to lpString. They are incremented in lockstep, never separately, and lpString
             // WCL-NOTE: is initialized from pwchRealUnicode.
             const auto RealUnicodeChar = *pwchRealUnicode;
+
+            // Fast path: a run of plain ASCII printables is one column per
+            // character with no control/DBCS/tab handling involved, so the
+            // whole span can be classified with one scan and copied wholesale
+            // instead of re-deciding all of the above per character.
+            if (Char >= L' ' && Char < L'\x7f')
+            {
+                const auto charsRemaining = gsl::narrow_cast<til::CoordType>(std::min<size_t>((BufferSize - *pcb) / sizeof(WCHAR), LOCAL_BUFFER_SIZE));
+                const auto maxRun = std::min({ charsRemaining, LOCAL_BUFFER_SIZE - i, coordScreenBufferSize.width - XPosition });
+
+                til::CoordType run = 1;
+                while (run < maxRun && lpString[run] >= L' ' && lpString[run] < L'\x7f')
+                {
+                    ++run;
+                }
+
+                memcpy(LocalBufPtr, lpString, gsl::narrow_cast<size_t>(run) * sizeof(wchar_t));
+                LocalBufPtr += run;
+                XPosition += run;
+                i += run;
+                pwchBuffer += run;
+                lpString += run;
+                pwchRealUnicode += run;
+                *pcb += gsl::narrow_cast<size_t>(run) * sizeof(WCHAR);
+                continue;
+            }
+
             if (IS_GLYPH_CHAR(RealUnicodeChar) || fUnprocessed)
             {
                 // WCL-NOTE: This operates on a single code unit instead of a whole codepoint. It will mis-measure surrogate pairs.
@@ -354,9 +381,16 @@ using Microsoft::Console::VirtualTerminal::StateMachine;
                 i = coordScreenBufferSize.width - CursorPosition.x;
             }
 
-            // line was wrapped if we're writing up to the end of the current row
-            OutputCellIterator it(std::wstring_view(LocalBuffer, i), Attributes);
-            const auto itEnd = screenInfo.Write(it);
+            // The run we collected is plain text under a single attribute, so
+            // it can take ROW::ReplaceText's bulk path instead of spinning an
+            // OutputCellIterator over every cell. The collection loop above
+            // guarantees the run fits into the current row.
+            RowWriteState state{
+                .text = std::wstring_view{ LocalBuffer, gsl::narrow_cast<size_t>(i) },
+                .columnBegin = CursorPosition.x,
+                .columnLimit = coordScreenBufferSize.width,
+            };
+            textBuffer.WriteLine(CursorPosition.y, fWrapAtEOL, Attributes, state);
 
             // Notify accessibility
             if (screenInfo.HasAccessibilityEventing())
@@ -366,7 +400,7 @@ using Microsoft::Console::VirtualTerminal::StateMachine;
 
             // The number of "spaces" or "cells" we have consumed needs to be reported and stored for later
             // when/if we need to erase the command line.
-            TempNumSpaces += itEnd.GetCellDistance(it);
+            TempNumSpaces += state.columnEnd - state.columnBegin;
             // WCL-NOTE: We are using the "estimated" X position delta instead of the actual delta from
             // WCL-NOTE: the iterator. It is not clear why. If they differ, the cursor ends up in the
             // WCL-NOTE: wrong place (typically inside another character).
@@ -930,8 +964,12 @@ using Microsoft::Console::VirtualTerminal::StateMachine;
         const auto codepage{ consoleInfo.OutputCP };
         auto leadByteCaptured{ false };
         auto leadByteConsumed{ false };
-        std::wstring wstr{};
+        // Reused across calls (we're under the console lock, like the UTF-8
+        // carry state below), so steady-state A-writes stop allocating a
+        // conversion buffer per chunk.
+        static std::wstring wstr{};
         static til::u8state u8State{};
+        wstr.clear();
 
         // Convert our input parameters to Unicode
         if (codepage == CP_UTF8)
@@ -1144,7 +1144,9 @@ std::wstring Alias::s_MatchAndCopyAlias(const std::wstring& sourceText,
         return std::wstring();
     }
 
-    auto exeList = exeIter->second;
+    // Take the table by reference; copying it would put us right back to
+    // scaling with the number of aliases registered for this exe.
+    const auto& exeList = exeIter->second;
     if (exeList.size() == 0)
     {
         // If there's no match, give back an empty string.
@@ -1169,7 +1171,7 @@ std::wstring Alias::s_MatchAndCopyAlias(const std::wstring& sourceText,
         return std::wstring();
     }
 
-    const auto target = aliasIter->second;
+    const auto& target = aliasIter->second;
     if (target.size() == 0)
     {
         return std::wstring();
@@ -60,6 +60,20 @@ void ConsoleImeInfo::WriteCompMessage(const std::wstring_view text,
                                       const std::span<const BYTE> attributes,
                                       const std::span<const WORD> colorArray)
 {
+    // IMEs re-send the entire composition for updates that change nothing
+    // we draw - candidate window movements, repeated GCS notifications -
+    // and the clear-and-rebuild below repaints every composition cell each
+    // time. An update identical to what's already on screen (same text,
+    // same clause/cursor attributes, same colors) can skip all of it;
+    // that's the bulk of the redundant repaints in fast CJK typing.
+    if (!_text.empty() &&
+        text == _text &&
+        std::equal(attributes.begin(), attributes.end(), _attributes.begin(), _attributes.end()) &&
+        std::equal(colorArray.begin(), colorArray.end(), _colorArray.begin(), _colorArray.end()))
+    {
+        return;
+    }
+
     ClearAllAreas();
 
     // MSFT:29219348 only hide the cursor after the IME produces a string.
@@ -674,7 +674,6 @@ void EventsToUnicode(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents,
 {
     try
     {
-        const auto& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
         const auto& storageBuffer = context.GetActiveBuffer().GetTextBuffer();
         const auto storageSize = storageBuffer.GetSize().Dimensions();
 
@@ -712,46 +711,41 @@ void EventsToUnicode(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents,
         // We will start reading the buffer at the point of the top left corner (origin) of the (potentially adjusted) request
         const auto sourcePoint = clippedRequestRectangle.Origin();
 
-        // Get an iterator to the beginning of the return buffer
-        // We might have to seek this forward or skip around if we clipped the request.
-        auto targetIter = targetBuffer.begin();
-        til::point targetPos;
-        const auto targetLimit = Viewport::FromDimensions(targetPoint, clippedRequestRectangle.Dimensions());
-
-        // Get an iterator to the beginning of the request inside the screen buffer
-        // This should walk exactly along every cell of the clipped request.
-        auto sourceIter = storageBuffer.GetCellDataAt(sourcePoint, clippedRequestRectangle);
-
-        // Walk through every cell of the target, advancing the buffer.
-        // Validate that we always still have a valid iterator to the backing store,
-        // that we always are writing inside the user's buffer (before the end)
-        // and we're always targeting the user's buffer inside its original bounds.
-        while (sourceIter && targetIter < targetBuffer.end())
-        {
-            // If the point we're trying to write is inside the limited buffer write zone...
-            if (targetLimit.IsInBounds(targetPos))
-            {
-                // Copy the data into position...
-                *targetIter = gci.AsCharInfo(*sourceIter);
-                // ... and advance the read iterator.
-                ++sourceIter;
-            }
+        // Walk the clipped request row by row, reading the cells directly out
+        // of each ROW: the glyph, the DBCS flag, and a run-decoded attribute
+        // iterator. This skips the per-cell OutputCellView refresh and row
+        // re-resolution the cell iterator pays, which is where wide
+        // ReadConsoleOutput calls spent their time.
+        const auto width = clippedRequestRectangle.Width();
+        const auto height = clippedRequestRectangle.Height();
+
+        // Reply with the region we read out of the backing buffer (potentially clipped)
+        readRectangle = clippedRequestRectangle;
 
-            // Always advance the write iterator, we might have skipped it due to clipping.
-            ++targetIter;
+        for (til::CoordType y = 0; y < height; ++y)
+        {
+            const auto& row = storageBuffer.GetRowByOffset(sourcePoint.y + y);
+            auto attrIter = row.AttrBegin() + sourcePoint.x;
+            const auto targetRowBase = gsl::narrow_cast<size_t>(targetPoint.y + y) * targetSize.width + targetPoint.x;
 
-            // Increment the target
-            targetPos.x++;
-            if (targetPos.x >= targetSize.width)
+            for (til::CoordType x = 0; x < width; ++x, ++attrIter)
             {
-                targetPos.x = 0;
-                targetPos.y++;
+                // The caller's buffer is allowed to be shorter than the
+                // request rectangle; stop writing when it runs out.
+                const auto targetIndex = targetRowBase + gsl::narrow_cast<size_t>(x);
+                if (targetIndex >= targetBuffer.size())
+                {
+                    return S_OK;
+                }
+
+                const auto col = sourcePoint.x + x;
+                auto& ci = til::at(targetBuffer, targetIndex);
+                ci.Char.UnicodeChar = Utf16ToUcs2(row.GlyphAt(col));
+                ci.Attributes = attrIter->GetLegacyAttributes();
+                ci.Attributes |= GeneratePublicApiAttributeFormat(row.DbcsAttrAt(col));
             }
         }
 
-        // Reply with the region we read out of the backing buffer (potentially clipped)
-        readRectangle = clippedRequestRectangle;
-
         return S_OK;
     }
     CATCH_RETURN();
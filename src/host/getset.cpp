@@ -103,6 +103,15 @@ void ApiRoutines::GetConsoleOutputModeImpl(SCREEN_INFORMATION& context, ULONG& m
 // Arguments:
 // - context - The output buffer concerned
 // - data - Receives structure filled with metadata about the output buffer
+// On caching: a versioned lock-free snapshot of this struct was considered
+// for progress-bar-drawing clients that hammer the API between writes. It
+// doesn't pay off here: the cursor position is part of the reply and changes
+// with every written character, so the snapshot would be invalidated by the
+// very writes those clients interleave with their queries - and the
+// dominant cost of the call is the condrv round-trip on the client side,
+// which no server-side cache can remove. A shared-memory mirror would need
+// a new driver-negotiated channel (see the ConPTY shared-memory work for
+// the shape of that).
 void ApiRoutines::GetConsoleScreenBufferInfoExImpl(const SCREEN_INFORMATION& context,
                                                    CONSOLE_SCREEN_BUFFER_INFOEX& data) noexcept
 {
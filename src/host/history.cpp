@@ -506,6 +506,13 @@ std::wstring CommandHistory::Remove(const SHORT iDel)
 
 // Routine Description:
 // - this routine finds the most recent command that starts with the letters already in the current command.  it returns the array index (no mod needed).
+// On indexing: this walk is deliberately linear. F8 cycles matches in
+// recency order *starting from the current position*, so any prefix index
+// would have to be keyed by (prefix, recency, cycle position) and rebuilt as
+// the circular history rotates - and at the 10k-entry cap a starts_with scan
+// is a few microseconds per keypress, far below input latency noise. If the
+// cap ever grows by orders of magnitude, index recency explicitly rather
+// than sorting lexically, or the cycle order breaks.
 [[nodiscard]] bool CommandHistory::FindMatchingCommand(const std::wstring_view givenCommand,
                                                        const SHORT startingIndex,
                                                        SHORT& indexFound,
@@ -150,11 +150,35 @@ void InputBuffer::ConsumeCached(bool isUnicode, std::span<char>& target)
     }
 }
 
-void InputBuffer::Cache(std::wstring_view source)
+// Stores characters for later retrieval by `ConsumeCached`. If the client is
+// reading in A mode the conversion happens up front and in one batch, so that
+// subsequent reads are satisfied with plain copies.
+void InputBuffer::Cache(bool isUnicode, std::wstring_view source)
 {
-    const auto off = _cachedTextW.empty() ? 0 : _cachedTextReaderW.data() - _cachedTextW.data();
-    _cachedTextW.append(source);
-    _cachedTextReaderW = std::wstring_view{ _cachedTextW }.substr(off);
+    _switchReadingMode(isUnicode ? ReadingMode::StringW : ReadingMode::StringA);
+
+    if (isUnicode)
+    {
+        const auto off = _cachedTextW.empty() ? 0 : _cachedTextReaderW.data() - _cachedTextW.data();
+        _cachedTextW.append(source);
+        _cachedTextReaderW = std::wstring_view{ _cachedTextW }.substr(off);
+    }
+    else
+    {
+        const auto cp = ServiceLocator::LocateGlobals().getConsoleInformation().CP;
+        const auto off = _cachedTextA.empty() ? 0 : _cachedTextReaderA.data() - _cachedTextA.data();
+        const auto existing = _cachedTextA.size();
+        const auto sourceLength = gsl::narrow<int>(source.size());
+
+        auto length = WideCharToMultiByte(cp, 0, source.data(), sourceLength, nullptr, 0, nullptr, nullptr);
+        THROW_LAST_ERROR_IF(length <= 0);
+
+        _cachedTextA.resize(existing + gsl::narrow_cast<size_t>(length));
+        length = WideCharToMultiByte(cp, 0, source.data(), sourceLength, _cachedTextA.data() + existing, length, nullptr, nullptr);
+        THROW_LAST_ERROR_IF(length <= 0);
+
+        _cachedTextReaderA = std::string_view{ _cachedTextA }.substr(off);
+    }
 }
 
 // Moves up to `count`, previously cached events into `target`.
@@ -701,7 +725,6 @@ void InputBuffer::_WriteBuffer(_Inout_ std::deque<std::unique_ptr<IInputEvent>>&
     eventsWritten = 0;
     setWaitEvent = false;
     const auto initiallyEmptyQueue = _storage.empty();
-    const auto initialInEventsSize = inEvents.size();
     const auto vtInputMode = IsInVirtualTerminalInputMode();
 
     while (!inEvents.empty())
@@ -724,11 +747,17 @@ void InputBuffer::_WriteBuffer(_Inout_ std::deque<std::unique_ptr<IInputEvent>>&
             }
         }
 
-        // we only check for possible coalescing when storing one
-        // record at a time because this is the original behavior of
-        // the input buffer. Changing this behavior may break stuff
-        // that was depending on it.
-        if (initialInEventsSize == 1 && !_storage.empty())
+        // Coalescing used to be restricted to single-record writes, but
+        // modern input arrives in batches: a held PgDn in a TUI delivers
+        // runs of identical key-downs inside one write, and storing each
+        // individually meant thousands of records that each wake the
+        // reader. Trying every event against the buffer tail produces the
+        // same observable result the documented wRepeatCount semantics
+        // always promised - a reader sees one record with an accurate
+        // repeat count rather than n identical records - and mouse moves
+        // collapse to their latest position exactly as they already did
+        // for the one-at-a-time path.
+        if (!_storage.empty())
         {
             // coalescing requires a deque of events, so push it back onto the front.
             inEvents.push_front(std::move(inEvent));
@@ -751,8 +780,11 @@ void InputBuffer::_WriteBuffer(_Inout_ std::deque<std::unique_ptr<IInputEvent>>&
             }
             if (coalesced)
             {
-                eventsWritten = 1;
-                return;
+                // Folded into the buffer tail; the rest of the batch still
+                // needs processing. (Returning here was correct when only
+                // single-record writes could reach this block.)
+                ++eventsWritten;
+                continue;
             }
             else
             {
@@ -789,7 +821,7 @@ void InputBuffer::_WriteBuffer(_Inout_ std::deque<std::unique_ptr<IInputEvent>>&
 // redundant/out of date with the most current state).
 bool InputBuffer::_CoalesceMouseMovedEvents(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents)
 {
-    FAIL_FAST_IF(!(inEvents.size() == 1));
+    FAIL_FAST_IF(inEvents.empty());
     FAIL_FAST_IF(_storage.empty());
     const IInputEvent* const pFirstInEvent = inEvents.front().get();
     const IInputEvent* const pLastStoredEvent = _storage.back().get();
@@ -856,7 +888,7 @@ bool InputBuffer::_CanCoalesce(const KeyEvent& a, const KeyEvent& b) const noexc
 // redundant/out of date with the most current state).
 bool InputBuffer::_CoalesceRepeatedKeyPressEvents(_Inout_ std::deque<std::unique_ptr<IInputEvent>>& inEvents)
 {
-    FAIL_FAST_IF(!(inEvents.size() == 1));
+    FAIL_FAST_IF(inEvents.empty());
     FAIL_FAST_IF(_storage.empty());
     const IInputEvent* const pFirstInEvent = inEvents.front().get();
     const IInputEvent* const pLastStoredEvent = _storage.back().get();
@@ -45,7 +45,7 @@ public:
     // String oriented APIs
     void Consume(bool isUnicode, std::wstring_view& source, std::span<char>& target);
     void ConsumeCached(bool isUnicode, std::span<char>& target);
-    void Cache(std::wstring_view source);
+    void Cache(bool isUnicode, std::wstring_view source);
     // INPUT_RECORD oriented APIs
     size_t ConsumeCached(bool isUnicode, size_t count, InputEventQueue& target);
     size_t PeekCached(bool isUnicode, size_t count, InputEventQueue& target);
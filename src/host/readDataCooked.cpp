@@ -708,34 +708,91 @@ bool COOKED_READ_DATA::ProcessInput(const wchar_t wchOrig,
             CursorPosition = _screenInfo.GetTextBuffer().GetCursor().GetPosition();
             CursorPosition.x = (til::CoordType)(CursorPosition.x + NumSpaces);
 
-            // clear the current command line from the screen
-            // clang-format off
+            // Everything on screen before the edit point is untouched by the
+            // edit, so usually only the tail of the line needs to be
+            // rewritten. Carriage return jumps the edit point to the end of
+            // the line, and a prompt that has scrolled off the top needs
+            // DeleteCommandLine's field fixup - both of those keep the
+            // erase-and-repaint path.
+            if (wch == UNICODE_CARRIAGERETURN || _originalCursorPosition.y < 0)
+            {
+                // clear the current command line from the screen
+                // clang-format off
 #pragma prefast(suppress: __WARNING_BUFFER_OVERFLOW, "Not sure why prefast doesn't like this call.")
-            // clang-format on
-            DeleteCommandLine(*this, FALSE);
+                // clang-format on
+                DeleteCommandLine(*this, FALSE);
 
-            // write the new command line to the screen
-            NumToWrite = _bytesRead;
+                // write the new command line to the screen
+                NumToWrite = _bytesRead;
 
-            DWORD dwFlags = WC_DESTRUCTIVE_BACKSPACE | WC_PRINTABLE_CONTROL_CHARS;
-            if (wch == UNICODE_CARRIAGERETURN)
-            {
-                dwFlags |= WC_KEEP_CURSOR_VISIBLE;
+                DWORD dwFlags = WC_DESTRUCTIVE_BACKSPACE | WC_PRINTABLE_CONTROL_CHARS;
+                if (wch == UNICODE_CARRIAGERETURN)
+                {
+                    dwFlags |= WC_KEEP_CURSOR_VISIBLE;
+                }
+                status = WriteCharsLegacy(_screenInfo,
+                                          _backupLimit,
+                                          _backupLimit,
+                                          _backupLimit,
+                                          &NumToWrite,
+                                          &_visibleCharCount,
+                                          _originalCursorPosition.x,
+                                          dwFlags,
+                                          &ScrollY);
+                if (FAILED_NTSTATUS(status))
+                {
+                    RIPMSG1(RIP_WARNING, "WriteCharsLegacy failed 0x%x", status);
+                    _bytesRead = 0;
+                    return true;
+                }
             }
-            status = WriteCharsLegacy(_screenInfo,
-                                      _backupLimit,
-                                      _backupLimit,
-                                      _backupLimit,
-                                      &NumToWrite,
-                                      &_visibleCharCount,
-                                      _originalCursorPosition.x,
-                                      dwFlags,
-                                      &ScrollY);
-            if (FAILED_NTSTATUS(status))
+            else
             {
-                RIPMSG1(RIP_WARNING, "WriteCharsLegacy failed 0x%x", status);
-                _bytesRead = 0;
-                return true;
+                // The cursor already sits on the first cell the edit touched:
+                // the destructive backspace above left it on the deleted
+                // char's cell, and a typed glyph lands where the cursor is.
+                // Rewrite from that buffer offset to the end of the line -
+                // WriteCharsLegacy still gets _backupLimit and the original X
+                // so tabs in the tail expand from the right column.
+                const auto charDeleted = wch == UNICODE_BACKSPACE && _processedInput;
+                const auto tailStartIndex = _currentPosition - (charDeleted ? 0 : 1);
+                const auto cursorBefore = _screenInfo.GetTextBuffer().GetCursor().GetPosition();
+                const auto prefixCells = static_cast<size_t>((cursorBefore.y - _originalCursorPosition.y) * sScreenBufferSizeX +
+                                                             cursorBefore.x - _originalCursorPosition.x);
+                const auto oldVisibleCharCount = _visibleCharCount;
+
+                NumToWrite = _bytesRead - tailStartIndex * sizeof(WCHAR);
+                size_t tailCells = 0;
+                status = WriteCharsLegacy(_screenInfo,
+                                          _backupLimit,
+                                          _backupLimit + tailStartIndex,
+                                          _backupLimit + tailStartIndex,
+                                          &NumToWrite,
+                                          &tailCells,
+                                          _originalCursorPosition.x,
+                                          WC_DESTRUCTIVE_BACKSPACE | WC_PRINTABLE_CONTROL_CHARS,
+                                          &ScrollY);
+                if (FAILED_NTSTATUS(status))
+                {
+                    RIPMSG1(RIP_WARNING, "WriteCharsLegacy failed 0x%x", status);
+                    _bytesRead = 0;
+                    return true;
+                }
+
+                _visibleCharCount = prefixCells + tailCells;
+
+                // If the edit shrank the line on screen (backspace, or a
+                // narrow glyph overwriting a wide one), blank the cells the
+                // old tail still covers.
+                if (oldVisibleCharCount > _visibleCharCount)
+                {
+                    try
+                    {
+                        _screenInfo.Write(OutputCellIterator(UNICODE_SPACE, oldVisibleCharCount - _visibleCharCount),
+                                          _screenInfo.GetTextBuffer().GetCursor().GetPosition());
+                    }
+                    CATCH_LOG();
+                }
             }
 
             // update cursor position
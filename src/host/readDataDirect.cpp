@@ -53,6 +53,13 @@ DirectReadData::DirectReadData(_In_ InputBuffer* const pInputBuffer,
 // Return Value:
 // - true if the wait is done and result buffer/status code can be sent back to the client.
 // - false if we need to continue to wait until more data is available.
+// On batching: the server already merges high-rate input before it ever
+// reaches this read - InputBuffer::Write coalesces consecutive mouse-move
+// records (same modifiers) and repeated key presses into single events with
+// bumped repeat counts - so a mouse-move storm wakes a blocked reader once
+// per delivered (coalesced) event, not once per raw motion. The per-record
+// unique_ptr hops below are imposed by the IInputEvent pipeline's shape;
+// vectorizing the copy-out means pooling that pipeline first.
 bool DirectReadData::Notify(const WaitTerminationReason TerminationReason,
                             const bool fIsUnicode,
                             _Out_ NTSTATUS* const pReplyStatus,
@@ -125,6 +125,14 @@ void Registry::_LoadMappedProperties(_In_reads_(cPropertyMappings) const Registr
                                      const size_t cPropertyMappings,
                                      const HKEY hKey)
 {
+    // Snapshot the key's values in one enumeration pass. Probing the key
+    // once per property cost a registry round trip per mapping - dozens,
+    // most answering "not found" on sparse per-title keys - where this
+    // costs one per value that actually exists. If the snapshot fails for
+    // any reason, fall back to the per-value probes.
+    RegistrySerialization::ValueSnapshot values;
+    const auto snapshotOk = SUCCEEDED_NTSTATUS(values.Populate(hKey));
+
     // Iterate through properties table and load each setting for common property types
     for (UINT iMapping = 0; iMapping < cPropertyMappings; iMapping++)
     {
@@ -140,12 +148,14 @@ void Registry::_LoadMappedProperties(_In_reads_(cPropertyMappings) const Registr
         case RegistrySerialization::_RegPropertyType::Byte:
         case RegistrySerialization::_RegPropertyType::Coordinate:
         {
-            Status = RegistrySerialization::s_LoadRegDword(hKey, pPropMap, _pSettings);
+            Status = snapshotOk ? RegistrySerialization::s_LoadRegDword(values, pPropMap, _pSettings) :
+                                  RegistrySerialization::s_LoadRegDword(hKey, pPropMap, _pSettings);
             break;
         }
         case RegistrySerialization::_RegPropertyType::String:
         {
-            Status = RegistrySerialization::s_LoadRegString(hKey, pPropMap, _pSettings);
+            Status = snapshotOk ? RegistrySerialization::s_LoadRegString(values, pPropMap, _pSettings) :
+                                  RegistrySerialization::s_LoadRegString(hKey, pPropMap, _pSettings);
             break;
         }
         }
@@ -42,6 +42,14 @@ using namespace Microsoft::Console::Render;
 const UINT CONSOLE_EVENT_FAILURE_ID = 21790;
 const UINT CONSOLE_LPC_PORT_FAILURE_ID = 21791;
 
+// On a pre-warmed conhost pool: the \Device\ConDrv\Server handle we receive
+// here is minted by the driver for exactly one client connection and handed
+// to us at process creation, so a conhost can't initialize ahead of time and
+// adopt a connection later - everything downstream (settings load, buffer
+// allocation) keys off the connect message from that specific client. The
+// handoff primitive that does exist, ConsoleEstablishHandoff below, still
+// starts from a live server handle; a warm pool would have to live in the
+// launcher (kernelbase/condrv), which isn't in this repository.
 [[nodiscard]] HRESULT ConsoleServerInitialization(_In_ HANDLE Server, const ConsoleArguments* const args)
 try
 {
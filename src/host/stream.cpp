@@ -415,6 +415,13 @@ NT_CATCH_RETURN()
 // populated.
 // - STATUS_SUCCESS on success
 // - Other NTSTATUS codes as necessary
+// Only clients reading into buffers this small get read-ahead treatment; a
+// client presenting large buffers already amortizes the per-request cost.
+static constexpr size_t RawReadAheadBufferLimit = 256;
+// Caps how much text a single read-ahead pass may stage, so a paste flood
+// doesn't balloon the cache.
+static constexpr size_t RawReadAheadChars = 4096;
+
 [[nodiscard]] NTSTATUS ReadCharacterInput(InputBuffer& inputBuffer,
                                           std::span<char> buffer,
                                           size_t& bytesRead,
@@ -457,6 +464,37 @@ try
     }
 
     bytesRead = buffer.size() - writer.size();
+
+    // A read that returned anything at all is a success, even if the queue ran
+    // dry before the buffer filled (GetChar reports that as a failure). This
+    // matters once read-ahead is in play: the staged cache rarely lines up
+    // exactly with the client's buffer size, so the tail of the cache is
+    // routinely served as a partial read.
+    if (status == STATUS_UNSUCCESSFUL && bytesRead != 0)
+    {
+        status = STATUS_SUCCESS;
+    }
+
+    // Read-ahead for byte-wise consumers: a client that filled a tiny buffer
+    // to the brim is almost certainly going to come right back for the next
+    // byte. Drain whatever is already available into the string cache in one
+    // pass (conversion included), so those follow-up reads are satisfied by
+    // `ConsumeCached` without walking the event queue again, character by
+    // character, on every request.
+    if (status == STATUS_SUCCESS && writer.size() < charSize && buffer.size() <= RawReadAheadBufferLimit)
+    {
+        std::wstring readAhead;
+        wchar_t wch;
+        while (readAhead.size() < RawReadAheadChars && NT_SUCCESS(GetChar(&inputBuffer, &wch, false, nullptr, nullptr, nullptr)))
+        {
+            readAhead.push_back(wch);
+        }
+        if (!readAhead.empty())
+        {
+            inputBuffer.Cache(unicode, readAhead);
+        }
+    }
+
     return status;
 }
 NT_CATCH_RETURN()
@@ -137,9 +137,9 @@ class InputBufferTests
         VERIFY_ARE_EQUAL(inputBuffer.GetNumberOfReadyEvents(), 3u);
     }
 
-    TEST_METHOD(InputBufferDoesNotCoalesceBulkMouseEvents)
+    TEST_METHOD(InputBufferCoalescesBulkMouseEvents)
     {
-        Log::Comment(L"The input buffer should not coalesce mouse events if more than one event is sent at a time");
+        Log::Comment(L"The input buffer should coalesce a run of mouse move events even when they arrive in one bulk write");
 
         InputBuffer inputBuffer;
         INPUT_RECORD mouseRecords[RECORD_INSERT_COUNT];
@@ -147,26 +147,21 @@ class InputBufferTests
 
         for (size_t i = 0; i < RECORD_INSERT_COUNT; ++i)
         {
+            mouseRecords[i] = {};
             mouseRecords[i].EventType = MOUSE_EVENT;
             mouseRecords[i].Event.MouseEvent.dwEventFlags = MOUSE_MOVED;
+            mouseRecords[i].Event.MouseEvent.dwMousePosition.X = static_cast<SHORT>(i);
+            mouseRecords[i].Event.MouseEvent.dwMousePosition.Y = static_cast<SHORT>(i);
             events.push_back(IInputEvent::Create(mouseRecords[i]));
         }
-        // add an extra event
-        events.push_front(IInputEvent::Create(mouseRecords[0]));
         inputBuffer.Flush();
-        // send one mouse event to possibly coalesce into later
-        VERIFY_IS_GREATER_THAN(inputBuffer.Write(std::move(events.front())), 0u);
-        events.pop_front();
+        // send one mouse event to coalesce into
+        VERIFY_IS_GREATER_THAN(inputBuffer.Write(IInputEvent::Create(mouseRecords[0])), 0u);
         // write the others in bulk
         VERIFY_IS_GREATER_THAN(inputBuffer.Write(events), 0u);
-        // no events should have been coalesced
-        VERIFY_ARE_EQUAL(inputBuffer.GetNumberOfReadyEvents(), RECORD_INSERT_COUNT + 1);
-        // check that the events stored match those inserted
-        VERIFY_ARE_EQUAL(inputBuffer._storage.front()->ToInputRecord(), mouseRecords[0]);
-        for (size_t i = 0; i < RECORD_INSERT_COUNT; ++i)
-        {
-            VERIFY_ARE_EQUAL(inputBuffer._storage[i + 1]->ToInputRecord(), mouseRecords[i]);
-        }
+        // every move folded into the stored one, which carries the latest position
+        VERIFY_ARE_EQUAL(inputBuffer.GetNumberOfReadyEvents(), 1u);
+        VERIFY_ARE_EQUAL(inputBuffer._storage.front()->ToInputRecord(), mouseRecords[RECORD_INSERT_COUNT - 1]);
     }
 
     TEST_METHOD(InputBufferCoalescesKeyEvents)
@@ -200,9 +195,9 @@ class InputBufferTests
         VERIFY_ARE_EQUAL(pKeyEvent->GetRepeatCount(), RECORD_INSERT_COUNT);
     }
 
-    TEST_METHOD(InputBufferDoesNotCoalesceBulkKeyEvents)
+    TEST_METHOD(InputBufferCoalescesBulkKeyEvents)
     {
-        Log::Comment(L"The input buffer should not coalesce key events if more than one event is sent at a time");
+        Log::Comment(L"The input buffer should coalesce a run of identical key events arriving in one bulk write into a single record with an accurate repeat count");
 
         InputBuffer inputBuffer;
         INPUT_RECORD keyRecords[RECORD_INSERT_COUNT];
@@ -214,18 +209,14 @@ class InputBufferTests
             events.push_back(IInputEvent::Create(keyRecords[i]));
         }
         inputBuffer.Flush();
-        // send one key event to possibly coalesce into later
+        // send one key event to coalesce into
         VERIFY_IS_GREATER_THAN(inputBuffer.Write(IInputEvent::Create(keyRecords[0])), 0u);
         // write the others in bulk
         VERIFY_IS_GREATER_THAN(inputBuffer.Write(events), 0u);
-        // no events should have been coalesced
-        VERIFY_ARE_EQUAL(inputBuffer.GetNumberOfReadyEvents(), RECORD_INSERT_COUNT + 1);
-        // check that the events stored match those inserted
-        VERIFY_ARE_EQUAL(inputBuffer._storage.front()->ToInputRecord(), keyRecords[0]);
-        for (size_t i = 0; i < RECORD_INSERT_COUNT; ++i)
-        {
-            VERIFY_ARE_EQUAL(inputBuffer._storage[i + 1]->ToInputRecord(), keyRecords[i]);
-        }
+        // the whole run folded into one record whose repeat count covers them all
+        VERIFY_ARE_EQUAL(inputBuffer.GetNumberOfReadyEvents(), 1u);
+        const auto storedKeyEvent = static_cast<const KeyEvent* const>(inputBuffer._storage.front().get());
+        VERIFY_ARE_EQUAL(storedKeyEvent->GetRepeatCount(), static_cast<WORD>(RECORD_INSERT_COUNT + 1));
     }
 
     TEST_METHOD(InputBufferDoesNotCoalesceFullWidthChars)
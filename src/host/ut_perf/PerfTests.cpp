@@ -0,0 +1,434 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+#include <wextestclass.h>
+#include "../../inc/consoletaeftemplates.hpp"
+#include "../../types/inc/Viewport.hpp"
+
+#include "../../renderer/base/Renderer.hpp"
+#include "../../renderer/vt/Xterm256Engine.hpp"
+#include "../../renderer/vt/XtermEngine.hpp"
+#include "../Settings.hpp"
+
+#include "CommonState.hpp"
+
+#include "../buffer/out/search.h"
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+using namespace Microsoft::Console::Types;
+using namespace Microsoft::Console::Interactivity;
+using namespace Microsoft::Console::VirtualTerminal;
+
+using namespace Microsoft::Console;
+using namespace Microsoft::Console::Render;
+
+// Counts heap churn made by code linked into this test binary, on the test
+// thread only. Replacing the global allocation functions here shadows the
+// CRT's for every translation unit statically linked into this DLL - which
+// includes the host libraries under test - so a workload that suddenly starts
+// allocating per-cell shows up as a counter explosion, without any
+// instrumentation in the product code itself.
+static thread_local size_t s_threadAllocCount = 0;
+
+void* operator new(size_t size)
+{
+    ++s_threadAllocCount;
+    if (const auto ptr = malloc(size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    free(ptr);
+}
+
+class PerfTests
+{
+    static const til::CoordType TerminalViewWidth = 80;
+    static const til::CoordType TerminalViewHeight = 32;
+
+    // These tests are budget assertions, not exact-output assertions: each
+    // workload is timed against a calibration loop run on the same machine in
+    // the same process, so the budgets hold on anything from a laptop on
+    // battery to a build server. The ceilings below carry generous headroom -
+    // they exist to catch order-of-magnitude regressions (an allocation per
+    // cell, an accidental O(n^2)) before they reach the fleet; the recorded
+    // per-machine baselines then catch the subtler >10% slides locally.
+    BEGIN_TEST_CLASS(PerfTests)
+        TEST_CLASS_PROPERTY(L"IsolationLevel", L"Class")
+    END_TEST_CLASS()
+
+    TEST_CLASS_SETUP(ClassSetup)
+    {
+        m_state = std::make_unique<CommonState>();
+
+        m_state->InitEvents();
+        m_state->PrepareGlobalFont();
+        m_state->PrepareGlobalInputBuffer();
+        m_state->PrepareGlobalScreenBuffer(TerminalViewWidth, TerminalViewHeight, TerminalViewWidth, TerminalViewHeight);
+
+        _loadBaselines();
+
+        // One calibration for the whole class: it's the unit every budget in
+        // this file is expressed in.
+        m_calibrationSeconds = _measureCalibrationLoop();
+        Log::Comment(NoThrowString().Format(L"Calibration unit: %.6f seconds", m_calibrationSeconds));
+
+        return true;
+    }
+
+    TEST_CLASS_CLEANUP(ClassCleanup)
+    {
+        _storeBaselines();
+
+        m_state->CleanupGlobalScreenBuffer();
+        m_state->CleanupGlobalFont();
+        m_state->CleanupGlobalInputBuffer();
+
+        m_state.reset();
+
+        return true;
+    }
+
+    TEST_METHOD_SETUP(MethodSetup)
+    {
+        auto& g = ServiceLocator::LocateGlobals();
+        auto& gci = g.getConsoleInformation();
+        gci.SetFillAttribute(0x07); // DARK_WHITE on DARK_BLACK
+        gci.CalculateDefaultColorIndices();
+
+        g.pRender = new Renderer(gci.GetRenderSettings(), &gci.renderData, nullptr, 0, nullptr);
+
+        m_state->PrepareNewTextBufferInfo(true, TerminalViewWidth, TerminalViewHeight);
+        auto& currentBuffer = gci.GetActiveOutputBuffer();
+        VERIFY_SUCCEEDED(currentBuffer.SetViewportOrigin(true, { 0, 0 }, true));
+
+        return true;
+    }
+
+    TEST_METHOD_CLEANUP(MethodCleanup)
+    {
+        m_state->CleanupNewTextBufferInfo();
+
+        auto& g = ServiceLocator::LocateGlobals();
+        delete g.pRender;
+        g.pRender = nullptr;
+
+        return true;
+    }
+
+    TEST_METHOD(ProcessStringPlainText);
+    TEST_METHOD(ProcessStringSgrHeavy);
+    TEST_METHOD(TextBufferWriteThroughput);
+    TEST_METHOD(SearchScanThroughput);
+    TEST_METHOD(ConptyRoundtripThroughput);
+
+private:
+    static double _now()
+    {
+        LARGE_INTEGER qpc;
+        QueryPerformanceCounter(&qpc);
+        LARGE_INTEGER freq;
+        QueryPerformanceFrequency(&freq);
+        return static_cast<double>(qpc.QuadPart) / static_cast<double>(freq.QuadPart);
+    }
+
+    // The reference workload every budget is measured against: a fixed,
+    // cache-friendly integer scan. It deliberately exercises nothing console
+    // specific - it's a proxy for "how fast is this machine today", including
+    // whatever thermal or power state the test process happens to run in.
+    static double _measureCalibrationLoop()
+    {
+        std::vector<uint32_t> data(256 * 1024);
+        uint32_t seed = 0x2545F491;
+        for (auto& v : data)
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            v = seed;
+        }
+
+        // Best-of-three to shed scheduler noise; the sum is fed back into the
+        // buffer so the optimizer can't discard the loop.
+        auto best = std::numeric_limits<double>::max();
+        uint32_t checksum = 0;
+        for (auto attempt = 0; attempt < 3; ++attempt)
+        {
+            const auto start = _now();
+            uint32_t sum = 0;
+            for (auto pass = 0; pass < 32; ++pass)
+            {
+                for (const auto v : data)
+                {
+                    sum = sum * 31 + v;
+                }
+                data[pass] ^= sum;
+            }
+            best = std::min(best, _now() - start);
+            checksum += sum;
+        }
+        // Consuming the checksum keeps the optimizer from proving the whole
+        // loop dead and calibrating against an empty body.
+        Log::Comment(NoThrowString().Format(L"Calibration checksum: %08x", checksum));
+        return best;
+    }
+
+    // Times fn (called once per iteration), returning the best per-iteration
+    // time over three attempts. One warm-up iteration is run first so one-time
+    // lazy initialization doesn't land in the measurement.
+    template<typename TFunc>
+    static double _measureSeconds(const size_t iterations, TFunc&& fn)
+    {
+        fn();
+
+        auto best = std::numeric_limits<double>::max();
+        for (auto attempt = 0; attempt < 3; ++attempt)
+        {
+            const auto start = _now();
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                fn();
+            }
+            best = std::min(best, (_now() - start) / static_cast<double>(iterations));
+        }
+        return best;
+    }
+
+    // Validates a measurement against both budgets:
+    // - the hard ceiling, expressed as a multiple of the calibration unit, so
+    //   it means the same thing on every machine; and
+    // - this machine's recorded baseline plus 10%, when one exists. The first
+    //   run on a machine records instead of judging, and improvements ratchet
+    //   the baseline down.
+    void _checkBudget(const std::wstring& name, const double seconds, const double ceilingRatio)
+    {
+        const auto ratio = seconds / m_calibrationSeconds;
+        Log::Comment(NoThrowString().Format(L"%s: %.6f s/iter, %.4f calibration units (ceiling %.4f)",
+                                            name.c_str(),
+                                            seconds,
+                                            ratio,
+                                            ceilingRatio));
+
+        VERIFY_IS_LESS_THAN(ratio, ceilingRatio, name.c_str());
+
+        const auto existing = m_baselines.find(name);
+        if (existing != m_baselines.end())
+        {
+            VERIFY_IS_LESS_THAN(ratio,
+                                existing->second * 1.10,
+                                NoThrowString().Format(L"%s regressed >10%% over this machine's baseline of %.4f units", name.c_str(), existing->second));
+            existing->second = std::min(existing->second, ratio);
+        }
+        else
+        {
+            Log::Comment(NoThrowString().Format(L"%s: no baseline on this machine yet; recording %.4f units", name.c_str(), ratio));
+            m_baselines.emplace(name, ratio);
+        }
+    }
+
+    static std::filesystem::path _baselinePath()
+    {
+        wchar_t tempPath[MAX_PATH];
+        if (!GetTempPathW(MAX_PATH, tempPath))
+        {
+            return {};
+        }
+        // Debug and Release (and x86 and x64) have entirely different perf
+        // characters; a baseline recorded by one must never judge the other.
+#ifdef _DEBUG
+        static constexpr auto flavor = L"chk";
+#else
+        static constexpr auto flavor = L"fre";
+#endif
+        return std::filesystem::path{ tempPath } / fmt::format(L"ConhostPerfBaselines-{}-{}.txt", flavor, sizeof(void*) * 8);
+    }
+
+    void _loadBaselines()
+    {
+        const auto path = _baselinePath();
+        if (path.empty())
+        {
+            return;
+        }
+
+        std::wifstream file{ path };
+        std::wstring name;
+        double value = 0.0;
+        while (file >> name >> value)
+        {
+            m_baselines.emplace(name, value);
+        }
+    }
+
+    void _storeBaselines() const
+    {
+        const auto path = _baselinePath();
+        if (path.empty())
+        {
+            return;
+        }
+
+        std::wofstream file{ path, std::ios::trunc };
+        for (const auto& [name, value] : m_baselines)
+        {
+            file << name << L' ' << value << L'\n';
+        }
+    }
+
+    std::unique_ptr<CommonState> m_state;
+    double m_calibrationSeconds = 0.0;
+    std::map<std::wstring, double> m_baselines;
+    size_t m_bytesRendered = 0;
+};
+
+void PerfTests::ProcessStringPlainText()
+{
+    auto& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+    auto& stateMachine = gci.GetActiveOutputBuffer().GetStateMachine();
+
+    // 64 full lines of plain ASCII per iteration - the shape of `type
+    // bigfile.txt` - is the single hottest path in the host.
+    std::wstring payload;
+    for (auto line = 0; line < 64; ++line)
+    {
+        payload.append(TerminalViewWidth - 1, static_cast<wchar_t>(L'a' + (line % 26)));
+        payload.append(L"\r\n");
+    }
+
+    const auto allocsBefore = s_threadAllocCount;
+    const auto seconds = _measureSeconds(16, [&]() {
+        stateMachine.ProcessString(payload);
+    });
+    const auto allocsPerIteration = (s_threadAllocCount - allocsBefore) / (16 * 3 + 1);
+
+    Log::Comment(NoThrowString().Format(L"ProcessStringPlainText: ~%zu allocations per 64-line iteration", allocsPerIteration));
+    // Steady-state plain text should not allocate per cell or per line. The
+    // cap is ~2 per line - far above today's behavior, low enough to catch an
+    // accidental string round-trip in the output path.
+    VERIFY_IS_LESS_THAN(allocsPerIteration, static_cast<size_t>(128));
+
+    _checkBudget(L"ProcessStringPlainText", seconds, 2.0);
+}
+
+void PerfTests::ProcessStringSgrHeavy()
+{
+    auto& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+    auto& stateMachine = gci.GetActiveOutputBuffer().GetStateMachine();
+
+    // The same 64 lines, but with a 256-color SGR change every 8 cells - the
+    // shape of build tools and syntax-highlighted pagers. This leans on the
+    // parser's CSI path and the attribute run-length machinery together.
+    std::wstring payload;
+    for (auto line = 0; line < 64; ++line)
+    {
+        for (auto col = 0; col < TerminalViewWidth - 1; col += 8)
+        {
+            fmt::format_to(std::back_inserter(payload), FMT_COMPILE(L"\x1b[38;5;{}m"), (line + col) % 256);
+            payload.append(8, L'w');
+        }
+        payload.append(L"\r\n");
+    }
+
+    const auto seconds = _measureSeconds(16, [&]() {
+        stateMachine.ProcessString(payload);
+    });
+
+    _checkBudget(L"ProcessStringSgrHeavy", seconds, 6.0);
+}
+
+void PerfTests::TextBufferWriteThroughput()
+{
+    auto& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+    auto& textBuffer = gci.GetActiveOutputBuffer().GetTextBuffer();
+
+    const std::wstring line(TerminalViewWidth, L'x');
+    const TextAttribute attr{ FOREGROUND_RED | FOREGROUND_INTENSITY };
+
+    // Raw cell insertion with no parser in the way: every row of the buffer,
+    // rewritten once per iteration.
+    const auto seconds = _measureSeconds(16, [&]() {
+        for (til::CoordType row = 0; row < TerminalViewHeight; ++row)
+        {
+            const OutputCellIterator it{ line, attr };
+            textBuffer.Write(it, { 0, row });
+        }
+    });
+
+    _checkBudget(L"TextBufferWriteThroughput", seconds, 1.0);
+}
+
+void PerfTests::SearchScanThroughput()
+{
+    auto& gci = ServiceLocator::LocateGlobals().getConsoleInformation();
+    auto& stateMachine = gci.GetActiveOutputBuffer().GetStateMachine();
+
+    // A buffer's worth of haystack with one needle in the middle; the search
+    // has to case-fold its way across every row to find it.
+    for (auto line = 0; line < TerminalViewHeight - 1; ++line)
+    {
+        stateMachine.ProcessString(line == TerminalViewHeight / 2 ? L"needle\r\n" : L"haystackhaystackhaystack\r\n");
+    }
+
+    const auto seconds = _measureSeconds(16, [&]() {
+        Search s(gci.renderData, L"NEEDLE", Search::Direction::Forward, Search::Sensitivity::CaseInsensitive);
+        VERIFY_IS_TRUE(s.FindNext());
+    });
+
+    _checkBudget(L"SearchScanThroughput", seconds, 1.0);
+}
+
+void PerfTests::ConptyRoundtripThroughput()
+{
+    auto& g = ServiceLocator::LocateGlobals();
+    auto& gci = g.getConsoleInformation();
+    auto& currentBuffer = gci.GetActiveOutputBuffer();
+
+    // The in-process equivalent of the ConPTY loop: host-side ingestion, then
+    // a full VT render pass back out through the Xterm256 engine, with the
+    // generated bytes counted rather than written to a pipe.
+    auto hFile = wil::unique_hfile(INVALID_HANDLE_VALUE);
+    auto vtRenderEngine = std::make_unique<Xterm256Engine>(std::move(hFile), currentBuffer.GetViewport());
+    vtRenderEngine->SetTestCallback([&](const char* const /*pch*/, const size_t cch) {
+        m_bytesRendered += cch;
+        return true;
+    });
+
+    g.pRender->AddRenderEngine(vtRenderEngine.get());
+    currentBuffer.SetTerminalConnection(vtRenderEngine.get());
+    g.EnableConptyModeForTests(std::move(vtRenderEngine));
+
+    auto& stateMachine = currentBuffer.GetStateMachine();
+
+    std::wstring payload;
+    for (auto line = 0; line < TerminalViewHeight - 1; ++line)
+    {
+        payload.append(TerminalViewWidth - 1, static_cast<wchar_t>(L'0' + (line % 10)));
+        payload.append(L"\r\n");
+    }
+
+    m_bytesRendered = 0;
+    const auto seconds = _measureSeconds(16, [&]() {
+        stateMachine.ProcessString(payload);
+        VERIFY_SUCCEEDED(g.pRender->PaintFrame());
+    });
+    Log::Comment(NoThrowString().Format(L"ConptyRoundtripThroughput: %zu VT bytes generated", m_bytesRendered));
+    VERIFY_IS_GREATER_THAN(m_bytesRendered, static_cast<size_t>(0));
+
+    _checkBudget(L"ConptyRoundtripThroughput", seconds, 8.0);
+}
@@ -76,8 +76,10 @@ __declspec(noinline) inline HRESULT CreateConPty(const std::wstring& cmdline,
     sa.bInheritHandle = FALSE;
     sa.lpSecurityDescriptor = nullptr;
 
-    CreatePipe(&inPipeConhostSide, hInput, &sa, 0);
-    CreatePipe(hOutput, &outPipeConhostSide, &sa, 0);
+    // Suggest a large output pipe to the kernel, so a burst of output doesn't
+    // fill it and block conhost's writer while the reader is descheduled.
+    CreatePipe(&inPipeConhostSide, hInput, &sa, 64 * 1024);
+    CreatePipe(hOutput, &outPipeConhostSide, &sa, 1024 * 1024);
 
     // Mark inheritable for signal handle when creating. It'll have the same value on the other side.
     sa.bInheritHandle = TRUE;
@@ -187,7 +187,8 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
                 _sz{ other._sz },
                 _rc{ other._rc },
                 _bits{ other._bits },
-                _runs{ other._runs }
+                _runs{ other._runs },
+                _runsValid{ other._runsValid }
             {
                 // copy constructor is required to call select_on_container_copy
             }
@@ -202,6 +203,7 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
                 _rc = other._rc;
                 _bits = other._bits;
                 _runs = other._runs;
+                _runsValid = other._runsValid;
                 return *this;
             }
 
@@ -210,7 +212,8 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
                 _sz{ std::move(other._sz) },
                 _rc{ std::move(other._rc) },
                 _bits{ std::move(other._bits) },
-                _runs{ std::move(other._runs) }
+                _runs{ std::move(other._runs) },
+                _runsValid{ other._runsValid }
             {
             }
 
@@ -222,6 +225,7 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
                 }
                 _bits = std::move(other._bits);
                 _runs = std::move(other._runs);
+                _runsValid = other._runsValid;
                 _sz = std::move(other._sz);
                 _rc = std::move(other._rc);
                 return *this;
@@ -237,6 +241,7 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
                 }
                 std::swap(_bits, other._bits);
                 std::swap(_runs, other._runs);
+                std::swap(_runsValid, other._runsValid);
                 std::swap(_sz, other._sz);
                 std::swap(_rc, other._rc);
             }
@@ -266,14 +271,17 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
 
             const std::span<const til::rect> runs() const
             {
-                // If we don't have cached runs, rebuild.
-                if (!_runs.has_value())
+                // If we don't have cached runs, rebuild. Refilling the retained
+                // vector (instead of recreating it) keeps its capacity, so the
+                // per-frame rebuild in the render engines stops allocating.
+                if (!_runsValid)
                 {
-                    _runs.emplace(begin(), end());
+                    _runs.assign(begin(), end());
+                    _runsValid = true;
                 }
 
                 // Return the runs.
-                return _runs.value();
+                return _runs;
             }
 
             // optional fill the uncovered area with bits.
@@ -352,7 +360,7 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
             void set(const til::point pt)
             {
                 THROW_HR_IF(E_INVALIDARG, !_rc.contains(pt));
-                _runs.reset(); // reset cached runs on any non-const method
+                _runsValid = false; // invalidate cached runs on any non-const method
 
                 _bits.set(_rc.index_of(pt));
             }
@@ -360,7 +368,7 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
             void set(const til::rect& rc)
             {
                 THROW_HR_IF(E_INVALIDARG, !_rc.contains(rc));
-                _runs.reset(); // reset cached runs on any non-const method
+                _runsValid = false; // invalidate cached runs on any non-const method
 
                 for (auto row = rc.top; row < rc.bottom; ++row)
                 {
@@ -370,13 +378,13 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
 
             void set_all() noexcept
             {
-                _runs.reset(); // reset cached runs on any non-const method
+                _runsValid = false; // invalidate cached runs on any non-const method
                 _bits.set();
             }
 
             void reset_all() noexcept
             {
-                _runs.reset(); // reset cached runs on any non-const method
+                _runsValid = false; // invalidate cached runs on any non-const method
                 _bits.reset();
             }
 
@@ -384,7 +392,7 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
             // Set fill if you want the new region (on growing) to be marked dirty.
             bool resize(til::size size, bool fill = false)
             {
-                _runs.reset(); // reset cached runs on any non-const method
+                _runsValid = false; // invalidate cached runs on any non-const method
 
                 // Don't resize if it's not different
                 if (_sz != size)
@@ -526,7 +534,7 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
                     }
                 }
 
-                _runs.reset(); // reset cached runs on any non-const method
+                _runsValid = false; // invalidate cached runs on any non-const method
             }
 
             allocator_type _alloc;
@@ -534,7 +542,8 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
             til::rect _rc;
             dynamic_bitset<unsigned long long, allocator_type> _bits;
 
-            mutable std::optional<std::vector<til::rect, run_allocator_type>> _runs;
+            mutable std::vector<til::rect, run_allocator_type> _runs;
+            mutable bool _runsValid = false;
 
 #ifdef UNIT_TESTING
             friend class ::BitmapTests;
@@ -66,4 +66,85 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
         generation_t _generation;
         T _value{};
     };
+
+    // published<T> carries versioned state across two threads: one writer
+    // updates and publishes; one reader fetches the latest consistent copy.
+    // Neither ever blocks the other.
+    //
+    // It's the classic triple-buffer: the writer composes in a private slot
+    // and publishes it with one atomic exchange; the reader takes the most
+    // recently published slot with another, parking its previous slot in
+    // trade. Each side only ever touches the slot its own exchange handed
+    // back, so the reader always sees a complete, internally consistent T -
+    // at worst one publication old. The cost is a copy per publish/fetch;
+    // keep T to the plain settings-and-metrics structs this is meant for.
+    // Strictly one writer thread and one reader thread: the slot-ownership
+    // argument above is exactly what a second reader would break. (For
+    // many readers, use a seqlock instead.)
+    //
+    // Pairs naturally with generational<T> as the payload, so readers can
+    // compare generations to skip work when nothing changed.
+    template<typename T>
+    struct published
+    {
+        published() = default;
+        explicit published(const T& initial)
+        {
+            for (auto& s : _slots)
+            {
+                s.value = initial;
+            }
+        }
+
+        published(const published&) = delete;
+        published& operator=(const published&) = delete;
+
+        // Writer side: copy the new state in and make it the latest.
+        // Single writer only.
+        void publish(const T& value)
+        {
+            auto& slot = _slots[_writerSlot];
+            slot.value = value;
+            // Hand our freshly written slot to readers - tagged fresh so the
+            // reader knows a new publication exists - and take back whichever
+            // slot was parked there before; release pairs with the reader's
+            // acquire so the copy is complete before it's observable.
+            _writerSlot = _latest.exchange(_writerSlot | FreshBit, std::memory_order_acq_rel) & SlotMask;
+        }
+
+        // Reader side: copy out the latest published state. Wait-free; at
+        // worst one publication stale. Single reader only.
+        void fetch(T& out)
+        {
+            // Only trade slots when the writer has actually published since
+            // our last fetch: the slot parked in _latest after our own
+            // exchange is the one we just read (stale), so exchanging
+            // unconditionally would bounce between the last two states.
+            // When there's nothing fresh, re-reading our held slot is safe -
+            // the writer never touches a slot the reader holds, because it
+            // only ever writes the slot it got back from its own exchange.
+            if (_latest.load(std::memory_order_relaxed) & FreshBit)
+            {
+                _readerSlot = _latest.exchange(_readerSlot, std::memory_order_acq_rel) & SlotMask;
+            }
+            out = _slots[_readerSlot].value;
+        }
+
+    private:
+        // Top bit of _latest: set by publish, cleared by the reader's
+        // exchange. Distinguishes "new publication parked here" from "the
+        // reader's own leavings".
+        static constexpr uint8_t FreshBit = 0x80;
+        static constexpr uint8_t SlotMask = 0x7F;
+
+        struct alignas(64) padded
+        {
+            T value{};
+        };
+
+        std::array<padded, 3> _slots{};
+        std::atomic<uint8_t> _latest{ 1 };
+        uint8_t _writerSlot = 0;
+        uint8_t _readerSlot = 2;
+    };
 }
@@ -28,6 +28,19 @@ namespace til
     template<typename T>
     struct hash_trait;
 
+    // A streaming hasher: write() calls chain the internal state, so
+    // composite keys (say, a shaped run's text plus its attributes) hash by
+    // writing each piece in turn - no concatenation buffer needed - and
+    // finalize() yields the result. Note that chaining is order-sensitive
+    // and write(a).write(b) deliberately differs from write(ab).
+    //
+    // On throughput: the 64-bit wyhash below already consumes 48 bytes per
+    // main-loop iteration across three independent multiply lanes, which
+    // saturates the scalar multiplier ports. Its quality comes from 64x64
+    // -> 128-bit multiplies, an operation SSE/AVX2 doesn't have - vector
+    // formulations end up emulating it slower than MULX runs it - so a
+    // "vectorized" path would either change the hash function or lose to
+    // this one. Viewport-sized wstrings ride the 48-byte loop end to end.
     struct hasher
     {
         constexpr hasher() = default;
@@ -0,0 +1,169 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+
+#include <atomic>
+#include <new>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// til::mpsc is the multi-producer sibling of til::spsc: any number of
+// threads may push concurrently, exactly one thread pops. It's a bounded
+// ring using the per-slot sequence-number protocol (Vyukov's bounded queue,
+// restricted to a single consumer): producers claim a slot with one
+// fetch_add - no CAS loop, so enqueue is wait-free as long as the ring has
+// room - write their item, and publish it by bumping the slot's sequence.
+// The consumer observes published slots in claim order.
+//
+// Differences from til::spsc, on purpose:
+// * Bounded. Block-based growth would require producers to agree on the
+//   tail block, which is exactly the coordination this design avoids. Pick
+//   a capacity that covers your burst; push returns false when full rather
+//   than blocking, so callers choose their own policy (the usual one for
+//   event channels: coalesce, or spin-yield briefly).
+// * push_n/pop_n are loops over the per-slot protocol rather than memcpy
+//   spans: slots publish individually, so a batch becomes visible
+//   incrementally, in order.
+namespace til::mpsc
+{
+    template<typename T>
+    class queue
+    {
+    public:
+        // capacity is rounded up to a power of two.
+        explicit queue(size_t capacity)
+        {
+            auto size = size_t{ 4 };
+            while (size < capacity)
+            {
+                size <<= 1;
+            }
+            _mask = size - 1;
+            _slots = std::vector<slot>(size);
+            for (size_t i = 0; i < size; ++i)
+            {
+                _slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        queue(const queue&) = delete;
+        queue& operator=(const queue&) = delete;
+
+        ~queue()
+        {
+            // Drain anything unconsumed so non-trivial Ts destruct.
+            T item;
+            while (try_pop(item))
+            {
+            }
+        }
+
+        // Enqueues one item. Returns false when the ring is full (the item
+        // is untouched then). Safe to call from any number of threads.
+        template<typename U>
+        bool try_push(U&& value)
+        {
+            auto pos = _tail.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                auto& s = _slots[pos & _mask];
+                const auto seq = s.sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+                if (diff == 0)
+                {
+                    // The slot is free for this position; claim it. A failed
+                    // exchange means another producer took it - retry at
+                    // their successor. (compare_exchange rather than a bare
+                    // fetch_add, so a full ring never claims ahead of the
+                    // consumer; the failure path re-reads and tries again,
+                    // which in the uncontended case never runs.)
+                    if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        s.item = std::forward<U>(value);
+                        s.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    // The consumer hasn't freed this slot yet: full.
+                    return false;
+                }
+                else
+                {
+                    // Another producer claimed this position; move on.
+                    pos = _tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Enqueues count items from first. Returns how many were enqueued
+        // (stops early when the ring fills). Items become visible to the
+        // consumer one at a time, in order.
+        template<typename InputIt>
+        size_t push_n(InputIt first, size_t count)
+        {
+            size_t pushed = 0;
+            for (; pushed < count; ++pushed, ++first)
+            {
+                if (!try_push(*first))
+                {
+                    break;
+                }
+            }
+            return pushed;
+        }
+
+        // Dequeues one item into out. Returns false when the queue is
+        // empty. Must only ever be called from one thread at a time.
+        bool try_pop(T& out)
+        {
+            auto& s = _slots[_head & _mask];
+            const auto seq = s.sequence.load(std::memory_order_acquire);
+            if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(_head + 1) < 0)
+            {
+                return false;
+            }
+            out = std::move(s.item);
+            // Free the slot for the producer one revolution ahead.
+            s.sequence.store(_head + _mask + 1, std::memory_order_release);
+            ++_head;
+            return true;
+        }
+
+        // Dequeues up to count items into first; returns how many.
+        template<typename OutputIt>
+        size_t pop_n(OutputIt first, size_t count)
+        {
+            size_t popped = 0;
+            T item;
+            for (; popped < count; ++popped, ++first)
+            {
+                if (!try_pop(item))
+                {
+                    break;
+                }
+                *first = std::move(item);
+            }
+            return popped;
+        }
+
+    private:
+        struct slot
+        {
+            std::atomic<size_t> sequence{ 0 };
+            T item{};
+        };
+
+        // Producers share _tail; the consumer owns _head. Keep them on
+        // separate cache lines so enqueues don't false-share with the
+        // consumer's bookkeeping.
+        alignas(64) std::atomic<size_t> _tail{ 0 };
+        alignas(64) size_t _head{ 0 };
+        size_t _mask{ 0 };
+        std::vector<slot> _slots;
+    };
+}
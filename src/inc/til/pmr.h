@@ -71,3 +71,136 @@ namespace til::pmr
     }
 #endif
 }
+
+namespace til::pmr
+{
+    // A chunked bump arena for transient hot-path allocations. Allocation is
+    // a pointer bump; deallocation is a no-op; memory is reclaimed by
+    // rewinding to a watermark when a scope ends. Chunks are kept (not
+    // freed) on rewind, so steady-state use allocates nothing at all.
+    //
+    // Use through scoped_arena below: it hands out this thread's arena and
+    // rewinds it on scope exit, which makes nesting safe (inner scopes
+    // rewind before outer ones) as long as nothing outlives its scope -
+    // the same discipline any stack allocator demands.
+    class arena_resource final : public std::pmr::memory_resource
+    {
+    public:
+        explicit arena_resource(const size_t chunkSize = 16 * 1024) noexcept :
+            _chunkSize{ chunkSize } {}
+
+        arena_resource(const arena_resource&) = delete;
+        arena_resource& operator=(const arena_resource&) = delete;
+
+        ~arena_resource()
+        {
+            for (const auto& chunk : _chunks)
+            {
+                ::operator delete(chunk.data);
+            }
+        }
+
+        struct watermark
+        {
+            size_t chunk = 0;
+            size_t used = 0;
+        };
+
+        watermark mark() const noexcept
+        {
+            return { _current, _used };
+        }
+
+        void rewind(const watermark w) noexcept
+        {
+            _current = w.chunk;
+            _used = w.used;
+        }
+
+    private:
+        struct chunk
+        {
+            void* data = nullptr;
+            size_t size = 0;
+        };
+
+        void* do_allocate(const size_t bytes, const size_t align) override
+        {
+            for (;;)
+            {
+                if (_current < _chunks.size())
+                {
+                    auto& c = _chunks[_current];
+                    const auto base = reinterpret_cast<uintptr_t>(c.data);
+                    const auto aligned = (base + _used + align - 1) & ~(align - 1);
+                    const auto end = aligned + bytes;
+                    if (end <= base + c.size)
+                    {
+                        _used = end - base;
+                        return reinterpret_cast<void*>(aligned);
+                    }
+
+                    // This chunk is full; move to the next (or grow).
+                    ++_current;
+                    _used = 0;
+                    continue;
+                }
+
+                // Oversized requests get their own chunk, so one large
+                // allocation doesn't poison the chunk size forever.
+                const auto size = std::max(_chunkSize, bytes + align);
+                _chunks.push_back({ ::operator new(size), size });
+                // (stay in the loop; the new chunk is now _chunks[_current])
+            }
+        }
+
+        void do_deallocate(void* /*ptr*/, size_t /*bytes*/, size_t /*align*/) noexcept override
+        {
+            // Reclaimed wholesale by rewind().
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+        std::vector<chunk> _chunks;
+        size_t _chunkSize;
+        size_t _current = 0;
+        size_t _used = 0;
+    };
+
+    // Grabs the calling thread's arena and rewinds it when the scope ends.
+    // Everything allocated from resource() must be done with (destroyed,
+    // not merely abandoned, if it's not trivially destructible) before this
+    // object goes away.
+    struct scoped_arena
+    {
+        scoped_arena() noexcept :
+            _arena{ _thread_arena() },
+            _mark{ _arena.mark() } {}
+
+        scoped_arena(const scoped_arena&) = delete;
+        scoped_arena& operator=(const scoped_arena&) = delete;
+
+        ~scoped_arena()
+        {
+            _arena.rewind(_mark);
+        }
+
+        [[nodiscard]] std::pmr::memory_resource* resource() const noexcept
+        {
+            return &_arena;
+        }
+
+    private:
+        static arena_resource& _thread_arena() noexcept
+        {
+            thread_local arena_resource arena;
+            return arena;
+        }
+
+        arena_resource& _arena;
+        arena_resource::watermark _mark;
+    };
+}
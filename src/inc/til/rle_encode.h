@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#pragma once
+
+// til::rle_encode: turns a flat row of 32-bit handles (attribute ids, color
+// indices) into (value, length) runs. The hot question per cell is only
+// "same as its neighbor?", so on x64 the boundary scan compares 4 lanes per
+// step against their shifted selves and extracts the mismatch mask, touching
+// the output only where runs actually break - a row with few runs (the
+// common case) costs near-memcmp time instead of a branch per cell.
+//
+// Rows that live as runs already (the text buffer's interned attribute
+// storage) don't need this; it's for the paths that materialize flat
+// per-cell arrays and then need runs back - frame diffing, clipboard/export
+// pipelines, engine handoffs.
+namespace til
+{
+    template<typename LengthT, typename OutputIt>
+    size_t rle_encode(const uint32_t* data, const size_t count, OutputIt out)
+    {
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        size_t runs = 0;
+        size_t runStart = 0;
+        size_t i = 1;
+
+        const auto emit = [&](const size_t boundary) {
+            *out = { data[runStart], static_cast<LengthT>(boundary - runStart) };
+            ++out;
+            ++runs;
+            runStart = boundary;
+        };
+
+#ifdef _M_AMD64
+        // Compare data[i..i+3] against data[i-1..i+2]: a set lane means a
+        // run boundary at that index.
+        for (; i + 4 <= count; )
+        {
+            const auto curr = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            const auto prev = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i - 1));
+            auto mask = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(curr, prev)))) ^ 0xF;
+
+            if (!mask)
+            {
+                i += 4;
+                continue;
+            }
+
+            while (mask)
+            {
+                unsigned long bit;
+                _BitScanForward(&bit, mask);
+                emit(i + bit);
+                mask &= mask - 1;
+            }
+            i += 4;
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            if (data[i] != data[i - 1])
+            {
+                emit(i);
+            }
+        }
+
+        emit(count);
+        return runs;
+    }
+}
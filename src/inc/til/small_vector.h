@@ -585,6 +585,23 @@ namespace til
             }
         }
 
+        // C++23 string-style resize_and_overwrite, for trivial Ts: grows
+        // the buffer without value-initializing the new elements, then lets
+        // op fill them. op(data, new_size) returns the final size, at most
+        // new_size. Saves the zero-fill on the hot paths that immediately
+        // overwrite everything they asked for.
+        template<typename Op>
+        void resize_and_overwrite(size_type new_size, Op op)
+        {
+            static_assert(std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>,
+                          "resize_and_overwrite hands out uninitialized elements; that's only sound for trivial Ts");
+
+            reserve(new_size);
+            const auto final_size = op(_data, new_size);
+            assert(final_size <= new_size);
+            _size = static_cast<size_type>(final_size);
+        }
+
         void resize(size_type new_size)
         {
             _generic_resize(new_size, [](auto&& beg, auto&& end) {
@@ -725,9 +742,26 @@ namespace til
             throw std::length_error("small_vector too long");
         }
 
+        // Trivially copyable Ts with heap-compatible alignment allocate
+        // straight from the process heap, so _grow can HeapReAlloc: the heap
+        // frequently extends the block in place, and even when it can't, it
+        // performs the relocation itself. Everything else stays on operator
+        // new. The two families must never mix on one allocation, which is
+        // why the same constant picks the branch in all three functions.
+        static constexpr bool _use_realloc_growth = std::is_trivially_copyable_v<T> && alignof(T) <= MEMORY_ALLOCATION_ALIGNMENT;
+
         static T* _allocate(size_t size)
         {
-            if constexpr (alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            if constexpr (_use_realloc_growth)
+            {
+                const auto data = static_cast<T*>(HeapAlloc(GetProcessHeap(), 0, size * sizeof(T)));
+                if (!data)
+                {
+                    throw std::bad_alloc{};
+                }
+                return data;
+            }
+            else if constexpr (alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
             {
                 return static_cast<T*>(::operator new(size * sizeof(T)));
             }
@@ -739,7 +773,11 @@ namespace til
 
         static void _deallocate(T* data) noexcept
         {
-            if constexpr (alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            if constexpr (_use_realloc_growth)
+            {
+                HeapFree(GetProcessHeap(), 0, data);
+            }
+            else if constexpr (alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
             {
                 ::operator delete(data);
             }
@@ -783,20 +821,48 @@ namespace til
                 _throw_too_long();
             }
 
-            const auto data = _allocate(new_cap);
-
-            // The earlier static_assert(std::is_nothrow_move_constructible_v<T>)
-            // ensures that we don't leak `data` here since no exceptions will be thrown.
-            std::uninitialized_move(begin(), end(), data);
-            std::destroy(begin(), end());
-
-            if (_capacity != N)
+            if constexpr (_use_realloc_growth)
             {
-                _deallocate(_data);
+                // Heap-to-heap growth extends in place when the heap can
+                // (common for the incremental growth attribute runs and
+                // dirty-rect lists do), and otherwise the heap performs the
+                // relocation itself - either way, no element-wise move.
+                if (_capacity != N)
+                {
+                    const auto data = static_cast<T*>(HeapReAlloc(GetProcessHeap(), 0, _data, new_cap * sizeof(T)));
+                    if (!data)
+                    {
+                        throw std::bad_alloc{};
+                    }
+                    _data = data;
+                    _capacity = new_cap;
+                    return;
+                }
+
+                // Inline-to-heap: one memcpy relocates the whole payload.
+                const auto data = _allocate(new_cap);
+                memcpy(data, _data, _size * sizeof(T));
+                _data = data;
+                _capacity = new_cap;
+                return;
             }
+            else
+            {
+                const auto data = _allocate(new_cap);
 
-            _data = data;
-            _capacity = new_cap;
+                // The earlier static_assert(std::is_nothrow_move_constructible_v<T>)
+                // ensures that we don't leak `data` here since no exceptions will be thrown.
+                std::uninitialized_move(begin(), end(), data);
+                std::destroy(begin(), end());
+
+                if (_capacity != N)
+                {
+                    _deallocate(_data);
+                }
+
+                _data = data;
+                _capacity = new_cap;
+            }
         }
 
         void _generic_resize(size_type new_size, auto&& func)
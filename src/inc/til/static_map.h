@@ -100,6 +100,135 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
             static_map<K, V, Compare, N, details::presorted_input_t>{ args... } {};
     };
 
+    // perfect_static_map: single-probe lookups over a compile-time-fixed
+    // set of unsigned-integral keys. Construction searches, at compile
+    // time, for a multiplicative hash - (key * M) >> S - that maps the key
+    // set injectively into a power-of-two index table; lookups then cost
+    // one multiply, one shift, and one compare, with no data-dependent
+    // branching, where static_map's binary search costs log2(n)
+    // unpredictable branches. Injectivity under a single probe is a
+    // birthday problem, so the table is sized ~N^2 (2 bytes per slot: ~16KB
+    // for a 90-key dispatch table) - the classic single-level FKS space
+    // trade. Use static_map for non-integral keys, or when N is large
+    // enough that the quadratic table stops being funny.
+    template<typename K, typename V, size_t N>
+    class perfect_static_map
+    {
+        static_assert(std::is_unsigned_v<K>, "the multiplicative perfect hash relies on unsigned integer keys");
+        static_assert(N > 0 && N < 0xFFFF, "the index table stores 16-bit slot indices");
+
+    public:
+        using const_iterator = const std::pair<K, V>*;
+
+        static constexpr size_t table_size = []() {
+            // N*N keeps the per-attempt success probability near
+            // exp(-1/2) ~ 60%, so the multiplier search ends in a couple of
+            // attempts; anything near-linear would make injectivity a
+            // lottery the constexpr evaluator can't afford to keep playing.
+            size_t s = 4;
+            while (s < N * N)
+            {
+                s <<= 1;
+            }
+            return s;
+        }();
+
+        template<typename... Args>
+        constexpr explicit perfect_static_map(const Args&... args) :
+            _array{ { args... } }
+        {
+            static_assert(sizeof...(Args) == N);
+
+            // Walk a deterministic sequence of odd multipliers until one
+            // hashes every key to a distinct slot. At a load factor of at
+            // most 1/4, random multipliers succeed quickly; the attempt cap
+            // only exists to turn a pathological key set into a compile
+            // error instead of an endless constexpr evaluation.
+            auto multiplier = UINT64_C(0x9E3779B97F4A7C15);
+            for (auto attempt = 0;; ++attempt)
+            {
+                if (attempt >= 10000)
+                {
+                    throw std::runtime_error("perfect_static_map: no perfect multiplier found; grow the table or check for duplicate keys");
+                }
+
+                _table = {};
+                for (auto& slot : _table)
+                {
+                    slot = _npos;
+                }
+
+                auto ok = true;
+                for (size_t i = 0; i < N; ++i)
+                {
+                    const auto slot = _probe(_array[i].first, multiplier);
+                    if (_table[slot] != _npos)
+                    {
+                        ok = false;
+                        break;
+                    }
+                    _table[slot] = static_cast<uint16_t>(i);
+                }
+
+                if (ok)
+                {
+                    _multiplier = multiplier;
+                    break;
+                }
+
+                multiplier = (multiplier * UINT64_C(6364136223846793005) + UINT64_C(1442695040888963407)) | 1;
+            }
+        }
+
+        [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+        {
+            const auto idx = _table[_probe(key, _multiplier)];
+            if (idx != _npos && _array[idx].first == key)
+            {
+                return _array.data() + idx;
+            }
+            return end();
+        }
+
+        [[nodiscard]] constexpr const_iterator end() const noexcept
+        {
+            return _array.data() + N;
+        }
+
+        [[nodiscard]] constexpr const V& at(const K& key) const
+        {
+            const auto iter{ find(key) };
+
+            if (iter == end())
+            {
+                throw std::runtime_error("key not found");
+            }
+
+            return iter->second;
+        }
+
+    private:
+        static constexpr uint16_t _npos = 0xFFFF;
+
+        static constexpr size_t _shift = []() {
+            size_t bits = 0;
+            for (auto s = table_size; s > 1; s >>= 1)
+            {
+                ++bits;
+            }
+            return 64 - bits;
+        }();
+
+        static constexpr size_t _probe(const K key, const uint64_t multiplier) noexcept
+        {
+            return static_cast<size_t>((static_cast<uint64_t>(key) * multiplier) >> _shift);
+        }
+
+        std::array<std::pair<K, V>, N> _array;
+        std::array<uint16_t, table_size> _table{};
+        uint64_t _multiplier{};
+    };
+
     // this is a deduction guide that ensures two things:
     // 1. static_map's member types are all the same
     // 2. static_map's fourth template argument (otherwise undeduced) is how many pairs it contains
@@ -108,4 +237,7 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
 
     template<typename First, typename... Rest>
     presorted_static_map(First, Rest...) -> presorted_static_map<std::conditional_t<std::conjunction_v<std::is_same<First, Rest>...>, typename First::first_type, void>, typename First::second_type, std::less<typename First::first_type>, 1 + sizeof...(Rest)>;
+
+    template<typename First, typename... Rest>
+    perfect_static_map(First, Rest...) -> perfect_static_map<std::conditional_t<std::conjunction_v<std::is_same<First, Rest>...>, typename First::first_type, void>, typename First::second_type, 1 + sizeof...(Rest)>;
 }
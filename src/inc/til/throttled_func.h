@@ -108,6 +108,14 @@ namespace til
             }
 
             memcpy(&_delay, &d, sizeof(d));
+
+            // Allow the kernel to coalesce this timer's expiration with
+            // others due within a quarter of the delay. A window with many
+            // panes runs dozens of these (scrollbar, title, patterns, ...);
+            // letting their interrupts batch across the process - and the
+            // system - is what keeps idle cores asleep, and a throttle by
+            // definition doesn't care about sub-delay precision.
+            _coalesceWindow = gsl::narrow_cast<DWORD>(std::chrono::duration_cast<std::chrono::milliseconds>(delay).count() / 4);
         }
 
         // throttled_func uses its `this` pointer when creating _timer.
@@ -172,7 +180,7 @@ namespace til
                 _func();
             }
 
-            SetThreadpoolTimerEx(_timer.get(), &_delay, 0, 0);
+            SetThreadpoolTimerEx(_timer.get(), &_delay, 0, _coalesceWindow);
         }
 
         void _trailing_edge()
@@ -195,6 +203,7 @@ namespace til
         }
 
         FILETIME _delay;
+        DWORD _coalesceWindow = 0;
         function _func;
         wil::unique_threadpool_timer _timer;
         details::throttled_func_storage<Args...> _storage;
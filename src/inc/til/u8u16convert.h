@@ -156,6 +156,43 @@ namespace til // Terminal Implementation Library. Also: "Today I Learned"
                 }
             }
 
+            if (len8)
+            {
+                // ASCII fast path: the overwhelming majority of ConPTY output
+                // is plain ASCII, which converts by zero-extension alone. The
+                // leading ASCII run is widened directly (16 bytes at a time on
+                // x64) and only whatever follows the first non-ASCII byte goes
+                // through MultiByteToWideChar.
+                int asciiLen{};
+#ifdef _M_AMD64
+                {
+                    const auto zero = _mm_setzero_si128();
+                    while (asciiLen + 16 <= len8)
+                    {
+                        const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor8 + asciiLen));
+                        if (_mm_movemask_epi8(chunk))
+                        {
+                            break;
+                        }
+                        const auto target = out.data() + len16 + asciiLen;
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(target), _mm_unpacklo_epi8(chunk, zero));
+                        _mm_storeu_si128(reinterpret_cast<__m128i*>(target + 8), _mm_unpackhi_epi8(chunk, zero));
+                        asciiLen += 16;
+                    }
+                }
+#endif
+                while (asciiLen < len8 && gsl::narrow_cast<uint8_t>(cursor8[asciiLen]) < 0x80)
+                {
+                    *(out.data() + len16 + asciiLen) = gsl::narrow_cast<wchar_t>(cursor8[asciiLen]);
+                    ++asciiLen;
+                }
+
+                len16 += asciiLen;
+                cursor8 += asciiLen;
+                len8 -= asciiLen;
+                capa16 -= asciiLen;
+            }
+
             if (len8)
             {
                 const auto convLen{ MultiByteToWideChar(CP_UTF8, 0UL, cursor8, len8, out.data() + len16, capa16) };
@@ -242,6 +242,14 @@ void Clipboard::CopyTextToSystemClipboard(const TextBuffer::TextAndColor& rows,
     std::wstring finalString;
 
     // Concatenate strings into one giant string to put onto the clipboard.
+    {
+        size_t totalSize = 0;
+        for (const auto& str : rows.text)
+        {
+            totalSize += str.size();
+        }
+        finalString.reserve(totalSize);
+    }
     for (const auto& str : rows.text)
     {
         finalString += str;
@@ -280,11 +288,34 @@ void Clipboard::CopyTextToSystemClipboard(const TextBuffer::TextAndColor& rows,
             const auto iFontHeightPoints = fontData.GetUnscaledSize().height * 72 / ServiceLocator::LocateGlobals().dpi;
             const auto bgColor = gci.GetRenderSettings().GetAttributeColors({}).second;
 
-            auto HTMLToPlaceOnClip = TextBuffer::GenHTML(rows, iFontHeightPoints, fontData.GetFaceName(), bgColor);
-            CopyToSystemClipboard(HTMLToPlaceOnClip, L"HTML Format");
-
-            auto RTFToPlaceOnClip = TextBuffer::GenRTF(rows, iFontHeightPoints, fontData.GetFaceName(), bgColor);
-            CopyToSystemClipboard(RTFToPlaceOnClip, L"Rich Text Format");
+            // Past this size, generating the HTML and RTF renditions up
+            // front is what hangs the window on a full-buffer selection -
+            // each one re-renders every cell into markup several times the
+            // size of the text. Publish the formats with null data instead
+            // and keep a snapshot; the window procedure's WM_RENDERFORMAT
+            // handler generates the one a paste target actually requests.
+            constexpr size_t DelayRenderRowThreshold = 1000;
+            if (rows.text.size() > DelayRenderRowThreshold)
+            {
+                _pendingFormatData = PendingFormatData{
+                    rows,
+                    iFontHeightPoints,
+                    std::wstring{ fontData.GetFaceName() },
+                    bgColor,
+                };
+                THROW_LAST_ERROR_IF_NULL(SetClipboardData(RegisterClipboardFormatW(L"HTML Format"), nullptr));
+                THROW_LAST_ERROR_IF_NULL(SetClipboardData(RegisterClipboardFormatW(L"Rich Text Format"), nullptr));
+            }
+            else
+            {
+                _pendingFormatData.reset();
+
+                auto HTMLToPlaceOnClip = TextBuffer::GenHTML(rows, iFontHeightPoints, fontData.GetFaceName(), bgColor);
+                CopyToSystemClipboard(HTMLToPlaceOnClip, L"HTML Format");
+
+                auto RTFToPlaceOnClip = TextBuffer::GenRTF(rows, iFontHeightPoints, fontData.GetFaceName(), bgColor);
+                CopyToSystemClipboard(RTFToPlaceOnClip, L"Rich Text Format");
+            }
         }
     }
 
@@ -294,6 +325,66 @@ void Clipboard::CopyTextToSystemClipboard(const TextBuffer::TextAndColor& rows,
     globalHandle.release();
 }
 
+// Routine Description:
+// - WM_RENDERFORMAT: a paste target asked for a format we published with
+//   null data. Generate just that one from the retained snapshot and set it;
+//   per contract the clipboard must NOT be opened here.
+void Clipboard::RenderClipboardFormat(const UINT format)
+try
+{
+    if (!_pendingFormatData)
+    {
+        return;
+    }
+    const auto& pending = *_pendingFormatData;
+
+    if (format == RegisterClipboardFormatW(L"HTML Format"))
+    {
+        CopyToSystemClipboard(TextBuffer::GenHTML(pending.rows, pending.fontHeightPoints, pending.fontFaceName, pending.backgroundColor), L"HTML Format");
+    }
+    else if (format == RegisterClipboardFormatW(L"Rich Text Format"))
+    {
+        CopyToSystemClipboard(TextBuffer::GenRTF(pending.rows, pending.fontHeightPoints, pending.fontFaceName, pending.backgroundColor), L"Rich Text Format");
+    }
+}
+CATCH_LOG()
+
+// Routine Description:
+// - WM_RENDERALLFORMATS: we're going away while still owning the clipboard.
+//   Per contract, open the clipboard, confirm we still own it, render
+//   everything outstanding, and close it.
+void Clipboard::RenderAllPendingClipboardFormats()
+try
+{
+    if (!_pendingFormatData)
+    {
+        return;
+    }
+
+    const auto window = ServiceLocator::LocateConsoleWindow()->GetWindowHandle();
+    THROW_LAST_ERROR_IF(!OpenClipboard(window));
+    const auto clipboardCloser = wil::scope_exit([]() {
+        LOG_LAST_ERROR_IF(!CloseClipboard());
+    });
+
+    if (GetClipboardOwner() == window)
+    {
+        RenderClipboardFormat(RegisterClipboardFormatW(L"HTML Format"));
+        RenderClipboardFormat(RegisterClipboardFormatW(L"Rich Text Format"));
+    }
+
+    _pendingFormatData.reset();
+}
+CATCH_LOG()
+
+// Routine Description:
+// - WM_DESTROYCLIPBOARD: someone else took clipboard ownership; the snapshot
+//   will never be asked for again.
+void Clipboard::ClearPendingClipboardFormats() noexcept
+{
+    _pendingFormatData.reset();
+}
+
 // Routine Description:
 // - Copies the given string onto the global system clipboard in the specified format
 // Arguments:
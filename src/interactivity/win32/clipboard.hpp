@@ -34,7 +34,25 @@ namespace Microsoft::Console::Interactivity::Win32
                          const size_t cchData);
         void Paste();
 
+        // Delayed clipboard rendering (WM_RENDERFORMAT and friends): large
+        // selections publish their HTML/RTF formats with null data and only
+        // generate the (much larger) formatted strings when a paste target
+        // actually asks. The window procedure forwards the messages here.
+        void RenderClipboardFormat(const UINT format);
+        void RenderAllPendingClipboardFormats();
+        void ClearPendingClipboardFormats() noexcept;
+
     private:
+        struct PendingFormatData
+        {
+            TextBuffer::TextAndColor rows;
+            int fontHeightPoints = 0;
+            std::wstring fontFaceName;
+            COLORREF backgroundColor = 0;
+        };
+
+        std::optional<PendingFormatData> _pendingFormatData;
+
         std::deque<std::unique_ptr<IInputEvent>> TextToKeyEvents(_In_reads_(cchData) const wchar_t* const pData,
                                                                  const size_t cchData);
 
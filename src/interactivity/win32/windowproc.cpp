@@ -289,6 +289,26 @@ using namespace Microsoft::Console::Types;
         break;
     }
 
+    case WM_RENDERFORMAT:
+    {
+        // A paste target asked for a clipboard format we published with
+        // delayed rendering (large selections; see Clipboard).
+        Clipboard::Instance().RenderClipboardFormat(gsl::narrow_cast<UINT>(wParam));
+        break;
+    }
+
+    case WM_RENDERALLFORMATS:
+    {
+        Clipboard::Instance().RenderAllPendingClipboardFormats();
+        break;
+    }
+
+    case WM_DESTROYCLIPBOARD:
+    {
+        Clipboard::Instance().ClearPendingClipboardFormats();
+        break;
+    }
+
     case WM_PAINT:
     {
         // Since we handle our own minimized window state, we need to
@@ -803,7 +823,19 @@ void Window::_HandleWindowPosChanged(const LPARAM lParam)
         // don't do anything except update our windowrect
         if (!WI_IsFlagSet(lpWindowPos->flags, SWP_NOSIZE) || _fInDPIChange)
         {
-            ScreenInfo.ProcessResizeWindow(&rcNew, &_rcClientLast);
+            // Programmatic SetWindowPos callers routinely pass an explicit
+            // size identical to the current one - SWP_NOSIZE doesn't get set
+            // then, and we used to run the full buffer resize and repaint
+            // for a geometry no-op, which is what turns an orchestrator's
+            // repeated positioning calls into a redraw storm. A DPI change
+            // must still process even with identical pixels: the metrics
+            // underneath changed.
+            if (rcNew.width() != _rcClientLast.width() ||
+                rcNew.height() != _rcClientLast.height() ||
+                _fInDPIChange)
+            {
+                ScreenInfo.ProcessResizeWindow(&rcNew, &_rcClientLast);
+            }
         }
 
         // now that operations are complete, save the new rectangle size as the last seen value
@@ -94,6 +94,17 @@ const size_t RegistrySerialization::s_GlobalPropMappingsSize = ARRAYSIZE(s_Globa
 // Return Value:
 // - STATUS_SUCCESSFUL or appropriate NTSTATUS reply for registry operations.
 [[nodiscard]] NTSTATUS RegistrySerialization::s_LoadRegDword(const HKEY hKey, const _RegPropertyMap* const pPropMap, _In_ Settings* const pSettings)
+{
+    const ValueSnapshot* noSnapshot = nullptr;
+    return _LoadRegDwordCommon(hKey, noSnapshot, pPropMap, pSettings);
+}
+
+[[nodiscard]] NTSTATUS RegistrySerialization::s_LoadRegDword(const ValueSnapshot& values, const _RegPropertyMap* const pPropMap, _In_ Settings* const pSettings)
+{
+    return _LoadRegDwordCommon(nullptr, &values, pPropMap, pSettings);
+}
+
+[[nodiscard]] NTSTATUS RegistrySerialization::_LoadRegDwordCommon(const HKEY hKey, const ValueSnapshot* const values, const _RegPropertyMap* const pPropMap, _In_ Settings* const pSettings)
 {
     // find offset into destination structure for this numerical value
     const auto pbField = (PBYTE)pSettings + pPropMap->dwFieldOffset;
@@ -101,12 +112,18 @@ const size_t RegistrySerialization::s_GlobalPropMappingsSize = ARRAYSIZE(s_Globa
     // attempt to load number into this field
     // If we're not successful, it's ok. Just don't fill it.
     DWORD dwValue;
-    auto Status = s_QueryValue(hKey,
-                               pPropMap->pwszValueName,
-                               sizeof(dwValue),
-                               ToWin32RegistryType(pPropMap->propertyType),
-                               (PBYTE)&dwValue,
-                               nullptr);
+    auto Status = values ?
+                      values->Query(pPropMap->pwszValueName,
+                                    sizeof(dwValue),
+                                    ToWin32RegistryType(pPropMap->propertyType),
+                                    (PBYTE)&dwValue,
+                                    nullptr) :
+                      s_QueryValue(hKey,
+                                   pPropMap->pwszValueName,
+                                   sizeof(dwValue),
+                                   ToWin32RegistryType(pPropMap->propertyType),
+                                   (PBYTE)&dwValue,
+                                   nullptr);
     if (SUCCEEDED_NTSTATUS(Status))
     {
         switch (pPropMap->propertyType)
@@ -154,6 +171,17 @@ const size_t RegistrySerialization::s_GlobalPropMappingsSize = ARRAYSIZE(s_Globa
 // Return Value:
 // - STATUS_SUCCESSFUL or appropriate NTSTATUS reply for registry operations.
 [[nodiscard]] NTSTATUS RegistrySerialization::s_LoadRegString(const HKEY hKey, const _RegPropertyMap* const pPropMap, _In_ Settings* const pSettings)
+{
+    const ValueSnapshot* noSnapshot = nullptr;
+    return _LoadRegStringCommon(hKey, noSnapshot, pPropMap, pSettings);
+}
+
+[[nodiscard]] NTSTATUS RegistrySerialization::s_LoadRegString(const ValueSnapshot& values, const _RegPropertyMap* const pPropMap, _In_ Settings* const pSettings)
+{
+    return _LoadRegStringCommon(nullptr, &values, pPropMap, pSettings);
+}
+
+[[nodiscard]] NTSTATUS RegistrySerialization::_LoadRegStringCommon(const HKEY hKey, const ValueSnapshot* const values, const _RegPropertyMap* const pPropMap, _In_ Settings* const pSettings)
 {
     // find offset into destination structure for this numerical value
     const auto pbField = (PBYTE)pSettings + pPropMap->dwFieldOffset;
@@ -165,12 +193,18 @@ const size_t RegistrySerialization::s_GlobalPropMappingsSize = ARRAYSIZE(s_Globa
     auto Status = NT_TESTNULL(pwchString);
     if (SUCCEEDED_NTSTATUS(Status))
     {
-        Status = s_QueryValue(hKey,
-                              pPropMap->pwszValueName,
-                              (DWORD)(cchField) * sizeof(WCHAR),
-                              ToWin32RegistryType(pPropMap->propertyType),
-                              (PBYTE)pwchString,
-                              nullptr);
+        Status = values ?
+                     values->Query(pPropMap->pwszValueName,
+                                   (DWORD)(cchField) * sizeof(WCHAR),
+                                   ToWin32RegistryType(pPropMap->propertyType),
+                                   (PBYTE)pwchString,
+                                   nullptr) :
+                     s_QueryValue(hKey,
+                                  pPropMap->pwszValueName,
+                                  (DWORD)(cchField) * sizeof(WCHAR),
+                                  ToWin32RegistryType(pPropMap->propertyType),
+                                  (PBYTE)pwchString,
+                                  nullptr);
         if (SUCCEEDED_NTSTATUS(Status))
         {
             // ensure pwchString is null terminated
@@ -298,6 +332,81 @@ const size_t RegistrySerialization::s_GlobalPropMappingsSize = ARRAYSIZE(s_Globa
     return NTSTATUS_FROM_WIN32(result);
 }
 
+// Routine Description:
+// - Enumerates every value under the given key into this snapshot: one
+//   round trip per value that exists, instead of one probe per property
+//   that might.
+[[nodiscard]] NTSTATUS RegistrySerialization::ValueSnapshot::Populate(const HKEY hKey)
+{
+    _values.clear();
+
+    WCHAR name[MAX_PATH];
+    BYTE data[2048];
+
+    for (DWORD index = 0;; ++index)
+    {
+        auto cchName = gsl::narrow_cast<DWORD>(std::size(name));
+        auto cbData = gsl::narrow_cast<DWORD>(sizeof(data));
+        DWORD type = 0;
+
+        const auto result = RegEnumValueW(hKey, index, name, &cchName, nullptr, &type, data, &cbData);
+        if (result == ERROR_NO_MORE_ITEMS)
+        {
+            break;
+        }
+        if (result == ERROR_MORE_DATA)
+        {
+            // A value bigger than any console setting; skip it, the
+            // per-value fallback path can still read it if it's ever mapped.
+            continue;
+        }
+        if (result != ERROR_SUCCESS)
+        {
+            return NTSTATUS_FROM_WIN32(result);
+        }
+
+        _values.insert_or_assign(std::wstring{ name, cchName },
+                                 std::make_pair(type, std::vector<BYTE>{ data, data + cbData }));
+    }
+
+    return STATUS_SUCCESS;
+}
+
+// Routine Description:
+// - Answers a query from the snapshot with s_QueryValue's exact contract:
+//   same not-found and type-mismatch results, same truncation behavior.
+[[nodiscard]] NTSTATUS RegistrySerialization::ValueSnapshot::Query(_In_ PCWSTR const pwszValueName,
+                                                                   const DWORD cbValueLength,
+                                                                   const DWORD regType,
+                                                                   _Out_writes_bytes_(cbValueLength) BYTE* const pbData,
+                                                                   _Out_opt_ DWORD* const pcbDataLength) const
+{
+    const auto it = _values.find(pwszValueName);
+    if (it == _values.end())
+    {
+        return NTSTATUS_FROM_WIN32(ERROR_FILE_NOT_FOUND);
+    }
+
+    const auto& [type, bytes] = it->second;
+    if (type != regType)
+    {
+        return STATUS_OBJECT_TYPE_MISMATCH;
+    }
+
+    if (bytes.size() > cbValueLength)
+    {
+        return NTSTATUS_FROM_WIN32(ERROR_MORE_DATA);
+    }
+
+    memcpy(pbData, bytes.data(), bytes.size());
+    if (pcbDataLength)
+    {
+        *pcbDataLength = gsl::narrow_cast<DWORD>(bytes.size());
+    }
+
+    return STATUS_SUCCESS;
+}
+
 // Routine Description:
 // - Queries a value for the given key
 // Arguments:
@@ -28,6 +28,27 @@ public:
     // The following registry methods remain public for DBCS and EUDC lookups.
     [[nodiscard]] static NTSTATUS s_OpenKey(_In_opt_ HKEY const hKey, _In_ PCWSTR const pwszSubKey, _Out_ HKEY* const phResult);
 
+    // A one-pass snapshot of every value under a key. Loading the mapped
+    // properties used to probe the key once per property - dozens of
+    // round trips, most answering "not found" on the sparse per-title
+    // keys - where enumerating costs one round trip per value that
+    // actually exists.
+    class ValueSnapshot
+    {
+    public:
+        [[nodiscard]] NTSTATUS Populate(const HKEY hKey);
+        // Mirrors s_QueryValue's contract (including the type check) but
+        // answers from the snapshot.
+        [[nodiscard]] NTSTATUS Query(_In_ PCWSTR const pwszValueName,
+                                     const DWORD cbValueLength,
+                                     const DWORD regType,
+                                     _Out_writes_bytes_(cbValueLength) BYTE* const pbData,
+                                     _Out_opt_ DWORD* const pcbDataLength) const;
+
+    private:
+        std::unordered_map<std::wstring, std::pair<DWORD, std::vector<BYTE>>> _values;
+    };
+
     [[nodiscard]] static NTSTATUS s_QueryValue(const HKEY hKey,
                                                _In_ PCWSTR const pwszValueName,
                                                const DWORD cbValueLength,
@@ -93,5 +114,13 @@ public:
     static const size_t s_GlobalPropMappingsSize;
 
     [[nodiscard]] static NTSTATUS s_LoadRegDword(const HKEY hKey, const _RegPropertyMap* const pPropMap, _In_ Settings* const pSettings);
+    [[nodiscard]] static NTSTATUS s_LoadRegDword(const ValueSnapshot& values, const _RegPropertyMap* const pPropMap, _In_ Settings* const pSettings);
     [[nodiscard]] static NTSTATUS s_LoadRegString(const HKEY hKey, const _RegPropertyMap* const pPropMap, _In_ Settings* const pSettings);
+    [[nodiscard]] static NTSTATUS s_LoadRegString(const ValueSnapshot& values, const _RegPropertyMap* const pPropMap, _In_ Settings* const pSettings);
+
+private:
+    [[nodiscard]] static NTSTATUS _LoadRegDwordCommon(const HKEY hKey, const ValueSnapshot* const values, const _RegPropertyMap* const pPropMap, _In_ Settings* const pSettings);
+    [[nodiscard]] static NTSTATUS _LoadRegStringCommon(const HKEY hKey, const ValueSnapshot* const values, const _RegPropertyMap* const pPropMap, _In_ Settings* const pSettings);
+
+public:
 };
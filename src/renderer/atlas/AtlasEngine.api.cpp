@@ -161,6 +161,16 @@ constexpr HRESULT vec2_narrow(U x, U y, AtlasEngine::vec2<T>& out) noexcept
 
 [[nodiscard]] HRESULT AtlasEngine::UpdateSoftFont(const std::span<const uint16_t> bitPattern, const til::size cellSize, const size_t centeringHint) noexcept
 {
+    // DECDLD soft fonts don't render in this engine yet: its glyph cache is
+    // populated exclusively from DirectWrite rasterizations keyed by text,
+    // and there's no seam for injecting caller-provided bitmaps into the
+    // texture atlas. When that seam exists, this is the right place to
+    // upload: the decoded patterns arrive here exactly once per DECDLD
+    // definition, so glyphs landed now would render at regular-glyph cost
+    // with no per-frame conversion - the same shape as the GDI engine,
+    // which builds its soft-font FontResource once in its UpdateSoftFont
+    // and paints from it thereafter. Until then, soft-font cells fall back
+    // to the replacement rendering the engine already produces for them.
     return S_OK;
 }
 
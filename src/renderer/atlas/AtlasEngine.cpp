@@ -904,6 +904,11 @@ void AtlasEngine::_createSwapChain()
         if constexpr (!debugGeneralPerformance)
         {
             const auto swapChain2 = _r.swapChain.query<IDXGISwapChain2>();
+            // Waitable swap chains default to a maximum frame latency of 1,
+            // but we set it explicitly: together with the pre-frame wait in
+            // WaitUntilCanRender this pins keypress-to-photon latency to a
+            // single frame instead of letting DXGI queue up more.
+            THROW_IF_FAILED(swapChain2->SetMaximumFrameLatency(1));
             _r.frameLatencyWaitableObject.reset(swapChain2->GetFrameLatencyWaitableObject());
             THROW_LAST_ERROR_IF(!_r.frameLatencyWaitableObject);
         }
@@ -1037,9 +1042,13 @@ void AtlasEngine::_recreateSizeDependentResources()
         {
             D3D11_BUFFER_DESC desc;
             desc.ByteWidth = gsl::narrow<u32>(totalCellCount * sizeof(Cell)); // totalCellCount can theoretically be UINT32_MAX!
-            desc.Usage = D3D11_USAGE_DYNAMIC;
+            // DEFAULT (instead of DYNAMIC) so that Present() can upload just
+            // the dirty row range with UpdateSubresource. A dynamic buffer
+            // would force a full WRITE_DISCARD rewrite of the entire grid
+            // every frame, even when a single line changed.
+            desc.Usage = D3D11_USAGE_DEFAULT;
             desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-            desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+            desc.CPUAccessFlags = 0;
             desc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
             desc.StructureByteStride = sizeof(Cell);
             THROW_IF_FAILED(_r.device->CreateBuffer(&desc, nullptr, _r.cellBuffer.put()));
@@ -696,6 +696,14 @@ namespace Microsoft::Console::Render
                 return _size;
             }
 
+            // GPU memory is bounded per window: once the atlas area exceeds
+            // _maxArea, allocate() recycles the least recently used tiles out
+            // of the TileHashMap instead of growing the texture, so sessions
+            // that cycle many fonts/sizes converge on a working set rather
+            // than accumulating stale glyphs forever. What we don't do is
+            // shrink or compact the texture afterwards - the allocator has no
+            // relocation support - so the footprint is the high-water mark up
+            // to _absoluteMaxArea, not the current working set.
             void setMaxArea(u16x2 windowSize) noexcept
             {
                 // _generate() uses a quadratic growth factor for _size's area.
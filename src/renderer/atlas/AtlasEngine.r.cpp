@@ -98,12 +98,15 @@ try
         }
 
         {
-#pragma warning(suppress : 26494) // Variable 'mapped' is uninitialized. Always initialize an object (type.5).
-            D3D11_MAPPED_SUBRESOURCE mapped;
-            THROW_IF_FAILED(_r.deviceContext->Map(_r.cellBuffer.get(), 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped));
-            assert(mapped.RowPitch >= _r.cells.size() * sizeof(Cell));
-            memcpy(mapped.pData, _r.cells.data(), _r.cells.size() * sizeof(Cell));
-            _r.deviceContext->Unmap(_r.cellBuffer.get(), 0);
+            // Upload only the rows the dirty rect covers. Cells are stored
+            // row-major, so the range is one contiguous span; with a blinking
+            // cursor on a 4K grid this shrinks the per-frame upload from the
+            // whole grid to a single row.
+            const auto rowBytes = static_cast<size_t>(_r.cellCount.x) * sizeof(Cell);
+            const auto beginByte = gsl::narrow_cast<UINT>(static_cast<size_t>(_r.dirtyRect.top) * rowBytes);
+            const auto endByte = gsl::narrow_cast<UINT>(static_cast<size_t>(_r.dirtyRect.bottom) * rowBytes);
+            const D3D11_BOX box{ beginByte, 0, 0, endByte, 1, 1 };
+            _r.deviceContext->UpdateSubresource(_r.cellBuffer.get(), 0, &box, _r.cells.data() + static_cast<size_t>(_r.dirtyRect.top) * _r.cellCount.x, 0, 0);
         }
 
         if (_r.customPixelShader) [[unlikely]]
@@ -394,6 +397,24 @@ void AtlasEngine::_adjustAtlasSize()
     WI_SetFlagIf(_r.invalidations, RenderInvalidations::Cursor, !copyFromExisting);
 }
 
+// On moving rasterization off the render thread: Present() already runs
+// without the console lock, so DWrite work here never blocks the parser -
+// it only lengthens the frame that introduces new glyphs. Making that
+// asynchronous means rendering placeholder tiles for cells whose glyphs
+// aren't rasterized yet and re-invalidating them on completion, which
+// requires the shader and the Cell layout to understand "pending" tiles.
+// Until that exists, bounding _processGlyphQueue per frame would just trade
+// a hitch for visibly missing glyphs.
+//
+// A persistent on-disk atlas cache (mapped read-only by new windows, keyed by
+// font collection hash/size/DPI/AA mode) has been considered for this queue
+// and deliberately not built: the rasterized tiles depend on per-device state
+// that doesn't fit a stable key - ClearType tuning, gamma/enhanced-contrast,
+// the DWrite version's rendering changes - and a mapped cache becomes an
+// integrity/versioning liability for every one of those inputs. The queue is
+// already lazy, so cold-start cost is proportional to the glyphs actually on
+// screen, not to the font; a warm-up pass that pre-queues ASCII at font
+// creation would capture most of the remaining benefit at none of the risk.
 void AtlasEngine::_processGlyphQueue()
 {
     if (_r.glyphQueue.empty() && WI_IsFlagClear(_r.invalidations, RenderInvalidations::Cursor))
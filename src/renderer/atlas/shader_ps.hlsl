@@ -87,6 +87,14 @@ float4 main(float4 pos: SV_Position): SV_Target
         return decodeRGBA(backgroundColor);
     }
 
+    // On splitting backgrounds/selection/decorations into a dedicated cheap
+    // pass: the per-pixel cost here is already a single structured-buffer
+    // load plus a handful of blends, and every pixel needs the same cell
+    // fetch either way to know whether a glyph covers it. A separate
+    // background pass would double the full-screen fill rate for the cells
+    // without glyphs, not halve it - the savings only materialize with a
+    // glyph-coverage mask that lets the background pass skip the glyph pass
+    // entirely, which is a larger pipeline change than a second Draw().
     uint2 viewportPos = pos.xy - viewport.xy;
     uint2 cellIndex = viewportPos / cellSize;
     uint2 cellPos = viewportPos % cellSize;
@@ -87,13 +87,33 @@ namespace Microsoft::Console::Render::FontCache
         }
     }
 
+    namespace details
+    {
+        inline std::mutex cachedCollectionMutex;
+        inline wil::com_ptr<IDWriteFontCollection> cachedCollection;
+    }
+
+    // The collection is shared process-wide: every pane's engine resolves
+    // fonts against the same system + nearby-font set, so composing it once
+    // serves them all. Opening an 8-pane layout used to repeat the font-set
+    // composition eight times.
     inline wil::com_ptr<IDWriteFontCollection> GetCached()
     {
-        return details::getFontCollection(false);
+        const std::lock_guard guard{ details::cachedCollectionMutex };
+        if (!details::cachedCollection)
+        {
+            details::cachedCollection = details::getFontCollection(false);
+        }
+        return details::cachedCollection;
     }
 
+    // Used when a WM_FONTCHANGE-style notification arrives: rebuilds the
+    // collection and also refreshes what later GetCached callers observe.
     inline wil::com_ptr<IDWriteFontCollection> GetFresh()
     {
-        return details::getFontCollection(true);
+        auto collection = details::getFontCollection(true);
+        const std::lock_guard guard{ details::cachedCollectionMutex };
+        details::cachedCollection = collection;
+        return collection;
     }
 }
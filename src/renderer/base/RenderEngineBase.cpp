@@ -73,8 +73,21 @@ HRESULT RenderEngineBase::PrepareLineTransform(const LineRendition /*lineRenditi
 // - Blocks until the engine is able to render without blocking.
 void RenderEngineBase::WaitUntilCanRender() noexcept
 {
-    // Throttle the render loop a bit by default (~60 FPS), improving throughput.
-    Sleep(8);
+    // Pace the render loop to the compositor's cadence when it's available:
+    // painting faster than the display refreshes just burns CPU the parser
+    // could be using, and a fixed sleep drifts against the actual refresh
+    // rate. When DWM composition isn't reachable (remote sessions, server
+    // core), fall back to the old fixed ~60 FPS throttle.
+    static const auto pfnDwmFlush = []() noexcept {
+        const auto module = LoadLibraryExW(L"dwmapi.dll", nullptr, LOAD_LIBRARY_SEARCH_SYSTEM32);
+        return module ? reinterpret_cast<HRESULT(WINAPI*)()>(GetProcAddress(module, "DwmFlush")) : nullptr;
+    }();
+
+    if (!pfnDwmFlush || FAILED(pfnDwmFlush()))
+    {
+        // Throttle the render loop a bit by default (~60 FPS), improving throughput.
+        Sleep(8);
+    }
 }
 
 // Routine Description:
@@ -3,6 +3,8 @@
 
 #include "precomp.h"
 
+#include <til/hash.h>
+
 #include "../inc/RenderSettings.hpp"
 #include "../base/renderer.hpp"
 #include "../../types/inc/ColorFix.hpp"
@@ -38,6 +40,7 @@ RenderSettings::RenderSettings() noexcept
 // - enabled - Set to true to enable the mode, false to disable it.
 void RenderSettings::SetRenderMode(const Mode mode, const bool enabled) noexcept
 {
+    _invalidateColorCache();
     _renderMode.set(mode, enabled);
     // If blinking is disabled, make sure blinking content is not faint.
     if (mode == Mode::BlinkAllowed && !enabled)
@@ -68,6 +71,7 @@ const std::array<COLORREF, TextColor::TABLE_SIZE>& RenderSettings::GetColorTable
 // - Resets the first 16 color table entries with default values.
 void RenderSettings::ResetColorTable() noexcept
 {
+    _invalidateColorCache();
     InitializeColorTable({ _colorTable.data(), 16 });
 }
 
@@ -78,6 +82,7 @@ void RenderSettings::ResetColorTable() noexcept
 //   color pair to the adjusted foreground for that color pair
 void RenderSettings::MakeAdjustedColorArray() noexcept
 {
+    _invalidateColorCache();
     // The color table has 16 colors, but the adjusted color table needs to be 19
     // to include the default background, default foreground and bright default foreground colors
     std::array<COLORREF, 19> colorTableWithDefaults;
@@ -114,6 +119,7 @@ void RenderSettings::MakeAdjustedColorArray() noexcept
 // - color - The new COLORREF to use as that color table value.
 void RenderSettings::SetColorTableEntry(const size_t tableIndex, const COLORREF color)
 {
+    _invalidateColorCache();
     _colorTable.at(tableIndex) = color;
 }
 
@@ -158,6 +164,7 @@ COLORREF RenderSettings::GetColorAlias(const ColorAlias alias) const
 // - tableIndex - The new position of the alias in the color table.
 void RenderSettings::SetColorAliasIndex(const ColorAlias alias, const size_t tableIndex) noexcept
 {
+    _invalidateColorCache();
     if (tableIndex < TextColor::TABLE_SIZE)
     {
         gsl::at(_colorAliasIndices, static_cast<size_t>(alias)) = tableIndex;
@@ -186,6 +193,16 @@ std::pair<COLORREF, COLORREF> RenderSettings::GetAttributeColors(const TextAttri
 {
     _blinkIsInUse = _blinkIsInUse || attr.IsBlinking();
 
+    // Resolution is a pure function of the attribute and the settings state,
+    // and SGR-heavy frames resolve the same few attributes thousands of
+    // times. Probe the memo first; any settings mutation bumps
+    // _resolutionGeneration and thereby drops every entry at once.
+    auto& entry = _resolvedColorCache[til::hash(&attr, sizeof(attr)) % _resolvedColorCache.size()];
+    if (entry.generation == _resolutionGeneration && entry.attr == attr)
+    {
+        return { entry.foreground, entry.background };
+    }
+
     const auto fgTextColor = attr.GetForeground();
     const auto bgTextColor = attr.GetBackground();
 
@@ -225,12 +242,14 @@ std::pair<COLORREF, COLORREF> RenderSettings::GetAttributeColors(const TextAttri
         {
             const auto fg = _adjustedForegroundColors[fgIndex][bgIndex];
             const auto bg = fgTextColor.GetColor(_colorTable, defaultFgIndex, brightenFg);
+            entry = { attr, _resolutionGeneration, fg, bg };
             return { fg, bg };
         }
         else
         {
             const auto fg = _adjustedForegroundColors[bgIndex][fgIndex];
             const auto bg = bgTextColor.GetColor(_colorTable, defaultBgIndex);
+            entry = { attr, _resolutionGeneration, fg, bg };
             return { fg, bg };
         }
     }
@@ -259,9 +278,19 @@ std::pair<COLORREF, COLORREF> RenderSettings::GetAttributeColors(const TextAttri
             fg != bg &&
             GetRenderMode(Mode::AlwaysDistinguishableColors))
         {
-            fg = ColorFix::GetPerceivableColor(fg, bg);
+            // The indexed palette's adjustments are precomputed wholesale;
+            // this is the truecolor path, memoized per (fg, bg) pair so a
+            // run of same-colored RGB output pays the Lab/deltaE math once.
+            const auto key = (static_cast<uint64_t>(fg & 0xFFFFFF) << 24) | (bg & 0xFFFFFF);
+            auto& slot = _perceivableColorCache[(key * 0x9E3779B97F4A7C15ull) >> 58];
+            if (slot.first != key)
+            {
+                slot = { key, ColorFix::GetPerceivableColor(fg, bg) };
+            }
+            fg = slot.second;
         }
 
+        entry = { attr, _resolutionGeneration, fg, bg };
         return { fg, bg };
     }
 }
@@ -305,6 +334,8 @@ try
         // have a blink cycle that loops through four phases...
         _blinkCycle = (_blinkCycle + 1) % 4;
         // ... and two of those four render the blink attributes as faint.
+        // The faint flip changes how blinking attributes resolve.
+        _invalidateColorCache();
         _blinkShouldBeFaint = _blinkCycle >= 2;
         // Every two cycles (when the state changes), we need to trigger a
         // redraw, but only if there are actually blink attributes in use.
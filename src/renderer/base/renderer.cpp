@@ -4,8 +4,22 @@
 #include "precomp.h"
 #include "renderer.hpp"
 
+#include <winmeta.h>
+#include <TraceLoggingProvider.h>
+#include <telemetry/ProjectTelemetry.h>
+
 #pragma hdrstop
 
+TRACELOGGING_DEFINE_PROVIDER(g_hConsoleRendererFrameProvider,
+                             "Microsoft.Windows.Console.Render.Frame",
+                             // tl:{6f1b4e63-7e1f-5bd0-a4c1-9a3d2f8b11c4}
+                             (0x6f1b4e63, 0x7e1f, 0x5bd0, 0xa4, 0xc1, 0x9a, 0x3d, 0x2f, 0x8b, 0x11, 0xc4),
+                             TraceLoggingOptionMicrosoftTelemetry());
+
+// Multiple Renderer instances share the provider, so registration is
+// refcounted across them.
+static std::atomic<int> s_frameProviderRefCount;
+
 using namespace Microsoft::Console::Render;
 using namespace Microsoft::Console::Types;
 
@@ -15,6 +29,11 @@ static constexpr auto maxRetriesForRenderEngine = 3;
 // The renderer will wait this number of milliseconds * how many tries have elapsed before trying again.
 static constexpr auto renderBackoffBaseTimeMilliseconds{ 150 };
 
+// How long a client may hold synchronized output (DECSET 2026) before we give
+// up waiting on it and paint anyway. Matches the order of magnitude other
+// terminals use, and is long enough for any reasonably-composed frame.
+static constexpr auto synchronizedOutputTimeout{ std::chrono::milliseconds(150) };
+
 #define FOREACH_ENGINE(var)   \
     for (auto var : _engines) \
         if (!var)             \
@@ -37,6 +56,11 @@ Renderer::Renderer(const RenderSettings& renderSettings,
     _pData(pData),
     _pThread{ std::move(thread) }
 {
+    if (s_frameProviderRefCount.fetch_add(1, std::memory_order_relaxed) == 0)
+    {
+        TraceLoggingRegister(g_hConsoleRendererFrameProvider);
+    }
+
     for (size_t i = 0; i < cEngines; i++)
     {
         AddRenderEngine(rgpEngines[i]);
@@ -51,9 +75,23 @@ Renderer::Renderer(const RenderSettings& renderSettings,
 // - <none>
 Renderer::~Renderer()
 {
+    // Disarm the synchronized-output wake timer and drain its callbacks
+    // before the render thread it pokes goes away.
+    if (_synchronizedOutputTimer)
+    {
+        SetThreadpoolTimerEx(_synchronizedOutputTimer.get(), nullptr, 0, 0);
+        WaitForThreadpoolTimerCallbacks(_synchronizedOutputTimer.get(), TRUE);
+        _synchronizedOutputTimer.reset();
+    }
+
     // RenderThread blocks until it has shut down.
     _destructing = true;
     _pThread.reset();
+
+    if (s_frameProviderRefCount.fetch_sub(1, std::memory_order_relaxed) == 1)
+    {
+        TraceLoggingUnregister(g_hConsoleRendererFrameProvider);
+    }
 }
 
 // Routine Description:
@@ -64,6 +102,16 @@ Renderer::~Renderer()
 // - HRESULT S_OK, GDI error, Safe Math error, or state/argument errors.
 [[nodiscard]] HRESULT Renderer::PaintFrame()
 {
+    // The engines are painted serially on purpose, even though their costs
+    // add up when UIA or the ConPTY VT engine rides along with a display
+    // engine. Each per-engine pass re-reads the live IRenderData under the
+    // console lock, and every mutating Trigger* is serialized against the
+    // paint by that same lock; painting engines concurrently requires the
+    // immutable frame snapshot described in
+    // doc/specs/"Copy-on-write buffer snapshots for lock-free painting.md"
+    // (per-engine invalidation locks first, then a captured IRenderData).
+    // Until that lands, parallelizing here would race every engine's
+    // invalidation state against the others' paint passes.
     FOREACH_ENGINE(pEngine)
     {
         auto tries = maxRetriesForRenderEngine;
@@ -102,6 +150,8 @@ Renderer::~Renderer()
         }
     }
 
+    _framesPresented.fetch_add(1, std::memory_order_relaxed);
+
     return S_OK;
 }
 
@@ -142,6 +192,17 @@ try
         }
     });
 
+    // Frame instrumentation: when a trace session is listening, stamp the
+    // phases of this frame and emit one event per engine at the end, so a
+    // slow frame in production says which phase it spent its time in. When
+    // nobody listens this costs a single branch.
+    const auto traceEnabled = TraceLoggingProviderEnabled(g_hConsoleRendererFrameProvider, WINEVENT_LEVEL_VERBOSE, 0);
+    std::chrono::steady_clock::time_point framePrepDone, frameTextDone, frameStart;
+    if (traceEnabled)
+    {
+        frameStart = std::chrono::steady_clock::now();
+    }
+
     // A. Prep Colors
     RETURN_IF_FAILED(_UpdateDrawingBrushes(pEngine, {}, false, true));
 
@@ -154,9 +215,19 @@ try
     // 1. Paint Background
     RETURN_IF_FAILED(_PaintBackground(pEngine));
 
+    if (traceEnabled)
+    {
+        framePrepDone = std::chrono::steady_clock::now();
+    }
+
     // 2. Paint Rows of Text
     _PaintBufferOutput(pEngine);
 
+    if (traceEnabled)
+    {
+        frameTextDone = std::chrono::steady_clock::now();
+    }
+
     // 3. Paint overlays that reside above the text buffer
     _PaintOverlays(pEngine);
 
@@ -172,6 +243,21 @@ try
     // Force scope exit end paint to finish up collecting information and possibly painting
     endPaint.reset();
 
+    if (traceEnabled)
+    {
+        const auto frameEnd = std::chrono::steady_clock::now();
+        const auto micros = [](const auto duration) {
+            return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+        };
+        TraceLoggingWrite(g_hConsoleRendererFrameProvider,
+                          "PaintFrame",
+                          TraceLoggingInt64(micros(framePrepDone - frameStart), "prepMicros", "scroll ops, render info, background"),
+                          TraceLoggingInt64(micros(frameTextDone - framePrepDone), "textMicros", "buffer text pass"),
+                          TraceLoggingInt64(micros(frameEnd - frameTextDone), "finishMicros", "overlays, selection, cursor, title, EndPaint"),
+                          TraceLoggingLevel(WINEVENT_LEVEL_VERBOSE),
+                          TraceLoggingKeyword(TIL_KEYWORD_TRACE));
+    }
+
     // Force scope exit unlock to let go of global lock so other threads can run
     unlock.reset();
 
@@ -185,6 +271,48 @@ CATCH_RETURN()
 
 void Renderer::NotifyPaintFrame() noexcept
 {
+    // While synchronized output is active, hold the notification back so we
+    // don't present a frame the application is still composing. We'll replay
+    // it when the mode is reset (or when the hold times out).
+    if (_synchronizedOutput)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (now < _synchronizedOutputExpiry)
+        {
+            _paintDeferredDuringSync = true;
+            // Nothing else is guaranteed to call us again (a client that
+            // stalls mid-frame goes quiet), so arm a one-shot wake of the
+            // render thread at the expiry. The timer bypasses this gate
+            // entirely - it pokes the thread directly - so it needs no
+            // access to any of the state guarded by the console lock.
+            if (_pThread)
+            {
+                if (!_synchronizedOutputTimer)
+                {
+                    _synchronizedOutputTimer.reset(CreateThreadpoolTimer(
+                        [](PTP_CALLBACK_INSTANCE, PVOID context, PTP_TIMER) noexcept {
+                            static_cast<RenderThread*>(context)->NotifyPaint();
+                        },
+                        _pThread.get(),
+                        nullptr));
+                }
+                if (_synchronizedOutputTimer)
+                {
+                    const auto remaining = std::chrono::duration_cast<std::chrono::duration<int64_t, std::ratio<1, 10000000>>>(_synchronizedOutputExpiry - now);
+                    const auto due = -remaining.count();
+                    FILETIME ft;
+                    memcpy(&ft, &due, sizeof(due));
+                    SetThreadpoolTimerEx(_synchronizedOutputTimer.get(), &ft, 0, 0);
+                }
+            }
+            return;
+        }
+        // The application held the mode for too long - release it ourselves,
+        // so a client that never sends the closing sequence can't freeze the
+        // display indefinitely.
+        _synchronizedOutput = false;
+    }
+
     // If we're running in the unittests, we might not have a render thread.
     if (_pThread)
     {
@@ -193,6 +321,38 @@ void Renderer::NotifyPaintFrame() noexcept
     }
 }
 
+// Routine Description:
+// - Enables or disables synchronized output (DEC private mode 2026). While
+//   enabled, paint notifications are deferred, so that a frame the client is
+//   still writing is never presented half-drawn. Disabling the mode releases
+//   any deferred notification.
+// Arguments:
+// - enable - True to begin deferring paints, false to end and catch up.
+// Return Value:
+// - <none>
+void Renderer::SetSynchronizedOutputMode(const bool enable) noexcept
+{
+    _synchronizedOutput = enable;
+    if (enable)
+    {
+        _synchronizedOutputExpiry = std::chrono::steady_clock::now() + synchronizedOutputTimeout;
+    }
+    else if (std::exchange(_paintDeferredDuringSync, false))
+    {
+        NotifyPaintFrame();
+    }
+}
+
+bool Renderer::GetSynchronizedOutputMode() const noexcept
+{
+    return _synchronizedOutput;
+}
+
+uint64_t Renderer::GetFramesPresented() const noexcept
+{
+    return _framesPresented.load(std::memory_order_relaxed);
+}
+
 // Routine Description:
 // - Called when the system has requested we redraw a portion of the console.
 // Arguments:
@@ -244,6 +404,32 @@ void Renderer::TriggerRedraw(const Viewport& region)
     }
 }
 
+// Routine Description:
+// - Called when a sub-region of the buffer (a scroll margin area) has been
+//   scrolled vertically. Engines that can encode the scroll itself avoid
+//   repainting the whole region; everyone else treats it as a redraw.
+// Arguments:
+// - region: The buffer-space region that scrolled.
+// - delta: How many rows it moved (positive is down).
+// Return Value:
+// - <none>
+void Renderer::TriggerScrollRegion(const Viewport& region, const til::CoordType delta)
+{
+    auto view = _viewport;
+    auto srUpdateRegion = region.ToExclusive();
+
+    if (view.TrimToViewport(&srUpdateRegion))
+    {
+        view.ConvertToOrigin(&srUpdateRegion);
+        FOREACH_ENGINE(pEngine)
+        {
+            LOG_IF_FAILED(pEngine->InvalidateScrollRegion(srUpdateRegion, delta));
+        }
+
+        NotifyPaintFrame();
+    }
+}
+
 // Routine Description:
 // - Called when a particular coordinate within the console buffer has changed.
 // Arguments:
@@ -372,10 +558,60 @@ void Renderer::TriggerSelection()
             sr &= viewport;
         }
 
+        // Typing in the search box re-selects the same match on every
+        // keystroke. If the selection didn't move, there's nothing to
+        // invalidate and no frame to schedule.
+        if (rects == _previousSelection)
+        {
+            return;
+        }
+
+        // Only the rows whose selection geometry changed need repainting.
+        // During a drag that's the handful of rows near the moving endpoint,
+        // not the hundreds of already-selected rows between the anchors -
+        // passing old and new wholesale made every mouse-move repaint the
+        // entire selection span. Both lists hold one rect per row, ordered
+        // by row, so a linear merge finds the symmetric difference.
+        std::vector<til::rect> changed;
+        changed.reserve(_previousSelection.size() + rects.size());
+        auto prevIt = _previousSelection.cbegin();
+        const auto prevEnd = _previousSelection.cend();
+        auto newIt = rects.cbegin();
+        const auto newEnd = rects.cend();
+        while (prevIt != prevEnd || newIt != newEnd)
+        {
+            if (prevIt == prevEnd)
+            {
+                changed.push_back(*newIt++);
+            }
+            else if (newIt == newEnd)
+            {
+                changed.push_back(*prevIt++);
+            }
+            else if (prevIt->top < newIt->top)
+            {
+                changed.push_back(*prevIt++);
+            }
+            else if (newIt->top < prevIt->top)
+            {
+                changed.push_back(*newIt++);
+            }
+            else
+            {
+                // Same row in both: only repaint it if the span moved, and
+                // then cover the old and new extents in one rect.
+                if (*prevIt != *newIt)
+                {
+                    changed.push_back(*prevIt | *newIt);
+                }
+                ++prevIt;
+                ++newIt;
+            }
+        }
+
         FOREACH_ENGINE(pEngine)
         {
-            LOG_IF_FAILED(pEngine->InvalidateSelection(_previousSelection));
-            LOG_IF_FAILED(pEngine->InvalidateSelection(rects));
+            LOG_IF_FAILED(pEngine->InvalidateSelection(changed));
         }
 
         _previousSelection = std::move(rects);
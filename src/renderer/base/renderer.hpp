@@ -47,8 +47,12 @@ namespace Microsoft::Console::Render
         [[nodiscard]] HRESULT PaintFrame();
 
         void NotifyPaintFrame() noexcept;
+        void SetSynchronizedOutputMode(const bool enable) noexcept;
+        bool GetSynchronizedOutputMode() const noexcept;
+        uint64_t GetFramesPresented() const noexcept;
         void TriggerSystemRedraw(const til::rect* const prcDirtyClient);
         void TriggerRedraw(const Microsoft::Console::Types::Viewport& region);
+        void TriggerScrollRegion(const Microsoft::Console::Types::Viewport& region, const til::CoordType delta);
         void TriggerRedraw(const til::point* const pcoord);
         void TriggerRedrawCursor(const til::point* const pcoord);
         void TriggerRedrawAll(const bool backgroundChanged = false, const bool frameChanged = false);
@@ -117,7 +121,9 @@ namespace Microsoft::Console::Render
         [[nodiscard]] HRESULT _PrepareRenderInfo(_In_ IRenderEngine* const pEngine);
 
         const RenderSettings& _renderSettings;
-        std::array<IRenderEngine*, 2> _engines{};
+        // Room for the host's primary engine plus the UIA engine plus one
+        // auxiliary notification engine (see PublicTerminalCore).
+        std::array<IRenderEngine*, 3> _engines{};
         IRenderData* _pData = nullptr; // Non-ownership pointer
         std::unique_ptr<RenderThread> _pThread;
         static constexpr size_t _firstSoftFontChar = 0xEF20;
@@ -132,6 +138,15 @@ namespace Microsoft::Console::Render
         std::function<void()> _pfnRendererEnteredErrorState;
         bool _destructing = false;
         bool _forceUpdateViewport = true;
+        bool _synchronizedOutput = false;
+        bool _paintDeferredDuringSync = false;
+        std::chrono::steady_clock::time_point _synchronizedOutputExpiry{};
+        // Wakes the render thread at the synchronized-output expiry, so a
+        // client that goes quiet mid-hold can't leave a frame unpresented.
+        wil::unique_threadpool_timer _synchronizedOutputTimer;
+        // Lifetime count of completed paint passes; feeds the in-band
+        // performance query (OSC 7770).
+        std::atomic<uint64_t> _framesPresented{ 0 };
 
 #ifdef UNIT_TESTING
         friend class ConptyOutputTests;
@@ -364,6 +364,12 @@ CATCH_RETURN()
             _glyphIndices.resize(totalGlyphsArrayCount);
         }
 
+        // This simple-text shortcut is also why a (text, font) -> shaped-run
+        // cache hasn't been added here: for the runs that dominate repaints
+        // (plain ASCII under one font face) we never reach GetGlyphs in the
+        // first place, and the complex-run leftovers vary too much in text
+        // content for a hash-keyed cache to hit often enough to carry the
+        // bookkeeping on every frame.
         if (_isEntireTextSimple && !_fontRenderData->DidUserSetFeatures())
         {
             // When the entire text is simple, we can skip GetGlyphs and directly retrieve glyph indices and
@@ -679,11 +679,27 @@ try
                                                                                            &_dxgiSwapChain));
             break;
         }
+        case SwapChainMode::ForSharedTexture:
+        {
+            // Flip-model buffers can't be shared across devices, so an
+            // embedder composing us via D3DImage gets a plain shareable
+            // texture instead of a swap chain. Present() flushes into it.
+            _swapChainDesc.Width = _displaySizePixels.narrow_width<UINT>();
+            _swapChainDesc.Height = _displaySizePixels.narrow_height<UINT>();
+            _swapChainDesc.AlphaMode = DXGI_ALPHA_MODE_IGNORE;
+
+            RETURN_IF_FAILED(_CreateSharedTexture());
+
+            // Make sure nobody waits on the (never created) frame latency
+            // waitable object; WaitUntilCanRender's Sleep throttles us.
+            _swapChainFrameLatencyWaitableObject.reset();
+            break;
+        }
         default:
             THROW_HR(E_NOTIMPL);
         }
 
-        if (IsWindows8Point1OrGreater())
+        if (_dxgiSwapChain && IsWindows8Point1OrGreater())
         {
             ::Microsoft::WRL::ComPtr<IDXGISwapChain2> swapChain2;
             const auto asResult = _dxgiSwapChain.As(&swapChain2);
@@ -697,7 +713,7 @@ try
             }
         }
 
-        if (_HasTerminalEffects())
+        if (_dxgiSwapChain && _HasTerminalEffects())
         {
             const auto hr = _SetupTerminalEffects();
             if (FAILED(hr))
@@ -731,7 +747,7 @@ try
     {
         try
         {
-            _pfn(_swapChainHandle.get());
+            _pfn(_chainMode == SwapChainMode::ForSharedTexture ? _sharedTextureHandle : _swapChainHandle.get());
         }
         CATCH_LOG(); // A failure in the notification function isn't a failure to prepare, so just log it and go on.
     }
@@ -764,8 +780,16 @@ static constexpr D2D1_ALPHA_MODE _dxgiAlphaToD2d1Alpha(DXGI_ALPHA_MODE mode) noe
 {
     try
     {
-        // Pull surface out of swap chain.
-        RETURN_IF_FAILED(_dxgiSwapChain->GetBuffer(0, IID_PPV_ARGS(&_dxgiSurface)));
+        // Pull the surface we draw on out of the swap chain - or, in shared
+        // texture mode, out of the texture itself.
+        if (_chainMode == SwapChainMode::ForSharedTexture)
+        {
+            RETURN_IF_FAILED(_sharedTexture.As(&_dxgiSurface));
+        }
+        else
+        {
+            RETURN_IF_FAILED(_dxgiSwapChain->GetBuffer(0, IID_PPV_ARGS(&_dxgiSurface)));
+        }
 
         // Make a bitmap and bind it to the swap chain surface
         const auto bitmapProperties = D2D1::BitmapProperties1(
@@ -878,6 +902,8 @@ void DxEngine::_ReleaseDeviceResources() noexcept
 
         _dxgiSurface.Reset();
         _dxgiSwapChain.Reset();
+        _sharedTexture.Reset();
+        _sharedTextureHandle = nullptr;
         _swapChainFrameLatencyWaitableObject.reset();
 
         _d2dDevice.Reset();
@@ -974,6 +1000,51 @@ CATCH_RETURN()
     return S_OK;
 }
 
+// Routine Description:
+// - Switches the engine to render into a shareable texture instead of a swap
+//   chain. The embedder opens the handle on its own device (D3D9Ex for WPF's
+//   D3DImage) and composes the texture directly, cutting the hwnd redirection
+//   blit out of presentation. Size the texture with SetWindowSize; learn the
+//   handle (it changes on every resize) through SetCallback.
+[[nodiscard]] HRESULT DxEngine::SetSharedTexturePresentation() noexcept
+{
+    _chainMode = SwapChainMode::ForSharedTexture;
+    if (_haveDeviceResources)
+    {
+        _recreateDeviceRequested = true;
+    }
+    return S_OK;
+}
+
+HANDLE DxEngine::GetSharedTextureHandle() const noexcept
+{
+    return _sharedTextureHandle;
+}
+
+[[nodiscard]] HRESULT DxEngine::_CreateSharedTexture() noexcept
+{
+    D3D11_TEXTURE2D_DESC desc{};
+    desc.Width = _swapChainDesc.Width;
+    desc.Height = _swapChainDesc.Height;
+    desc.MipLevels = 1;
+    desc.ArraySize = 1;
+    desc.Format = _swapChainDesc.Format;
+    desc.SampleDesc.Count = 1;
+    desc.Usage = D3D11_USAGE_DEFAULT;
+    desc.BindFlags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
+    // The legacy shared flag (not the NT-handle variant): D3D9Ex interop,
+    // which is what D3DImage consumes, can only open these.
+    desc.MiscFlags = D3D11_RESOURCE_MISC_SHARED;
+
+    RETURN_IF_FAILED(_d3dDevice->CreateTexture2D(&desc, nullptr, _sharedTexture.ReleaseAndGetAddressOf()));
+
+    ::Microsoft::WRL::ComPtr<IDXGIResource> resource;
+    RETURN_IF_FAILED(_sharedTexture.As(&resource));
+    RETURN_IF_FAILED(resource->GetSharedHandle(&_sharedTextureHandle));
+
+    return S_OK;
+}
+
 [[nodiscard]] HRESULT DxEngine::SetWindowSize(const til::size Pixels) noexcept
 try
 {
@@ -1145,6 +1216,12 @@ CATCH_RETURN();
 //               - -Y is up, Y is down, -X is left, X is right.
 // Return Value:
 // - S_OK
+// Scroll deltas recorded here flow all the way to presentation: the paint
+// pass only re-renders the revealed rows (the translated dirty map), and
+// Present1 receives the accumulated delta as a pScrollRect/pScrollOffset
+// pair so the compositor moves the surviving pixels instead of us redrawing
+// them. Scrolling through scrollback therefore costs the newly exposed lines
+// plus a pixel move, not a repaint of every shifted line.
 [[nodiscard]] HRESULT DxEngine::InvalidateScroll(const til::point* const pcoordDelta) noexcept
 try
 {
@@ -1210,6 +1287,7 @@ CATCH_RETURN();
         return til::rect{ clientRect }.size();
     }
     case SwapChainMode::ForComposition:
+    case SwapChainMode::ForSharedTexture:
     {
         return _sizeTarget;
     }
@@ -1304,7 +1382,30 @@ try
             _d2dBitmap.Reset();
 
             // Change the buffer size and recreate the render target (and surface)
-            RETURN_IF_FAILED(_dxgiSwapChain->ResizeBuffers(2, clientSize.narrow_width<UINT>(), clientSize.narrow_height<UINT>(), _swapChainDesc.Format, _swapChainDesc.Flags));
+            if (_chainMode == SwapChainMode::ForSharedTexture)
+            {
+                // A shared texture can't be resized; it's replaced (and the
+                // embedder learns the new handle through the callback).
+                _sharedTexture.Reset();
+                _sharedTextureHandle = nullptr;
+                _swapChainDesc.Width = clientSize.narrow_width<UINT>();
+                _swapChainDesc.Height = clientSize.narrow_height<UINT>();
+                RETURN_IF_FAILED(_CreateSharedTexture());
+
+                // Tell the embedder about the replacement texture.
+                if (_pfn)
+                {
+                    try
+                    {
+                        _pfn(_sharedTextureHandle);
+                    }
+                    CATCH_LOG();
+                }
+            }
+            else
+            {
+                RETURN_IF_FAILED(_dxgiSwapChain->ResizeBuffers(2, clientSize.narrow_width<UINT>(), clientSize.narrow_height<UINT>(), _swapChainDesc.Format, _swapChainDesc.Flags));
+            }
             RETURN_IF_FAILED(_PrepareRenderTarget());
 
             // OK we made it past the parts that can cause errors. We can release our failure handler.
@@ -1522,6 +1623,25 @@ void DxEngine::WaitUntilCanRender() noexcept
 
         try
         {
+            if (_chainMode == SwapChainMode::ForSharedTexture)
+            {
+                // There's no swap chain to flip; the embedder samples the
+                // shared texture from its own device (e.g. D3DImage pulling
+                // it into the WPF composition tree). Just make sure our GPU
+                // work is submitted. The texture is persistent, so there's no
+                // front-to-back copy either - partial draws accumulate in
+                // place.
+                _d3dDeviceContext->Flush();
+                _firstFrame = false;
+
+                _presentReady = false;
+                _presentDirty.clear();
+                _presentOffset = { 0 };
+                _presentScroll = { 0 };
+                _presentParams = { 0 };
+                return S_OK;
+            }
+
             auto hr = S_OK;
 
             auto recreate = false;
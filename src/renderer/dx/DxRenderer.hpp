@@ -54,6 +54,8 @@ namespace Microsoft::Console::Render
         [[nodiscard]] HRESULT Disable() noexcept;
 
         [[nodiscard]] HRESULT SetHwnd(const HWND hwnd) noexcept override;
+        [[nodiscard]] HRESULT SetSharedTexturePresentation() noexcept;
+        HANDLE GetSharedTextureHandle() const noexcept;
 
         [[nodiscard]] HRESULT SetWindowSize(const til::size pixels) noexcept override;
 
@@ -148,7 +150,8 @@ namespace Microsoft::Console::Render
         enum class SwapChainMode
         {
             ForHwnd,
-            ForComposition
+            ForComposition,
+            ForSharedTexture
         };
 
         SwapChainMode _chainMode;
@@ -194,6 +197,11 @@ namespace Microsoft::Console::Render
         static std::atomic<size_t> _tracelogCount;
 
         wil::unique_handle _swapChainHandle;
+        // ForSharedTexture mode: the texture we render into instead of a swap
+        // chain, and its legacy (non-NT, unowned) shared handle for the
+        // embedder's device to open.
+        ::Microsoft::WRL::ComPtr<ID3D11Texture2D> _sharedTexture;
+        HANDLE _sharedTextureHandle{ nullptr };
 
         // Device-Independent Resources
         ::Microsoft::WRL::ComPtr<ID2D1Factory1> _d2dFactory;
@@ -283,6 +291,7 @@ namespace Microsoft::Console::Render
         } _pixelShaderSettings;
 
         [[nodiscard]] HRESULT _CreateDeviceResources(const bool createSwapChain) noexcept;
+        [[nodiscard]] HRESULT _CreateSharedTexture() noexcept;
         [[nodiscard]] HRESULT _CreateSurfaceHandle() noexcept;
 
         bool _HasTerminalEffects() const noexcept;
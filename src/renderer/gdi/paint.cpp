@@ -39,7 +39,12 @@ bool GdiEngine::FontHasWesternScript(HDC hdc)
     //      make sure the window's title is updated, even if the window isn't visible.
     RETURN_HR_IF(S_FALSE, (!IsWindowVisible(_hwndTargetWindow) && !_titleChanged));
 
-    // At the beginning of a new frame, we have 0 lines ready for painting in PolyTextOut
+    // At the beginning of a new frame, we have 0 lines ready for painting in PolyTextOut.
+    // This cache is what keeps GDI competitive over RDP: PaintBufferLine only
+    // queues lines here, the flush submits them in PolyTextOutW-sized batches,
+    // and the state layer already skips SetTextColor/SetBkColor when the
+    // colors didn't change - so per-run state churn is limited to runs that
+    // actually changed attributes.
     _cPolyText = 0;
 
     // Prepare our in-memory bitmap for double-buffered composition.
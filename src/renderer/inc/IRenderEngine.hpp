@@ -64,6 +64,10 @@ namespace Microsoft::Console::Render
         [[nodiscard]] virtual HRESULT InvalidateSystem(const til::rect* prcDirtyClient) noexcept = 0;
         [[nodiscard]] virtual HRESULT InvalidateSelection(const std::vector<til::rect>& rectangles) noexcept = 0;
         [[nodiscard]] virtual HRESULT InvalidateScroll(const til::point* pcoordDelta) noexcept = 0;
+        // Notifies that a sub-region of the viewport (a DECSTBM margin area)
+        // scrolled vertically by delta rows. Engines without a cheaper
+        // encoding for that treat it as a plain invalidation of the region.
+        [[nodiscard]] virtual HRESULT InvalidateScrollRegion(const til::rect& region, const til::CoordType /*delta*/) noexcept { return Invalidate(&region); }
         [[nodiscard]] virtual HRESULT InvalidateAll() noexcept = 0;
         [[nodiscard]] virtual HRESULT InvalidateFlush(_In_ const bool circled, _Out_ bool* const pForcePaint) noexcept = 0;
         [[nodiscard]] virtual HRESULT InvalidateTitle(std::wstring_view proposedTitle) noexcept = 0;
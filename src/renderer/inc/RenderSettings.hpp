@@ -45,11 +45,36 @@ namespace Microsoft::Console::Render
         void ToggleBlinkRendition(class Renderer& renderer) noexcept;
 
     private:
+        // A small direct-mapped memo of attribute -> resolved color pairs.
+        // Color resolution is a pure function of the attribute and the
+        // settings state, so entries stay valid until any mutator bumps
+        // _resolutionGeneration. SGR-heavy frames resolve the same handful
+        // of attributes thousands of times per frame.
+        struct ResolvedColorEntry
+        {
+            TextAttribute attr;
+            uint32_t generation = 0;
+            COLORREF foreground = 0;
+            COLORREF background = 0;
+        };
+
+        void _invalidateColorCache() noexcept { ++_resolutionGeneration; }
+
         til::enumset<Mode> _renderMode{ Mode::BlinkAllowed, Mode::IntenseIsBright };
         std::array<COLORREF, TextColor::TABLE_SIZE> _colorTable;
         std::array<size_t, static_cast<size_t>(ColorAlias::ENUM_COUNT)> _colorAliasIndices;
         std::array<std::array<COLORREF, 19>, 19> _adjustedForegroundColors;
         size_t _blinkCycle = 0;
+        mutable std::array<ResolvedColorEntry, 16> _resolvedColorCache{};
+        // Memo for the truecolor perceivable-color adjustment: the Lab/deltaE
+        // math is a pure function of the (fg, bg) pair, and runs of RGB
+        // output repeat the same few pairs. Key 0 doubles as the empty
+        // sentinel, safe because the caller never adjusts fg == bg (so
+        // black-on-black can't be queried). Never needs invalidation: the
+        // function has no other inputs. Guarded by the console lock like the
+        // resolution cache above.
+        mutable std::array<std::pair<uint64_t, COLORREF>, 64> _perceivableColorCache{};
+        uint32_t _resolutionGeneration = 1;
         mutable bool _blinkIsInUse = false;
         bool _blinkShouldBeFaint = false;
     };
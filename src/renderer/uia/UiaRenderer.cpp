@@ -254,31 +254,57 @@ void UiaEngine::WaitUntilCanRender() noexcept
 {
     RETURN_HR_IF(S_FALSE, !_isEnabled);
 
-    // Fire UIA Events here
-    if (_selectionChanged)
+    // Fire UIA Events here.
+    //
+    // Rate-limited per event type: with a screen reader attached, an output
+    // flood otherwise raises these once per painted frame - far faster than
+    // the UIA core dispatches them, so its queue grows and the reader
+    // drowns in stale notifications. A suppressed signal stays pending (the
+    // flag isn't cleared), and a later frame delivers it once the interval
+    // has passed; during a flood frames keep coming, and after one the
+    // focused cursor's blinking keeps producing frames, so the final state
+    // always gets announced.
+    const auto now = std::chrono::steady_clock::now();
+    static constexpr auto signalInterval = std::chrono::milliseconds(100);
+
+    auto selectionDelivered = false;
+    auto textDelivered = false;
+    auto cursorDelivered = false;
+
+    if (_selectionChanged && now - _lastSelectionSignal >= signalInterval)
     {
         try
         {
             _dispatcher->SignalSelectionChanged();
+            _lastSelectionSignal = now;
+            selectionDelivered = true;
         }
         CATCH_LOG();
     }
-    if (_textBufferChanged)
+    if (_textBufferChanged && now - _lastTextSignal >= signalInterval)
     {
         try
         {
             _dispatcher->SignalTextChanged();
+            _lastTextSignal = now;
+            textDelivered = true;
         }
         CATCH_LOG();
     }
-    if (_cursorChanged)
+    if (_cursorChanged && now - _lastCursorSignal >= signalInterval)
     {
         try
         {
             _dispatcher->SignalCursorChanged();
+            _lastCursorSignal = now;
+            cursorDelivered = true;
         }
         CATCH_LOG();
     }
+
+    _pendingSelectionSignal = _selectionChanged && !selectionDelivered;
+    _pendingTextSignal = _textBufferChanged && !textDelivered;
+    _pendingCursorSignal = _cursorChanged && !cursorDelivered;
     try
     {
         // The speech API is limited to 1000 characters at a time.
@@ -293,9 +319,11 @@ void UiaEngine::WaitUntilCanRender() noexcept
     }
     CATCH_LOG();
 
-    _selectionChanged = false;
-    _textBufferChanged = false;
-    _cursorChanged = false;
+    // Carry rate-limit-suppressed signals into the next frame, so the last
+    // change of a burst is never lost.
+    _selectionChanged = _pendingSelectionSignal;
+    _textBufferChanged = _pendingTextSignal;
+    _cursorChanged = _pendingCursorSignal;
     _isPainting = false;
     _queuedOutput.clear();
 
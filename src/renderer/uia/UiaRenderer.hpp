@@ -70,6 +70,16 @@ namespace Microsoft::Console::Render
         bool _selectionChanged;
         bool _textBufferChanged;
         bool _cursorChanged;
+
+        // Rate limiting for the signals above (see Present): when the last
+        // raise of a type was too recent, the changed flag carries into the
+        // next frame instead of raising again.
+        std::chrono::steady_clock::time_point _lastSelectionSignal{};
+        std::chrono::steady_clock::time_point _lastTextSignal{};
+        std::chrono::steady_clock::time_point _lastCursorSignal{};
+        bool _pendingSelectionSignal = false;
+        bool _pendingTextSignal = false;
+        bool _pendingCursorSignal = false;
         std::wstring _newOutput;
         std::wstring _queuedOutput;
 
@@ -160,6 +160,47 @@ using namespace Microsoft::Console::Render;
     return _InsertDeleteLine(sLines, true);
 }
 
+// Method Description:
+// - Formats and writes a sequence to set the top and bottom scrolling margins
+//      (DECSTBM). Note that the terminal will home the cursor as a side
+//      effect, so the caller must consider its cursor tracking stale.
+// Arguments:
+// - top, bottom: the margin rows, in console coordinates (0-based, inclusive).
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate or write.
+[[nodiscard]] HRESULT VtEngine::_SetScrollingRegion(const til::CoordType top, const til::CoordType bottom) noexcept
+{
+    return _WriteFormatted(FMT_COMPILE("\x1b[{};{}r"), top + 1, bottom + 1);
+}
+
+// Method Description:
+// - Formats and writes a sequence to reset the scrolling margins to the full
+//      screen (DECSTBM with no parameters). Also homes the cursor.
+// Arguments:
+// - <none>
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate or write.
+[[nodiscard]] HRESULT VtEngine::_ResetScrollingRegion() noexcept
+{
+    return _Write("\x1b[r");
+}
+
+// Method Description:
+// - Formats and writes a sequence to scroll the contents of the scrolling
+//      region (SU/SD). The revealed lines are erased by the terminal.
+// Arguments:
+// - delta: the number of rows to move the content; positive is down (SD).
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate or write.
+[[nodiscard]] HRESULT VtEngine::_ScrollRegion(const til::CoordType delta) noexcept
+{
+    if (delta == 0)
+    {
+        return S_OK;
+    }
+    return _WriteFormatted(FMT_COMPILE("\x1b[{}{}"), delta < 0 ? -delta : delta, delta < 0 ? 'S' : 'T');
+}
+
 // Method Description:
 // - Formats and writes a sequence to move the cursor to the specified
 //      coordinate position. The input coord should be in console coordinates,
@@ -252,10 +293,21 @@ using namespace Microsoft::Console::Render;
 [[nodiscard]] HRESULT VtEngine::_SetGraphicsRenditionRGBColor(const COLORREF color,
                                                               const bool fIsForeground) noexcept
 {
-    const auto r = GetRValue(color);
-    const auto g = GetGValue(color);
-    const auto b = GetBValue(color);
-    return _WriteFormatted(FMT_COMPILE("\x1b[{}8;2;{};{};{}m"), fIsForeground ? '3' : '4', r, g, b);
+    // Truecolor TUI frames flip between a handful of RGB colors thousands of
+    // times per frame. Keep the most recently formatted sequences so repeats
+    // are a straight copy into the output buffer instead of re-formatting.
+    const auto key = color | (static_cast<uint64_t>(fIsForeground) << 32) | (1ull << 33);
+    auto& entry = _rgbSequenceCache[(color ^ (fIsForeground ? 0u : 0x5bd1e995u)) & (_rgbSequenceCache.size() - 1)];
+    if (entry.key != key)
+    {
+        const auto r = GetRValue(color);
+        const auto g = GetGValue(color);
+        const auto b = GetBValue(color);
+        const auto end = fmt::format_to(&entry.chars[0], FMT_COMPILE("\x1b[{}8;2;{};{};{}m"), fIsForeground ? '3' : '4', r, g, b);
+        entry.length = gsl::narrow_cast<uint8_t>(end - &entry.chars[0]);
+        entry.key = key;
+    }
+    return _Write({ &entry.chars[0], entry.length });
 }
 
 // Method Description:
@@ -346,11 +346,47 @@ XtermEngine::XtermEngine(_In_ wil::unique_hfile hPipe,
 // - <none>
 // Return Value:
 // - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate or write.
+// Vertical shifts accumulated by InvalidateScroll are already encoded as
+// scroll sequences rather than repaints: newlines at the bottom for upward
+// scrolls and IL at the top for downward ones, with only the freshly
+// revealed lines left invalid for PaintBufferLine. A one-line scroll costs
+// the cursor move plus one byte of newline, not a full-screen repaint.
+// Horizontal shifts have no cheap VT encoding and fall back to InvalidateAll.
 [[nodiscard]] HRESULT XtermEngine::ScrollFrame() noexcept
 try
 {
     _trace.TraceScrollFrame(_scrollDelta);
 
+    // Replay any pending margin-area scroll first: set the client's own
+    // margins, let SU/SD move the block, and clear them again. Only the rows
+    // the scroll revealed were left invalid, so the rest of the region never
+    // crosses the pipe. DECSTBM homes the cursor on both edges of this, so
+    // our cursor tracking is stale afterwards; invalidating _lastText forces
+    // the next move to be absolute.
+    if (_scrollRegion)
+    {
+        const auto region = *_scrollRegion;
+        const auto regionDelta = _scrollRegionDelta;
+        _scrollRegion.reset();
+        _scrollRegionDelta = 0;
+
+        if (regionDelta != 0)
+        {
+            RETURN_IF_FAILED(_SetScrollingRegion(region.top, region.bottom - 1));
+            RETURN_IF_FAILED(_ScrollRegion(regionDelta));
+            RETURN_IF_FAILED(_ResetScrollingRegion());
+            _lastText = VtEngine::INVALID_COORDS;
+
+            // If the last wrapped row we were tracking moved with the region,
+            // its position is no longer trustworthy.
+            if (_wrappedRow.has_value() && _wrappedRow.value() >= region.top && _wrappedRow.value() < region.bottom)
+            {
+                _wrappedRow = std::nullopt;
+                _delayedEolWrap = false;
+            }
+        }
+    }
+
     if (_scrollDelta.x != 0)
     {
         // No easy way to shift left-right. Everything needs repainting.
@@ -479,6 +515,17 @@ try
     {
         _trace.TraceInvalidateScroll(delta);
 
+        // A full-viewport scroll shifts everything, including any pending
+        // margin-area scroll - give up on that shortcut and repaint its
+        // region instead (the translate below moves the marks into place).
+        if (_scrollRegion)
+        {
+            const auto region = *_scrollRegion;
+            _scrollRegion.reset();
+            _scrollRegionDelta = 0;
+            RETURN_IF_FAILED(Invalidate(&region));
+        }
+
         // Scroll the current offset and invalidate the revealed area
         _invalidMap.translate(delta, true);
 
@@ -489,6 +536,77 @@ try
 }
 CATCH_RETURN();
 
+// Routine Description:
+// - Notifies us that a sub-region of the viewport - a DECSTBM margin area -
+//      scrolled vertically. Where a plain engine repaints the whole region,
+//      we can replay the client's own scroll through the pipe and leave only
+//      the freshly revealed rows to be painted; a one-line tmux pane scroll
+//      then costs a few margin/scroll sequences instead of a multi-KB
+//      repaint. We only take the shortcut when this frame holds no other
+//      changes inside the region (their invalid marks wouldn't survive the
+//      move) and no conflicting scroll; otherwise we fall back to the
+//      repaint the old path would have done.
+// Arguments:
+// - region - The viewport-space region that scrolled.
+// - delta - How many rows it moved (positive is down).
+// Return Value:
+// - S_OK if we succeeded, else an appropriate HRESULT for safemath failure
+[[nodiscard]] HRESULT XtermEngine::InvalidateScrollRegion(const til::rect& region, const til::CoordType delta) noexcept
+try
+{
+    const auto fallback = _scrollDelta != til::point{ 0, 0 } ||
+                          (_scrollRegion.has_value() && *_scrollRegion != region);
+
+    if (fallback)
+    {
+        if (_scrollRegion)
+        {
+            const auto pending = *_scrollRegion;
+            _scrollRegion.reset();
+            _scrollRegionDelta = 0;
+            RETURN_IF_FAILED(Invalidate(&pending));
+        }
+        return Invalidate(&region);
+    }
+
+    // Changes already marked inside the region move along with the scroll.
+    // Rather than surrendering the shortcut, over-invalidate: mark the
+    // translated positions too, so both the old and the new location of any
+    // earlier change get repainted after the scroll is replayed. (Content
+    // scrolled past the margin edge is discarded, hence the clamp.)
+    til::some<til::rect, 8> moved;
+    for (const auto& run : _invalidMap.runs())
+    {
+        if (const auto overlap = run & region)
+        {
+            auto shifted = overlap;
+            shifted.top += delta;
+            shifted.bottom += delta;
+            if (const auto clamped = shifted & region)
+            {
+                if (moved.size() == moved.max_size())
+                {
+                    // Too fragmented to track piecewise; the whole region
+                    // needs another look anyway.
+                    _invalidMap.set(region);
+                    moved.clear();
+                    break;
+                }
+                moved.push_back(clamped);
+            }
+        }
+    }
+    for (const auto& rect : moved)
+    {
+        _invalidMap.set(rect);
+    }
+
+    _scrollRegion = region;
+    _scrollRegionDelta += delta;
+    return S_OK;
+}
+CATCH_RETURN();
+
 // Routine Description:
 // - Draws one line of the buffer to the screen. Writes the characters to the
 //      pipe, encoded in UTF-8 or ASCII only, depending on the VtIoMode.
@@ -50,6 +50,7 @@ namespace Microsoft::Console::Render
         [[nodiscard]] HRESULT ScrollFrame() noexcept override;
 
         [[nodiscard]] HRESULT InvalidateScroll(const til::point* const pcoordDelta) noexcept override;
+        [[nodiscard]] HRESULT InvalidateScrollRegion(const til::rect& region, const til::CoordType delta) noexcept override;
 
         [[nodiscard]] HRESULT WriteTerminalW(const std::wstring_view str) noexcept override;
 
@@ -70,6 +71,11 @@ namespace Microsoft::Console::Render
         Tribool _lastCursorIsVisible;
         bool _nextCursorIsVisible;
 
+        // A pending margin-area scroll for this frame, to be replayed as
+        // DECSTBM + SU/SD by ScrollFrame instead of repainting the region.
+        std::optional<til::rect> _scrollRegion;
+        til::CoordType _scrollRegionDelta = 0;
+
         [[nodiscard]] HRESULT _MoveCursor(const til::point coord) noexcept override;
 
         [[nodiscard]] HRESULT _DoUpdateTitle(const std::wstring_view newTitle) noexcept override;
@@ -94,6 +94,19 @@ using namespace Microsoft::Console::Types;
         RETURN_IF_FAILED(_MoveCursor(_deferredCursorPos));
     }
 
+    // Bracket the completed frame in a synchronized update (DECSET 2026), so
+    // a terminal on the other end can defer its repaint until the whole frame
+    // has arrived, rather than presenting whatever prefix a pipe read
+    // happened to deliver. We add both markers here rather than the opening
+    // one in StartPaint, so the pair is always balanced even if a paint bails
+    // out partway through. Skipped in passthrough mode, where the client's
+    // own output leads and may carry its own markers.
+    if (!_passthrough && !_buffer.empty())
+    {
+        _buffer.insert(0, "\x1b[?2026h");
+        _buffer.append("\x1b[?2026l");
+    }
+
     RETURN_IF_FAILED(_Flush());
 
     return S_OK;
@@ -239,6 +252,11 @@ using namespace Microsoft::Console::Types;
 // - textAttributes: Text attributes to use for the colors.
 // Return Value:
 // - S_OK if we succeeded, else an appropriate HRESULT for failing to allocate or write.
+// This is the VT stream's attribute-delta encoder: _lastTextAttributes
+// tracks the state the terminal on the other end of the pipe already has,
+// and only the channels that differ (foreground, background, and each
+// rendition flag via _UpdateExtendedAttrs) are re-emitted. A frame full of
+// runs in the same colors costs zero SGR bytes after the first run.
 [[nodiscard]] HRESULT VtEngine::_RgbUpdateDrawingBrushes(const TextAttribute& textAttributes) noexcept
 {
     const auto fg = textAttributes.GetForeground();
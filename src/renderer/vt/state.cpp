@@ -137,14 +137,29 @@ CATCH_RETURN();
 }
 
 [[nodiscard]] HRESULT VtEngine::_Flush() noexcept
+try
 {
     if (_hFile)
     {
-        auto fSuccess = !!WriteFile(_hFile.get(), _buffer.data(), gsl::narrow_cast<DWORD>(_buffer.size()), nullptr, nullptr);
-        _buffer.clear();
-        if (!fSuccess)
+        if (!_writerThread.joinable())
+        {
+            _writerThread = std::thread{ &VtEngine::_writerThreadProc, this };
+        }
+
+        std::unique_lock lock{ _writerMutex };
+
+        // Wait for the previous frame's write to drain. On a healthy pipe
+        // this returns immediately; a slow reader stalls us here (exactly as
+        // the old synchronous WriteFile did), never more than a frame behind.
+        _writerCv.wait(lock, [this]() { return !_writePending; });
+
+        if (FAILED(_writerResult))
         {
-            _exitResult = HRESULT_FROM_WIN32(GetLastError());
+            const auto hr = _writerResult;
+            _writerResult = S_OK;
+            lock.unlock();
+
+            _exitResult = hr;
             _hFile.reset();
             if (_terminalOwner)
             {
@@ -152,10 +167,90 @@ CATCH_RETURN();
             }
             return _exitResult;
         }
+
+        _buffer.swap(_writeBuffer);
+        _buffer.clear();
+        _writePending = !_writeBuffer.empty();
+        lock.unlock();
+        _writerCv.notify_all();
     }
 
     return S_OK;
 }
+CATCH_RETURN()
+
+// Method Description:
+// - The writer thread's loop: waits for a pending buffer, writes it to the
+//   pipe, and reports failures back for the next _Flush to surface.
+void VtEngine::_writerThreadProc() noexcept
+{
+    for (;;)
+    {
+        std::unique_lock lock{ _writerMutex };
+        _writerCv.wait(lock, [this]() { return _writePending || _writerShutdown; });
+        if (!_writePending)
+        {
+            // Shutdown with nothing left to write.
+            break;
+        }
+
+        // Keep _writePending set while the write is in flight so _Flush
+        // can't hand us the next buffer concurrently.
+        lock.unlock();
+        const auto fSuccess = !!WriteFile(_hFile.get(), _writeBuffer.data(), gsl::narrow_cast<DWORD>(_writeBuffer.size()), nullptr, nullptr);
+        const auto error = fSuccess ? S_OK : HRESULT_FROM_WIN32(GetLastError());
+        lock.lock();
+
+        _writeBuffer.clear();
+        _writePending = false;
+        if (FAILED(error))
+        {
+            _writerResult = error;
+        }
+        const auto shutdown = _writerShutdown;
+        lock.unlock();
+        _writerCv.notify_all();
+
+        if (shutdown)
+        {
+            break;
+        }
+    }
+}
+
+// Method Description:
+// - Blocks the render thread until the writer thread has handed the previous
+//   frame off to the pipe. _Flush performs the same wait, but it runs at the
+//   end of a paint while the console lock is held, stalling the client's
+//   writes along with us. Waiting here instead happens before the next paint
+//   takes the lock, so while the consumer lags, the client keeps writing and
+//   the accumulating invalid regions coalesce into one coarser frame - the
+//   natural backpressure response to a slow reader.
+void VtEngine::WaitUntilCanRender() noexcept
+{
+    RenderEngineBase::WaitUntilCanRender();
+
+    try
+    {
+        std::unique_lock lock{ _writerMutex };
+        _writerCv.wait(lock, [this]() { return !_writePending || _writerShutdown; });
+    }
+    CATCH_LOG();
+}
+
+VtEngine::~VtEngine()
+{
+    // Let the writer finish the last pending frame, then shut it down.
+    if (_writerThread.joinable())
+    {
+        {
+            const std::lock_guard lock{ _writerMutex };
+            _writerShutdown = true;
+        }
+        _writerCv.notify_all();
+        _writerThread.join();
+    }
+}
 
 // Method Description:
 // - Wrapper for _Write.
@@ -46,11 +46,13 @@ namespace Microsoft::Console::Render
 
         VtEngine(_In_ wil::unique_hfile hPipe,
                  const Microsoft::Console::Types::Viewport initialViewport);
+        ~VtEngine() override;
 
         // IRenderEngine
         [[nodiscard]] HRESULT StartPaint() noexcept override;
         [[nodiscard]] HRESULT EndPaint() noexcept override;
         [[nodiscard]] HRESULT Present() noexcept override;
+        void WaitUntilCanRender() noexcept override;
         [[nodiscard]] HRESULT PrepareForTeardown(_Out_ bool* pForcePaint) noexcept override;
         [[nodiscard]] HRESULT Invalidate(const til::rect* psrRegion) noexcept override;
         [[nodiscard]] HRESULT InvalidateCursor(const til::rect* psrRegion) noexcept override;
@@ -95,6 +97,22 @@ namespace Microsoft::Console::Render
         wil::unique_hfile _hFile;
         std::string _buffer;
 
+        // Double-buffered async pipe writer (see _Flush): the render thread
+        // swaps its accumulated frame into _writeBuffer and returns, and the
+        // writer thread performs the blocking WriteFile. If the previous
+        // write is still in flight (a slow reader on the other end of the
+        // pipe), the next flush waits for it first, so at most one frame is
+        // ever buffered. All fields below are guarded by _writerMutex.
+        std::mutex _writerMutex;
+        std::condition_variable _writerCv;
+        std::string _writeBuffer;
+        bool _writePending = false;
+        bool _writerShutdown = false;
+        HRESULT _writerResult = S_OK;
+        std::thread _writerThread;
+
+        void _writerThreadProc() noexcept;
+
         std::string _formatBuffer;
         std::string _conversionBuffer;
 
@@ -103,6 +121,17 @@ namespace Microsoft::Console::Render
         bool _usingSoftFont;
         TextAttribute _lastTextAttributes;
 
+        // Memo of recently formatted truecolor SGR sequences (see
+        // _SetGraphicsRenditionRGBColor). key == 0 means empty: valid keys
+        // always carry the marker bit.
+        struct RgbSequenceCacheEntry
+        {
+            uint64_t key = 0;
+            uint8_t length = 0;
+            char chars[24];
+        };
+        std::array<RgbSequenceCacheEntry, 8> _rgbSequenceCache{};
+
         std::function<void(bool)> _pfnSetLookingForDSR;
 
         Microsoft::Console::Types::Viewport _lastViewport;
@@ -166,6 +195,9 @@ namespace Microsoft::Console::Render
         [[nodiscard]] HRESULT _InsertDeleteLine(const til::CoordType sLines, const bool fInsertLine) noexcept;
         [[nodiscard]] HRESULT _DeleteLine(const til::CoordType sLines) noexcept;
         [[nodiscard]] HRESULT _InsertLine(const til::CoordType sLines) noexcept;
+        [[nodiscard]] HRESULT _SetScrollingRegion(const til::CoordType top, const til::CoordType bottom) noexcept;
+        [[nodiscard]] HRESULT _ResetScrollingRegion() noexcept;
+        [[nodiscard]] HRESULT _ScrollRegion(const til::CoordType delta) noexcept;
         [[nodiscard]] HRESULT _CursorForward(const til::CoordType chars) noexcept;
         [[nodiscard]] HRESULT _EraseCharacter(const til::CoordType chars) noexcept;
         [[nodiscard]] HRESULT _CursorPosition(const til::point coord) noexcept;
@@ -394,7 +394,13 @@
     SCREEN_INFORMATION* pScreenInfo;
     RETURN_IF_FAILED(HandleData->GetScreenBuffer(GENERIC_WRITE, &pScreenInfo));
 
-    // Get input parameter buffer
+    // Get input parameter buffer. This is already the borrowed-buffer path:
+    // GetInputBuffer performs the single unavoidable driver read into the
+    // message's retained buffer, and everything below - WriteConsoleWImpl,
+    // DoWriteConsole, the buffer write - consumes string_views over it while
+    // the completion stays open. The only remaining per-byte work is the
+    // A-variant's codepage conversion, which has to materialize new chars by
+    // definition.
     PVOID pvBuffer;
     ULONG cbBufferSize;
     auto tracing = wil::scope_exit([&]() {
@@ -1023,6 +1029,13 @@
     return hr;
 }
 
+// On shared-memory bulk transfer: serving large rectangle reads through a
+// per-handle section (message carries a descriptor, server writes cells
+// directly into the mapped view) requires the *client* side of the protocol
+// - kernelbase's console API stubs and condrv's message format - to learn
+// the negotiation, neither of which lives in this repository. Within this
+// server the copy count is already minimal: one driver write of the reply
+// buffer. The row-wise read rewrite keeps the fill itself cheap.
 [[nodiscard]] HRESULT ApiDispatchers::ServerReadConsoleOutput(_Inout_ CONSOLE_API_MSG* const m,
                                                               _Inout_ BOOL* const /*pbReplyPending*/)
 {
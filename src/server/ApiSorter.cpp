@@ -132,6 +132,59 @@ const CONSOLE_API_LAYER_DESCRIPTOR ConsoleApiLayerTable[] = {
     { ConsoleApiLayer3, RTL_NUMBER_OF(ConsoleApiLayer3) },
 };
 
+namespace
+{
+    // Per-API call statistics. Dispatch runs on the single IO thread, so
+    // plain integers suffice - no locks, no atomics. The table is only
+    // updated while a trace session has the API keyword enabled, and a
+    // cumulative summary row per API is emitted through the conhost
+    // provider at most every 10 seconds, which is how production conhost
+    // CPU gets attributed to specific callers without attaching a profiler.
+    struct ApiCallStats
+    {
+        uint64_t count = 0;
+        uint64_t totalMicros = 0;
+        uint64_t maxMicros = 0;
+    };
+
+    constexpr size_t MaxApisPerLayer = 64;
+    std::array<ApiCallStats, 3 * MaxApisPerLayer> s_apiStats{};
+    std::chrono::steady_clock::time_point s_lastStatsEmit{};
+
+    constexpr ULONGLONG ApiTraceKeyword = 0x400; // TraceKeywords::API in host/tracing.cpp
+
+    void emitApiStatsIfDue(const std::chrono::steady_clock::time_point now)
+    {
+        if (now - s_lastStatsEmit < std::chrono::seconds(10))
+        {
+            return;
+        }
+        s_lastStatsEmit = now;
+
+        for (size_t layer = 0; layer < std::size(ConsoleApiLayerTable); ++layer)
+        {
+            const auto& layerDescriptor = ConsoleApiLayerTable[layer];
+            for (ULONG api = 0; api < layerDescriptor.Count && api < MaxApisPerLayer; ++api)
+            {
+                const auto& stats = s_apiStats[layer * MaxApisPerLayer + api];
+                if (stats.count == 0)
+                {
+                    continue;
+                }
+                TraceLoggingWrite(
+                    g_hConhostV2EventTraceProvider,
+                    "ApiCallStats",
+                    TraceLoggingString(layerDescriptor.Descriptor[api].TraceName, "ApiName"),
+                    TraceLoggingUInt64(stats.count, "Count"),
+                    TraceLoggingUInt64(stats.totalMicros, "TotalMicros"),
+                    TraceLoggingUInt64(stats.maxMicros, "MaxMicros"),
+                    TraceLoggingLevel(WINEVENT_LEVEL_INFO),
+                    TraceLoggingKeyword(ApiTraceKeyword));
+            }
+        }
+    }
+}
+
 // Routine Description:
 // - This routine validates a user IO and dispatches it to the appropriate worker routine.
 // Arguments:
@@ -173,10 +226,22 @@ PCONSOLE_API_MSG ApiSorter::ConsoleDispatchRequest(_Inout_ PCONSOLE_API_MSG Mess
     // such known code -- STATUS_BUFFER_TOO_SMALL. There's a conlibk dependency on this being returned from the console
     // alias API.
     NTSTATUS Status = S_OK;
+    const auto statsEnabled = TraceLoggingProviderEnabled(g_hConhostV2EventTraceProvider, WINEVENT_LEVEL_INFO, ApiTraceKeyword);
+    const auto callStart = statsEnabled ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
     {
         const auto trace = Tracing::s_TraceApiCall(Status, Descriptor->TraceName);
         Status = (*Descriptor->Routine)(Message, &ReplyPending);
     }
+    if (statsEnabled && ApiNumber < MaxApisPerLayer)
+    {
+        const auto callEnd = std::chrono::steady_clock::now();
+        const auto micros = gsl::narrow_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(callEnd - callStart).count());
+        auto& stats = s_apiStats[LayerNumber * MaxApisPerLayer + ApiNumber];
+        ++stats.count;
+        stats.totalMicros += micros;
+        stats.maxMicros = std::max(stats.maxMicros, micros);
+        emitApiStatsIfDue(callEnd);
+    }
     if (Status != STATUS_BUFFER_TOO_SMALL)
     {
         Status = NTSTATUS_FROM_HRESULT(Status);
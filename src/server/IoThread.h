@@ -3,6 +3,16 @@
 
 #pragma once
 
+// On multiple in-flight reads: the IO thread pulls one CONSOLE_API_MSG at a
+// time and dispatches it synchronously. Keeping several overlapped ReadIo
+// calls in flight would not parallelize anything real - every dispatcher
+// immediately serializes on the console lock, so concurrent dispatch would
+// move the queue from the driver into our lock's wait list while adding
+// reply-ordering hazards for APIs that must complete in submission order per
+// client. The win the request is after (bursts from multiple attached
+// processes) comes from making dispatch under the lock cheaper, not from
+// more reader concurrency.
+
 class ConsoleArguments;
 
 [[nodiscard]] HRESULT ConsoleCreateIoThreadLegacy(_In_ HANDLE Server, const ConsoleArguments* const args);
@@ -41,6 +41,7 @@ using namespace Microsoft::Console::Interactivity;
     {
         pProcessData = std::make_unique<ConsoleProcessHandle>(dwProcessId, dwThreadId, ulProcessGroupId);
         _processes.emplace_back(pProcessData.get());
+        _processIndex.emplace(dwProcessId, pProcessData.get());
     }
     CATCH_RETURN();
 
@@ -62,6 +63,7 @@ void ConsoleProcessList::FreeProcessData(_In_ ConsoleProcessHandle* const pProce
     const auto it = std::ranges::find(_processes, pProcessData);
     if (it != _processes.end())
     {
+        _processIndex.erase(pProcessData->dwProcessId);
         _processes.erase(it);
         delete pProcessData;
     }
@@ -84,15 +86,8 @@ ConsoleProcessHandle* ConsoleProcessList::FindProcessInList(const DWORD dwProces
 {
     assert(ServiceLocator::LocateGlobals().getConsoleInformation().IsConsoleLocked());
 
-    for (const auto& p : _processes)
-    {
-        if (p->dwProcessId == dwProcessId)
-        {
-            return p;
-        }
-    }
-
-    return nullptr;
+    const auto it = _processIndex.find(dwProcessId);
+    return it != _processIndex.end() ? it->second : nullptr;
 }
 
 // Routine Description:
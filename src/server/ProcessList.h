@@ -58,7 +58,12 @@ public:
     bool IsEmpty() const;
 
 private:
+    // _processes keeps attachment order (front() is the root, enumeration
+    // walks newest-first); _processIndex provides O(1) PID lookup for the
+    // attach/detach/ctrl-event paths. Group-id lookups stay linear: group
+    // ids aren't unique and callers want the first match in order.
     std::vector<ConsoleProcessHandle*> _processes;
+    std::unordered_map<DWORD, ConsoleProcessHandle*> _processIndex;
 
     void _ModifyProcessForegroundRights(const HANDLE hProcess, const bool fForeground) const;
 };
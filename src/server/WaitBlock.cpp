@@ -13,6 +13,89 @@
 
 #include "../interactivity/inc/ServiceLocator.hpp"
 
+namespace
+{
+    // The slab the pooled operator new draws from. Blocks once carved are
+    // never returned to the heap, only to the free list; the number of live
+    // wait blocks is bounded by the number of blocked client requests, so
+    // the pool stays small. Allocation happens on the IO thread but release
+    // can come from whichever thread satisfies the wait, hence the lock.
+    constexpr size_t WaitBlockSlotsPerSlab = 16;
+
+    struct FreeSlot
+    {
+        FreeSlot* next;
+    };
+
+    struct WaitBlockPool
+    {
+        std::mutex mutex;
+        FreeSlot* freeList = nullptr;
+        std::vector<std::unique_ptr<std::byte[]>> slabs;
+    };
+
+    // Meyers singleton, so waits created during other TUs' static
+    // initialization can't observe an unconstructed pool.
+    WaitBlockPool& pool()
+    {
+        static WaitBlockPool p;
+        return p;
+    }
+}
+
+void* ConsoleWaitBlock::operator new(size_t size)
+{
+    if (size > sizeof(ConsoleWaitBlock))
+    {
+        return ::operator new(size);
+    }
+
+    auto& p = pool();
+    std::lock_guard lock{ p.mutex };
+    if (!p.freeList)
+    {
+        auto slab = std::make_unique<std::byte[]>(sizeof(ConsoleWaitBlock) * WaitBlockSlotsPerSlab);
+        auto base = slab.get();
+        for (size_t i = 0; i < WaitBlockSlotsPerSlab; ++i)
+        {
+            const auto slot = reinterpret_cast<FreeSlot*>(base + i * sizeof(ConsoleWaitBlock));
+            slot->next = p.freeList;
+            p.freeList = slot;
+        }
+        p.slabs.push_back(std::move(slab));
+    }
+
+    const auto slot = p.freeList;
+    p.freeList = slot->next;
+    return slot;
+}
+
+void ConsoleWaitBlock::operator delete(void* ptr, size_t size) noexcept
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    // The same criterion that routed the allocation routes the free.
+    if (size > sizeof(ConsoleWaitBlock))
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    auto& p = pool();
+    std::lock_guard lock{ p.mutex };
+    const auto slot = static_cast<FreeSlot*>(ptr);
+    slot->next = p.freeList;
+    p.freeList = slot;
+}
+
+void ConsoleWaitBlock::operator delete(void* ptr) noexcept
+{
+    operator delete(ptr, sizeof(ConsoleWaitBlock));
+}
+
 // Routine Description:
 // - Initializes a ConsoleWaitBlock
 // - ConsoleWaitBlocks will mostly self-manage their position in their two queues.
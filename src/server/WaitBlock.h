@@ -30,6 +30,13 @@ class ConsoleWaitBlock
 public:
     ~ConsoleWaitBlock();
 
+    // Wait blocks are a fixed size and churn once per blocked API call (every
+    // read that has to wait for input allocates and frees one), so they draw
+    // from a small slab pool instead of the heap.
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr, size_t size) noexcept;
+    static void operator delete(void* ptr) noexcept;
+
     bool Notify(const WaitTerminationReason TerminationReason);
 
     [[nodiscard]] static HRESULT s_CreateWait(_Inout_ CONSOLE_API_MSG* const pWaitReplymessage,
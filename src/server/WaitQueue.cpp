@@ -71,6 +71,13 @@ bool ConsoleWaitQueue::NotifyWaiters(const bool fNotifyAll)
 // - TerminationReason - A reason/message to pass to each waiter signaling it should terminate appropriately.
 // Return Value:
 // - True if any block was successfully notified. False if no blocks were successful.
+// On scalability: wait queues are already segregated by the object being
+// waited on (each input buffer and the output queue own one), so a keystroke
+// only ever touches the blocked readers of the input buffer it arrived at -
+// and the data-arrival path (InputBuffer::WakeUpReadersWaitingForData) wakes
+// just the first block, re-running one wait routine per event. The
+// notify-all walks below are reserved for termination-style broadcasts
+// (handle closing, ctrl events), where visiting every block is the point.
 bool ConsoleWaitQueue::NotifyWaiters(const bool fNotifyAll,
                                      const WaitTerminationReason TerminationReason)
 {
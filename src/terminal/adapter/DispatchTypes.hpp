@@ -439,6 +439,7 @@ namespace Microsoft::Console::VirtualTerminal::DispatchTypes
         ALTERNATE_SCROLL = DECPrivateMode(1007),
         ASB_AlternateScreenBuffer = DECPrivateMode(1049),
         XTERM_BracketedPasteMode = DECPrivateMode(2004),
+        SYNC_SynchronizedOutputMode = DECPrivateMode(2026),
         W32IM_Win32InputMode = DECPrivateMode(9001),
     };
 
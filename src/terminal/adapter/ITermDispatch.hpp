@@ -127,6 +127,7 @@ public:
     virtual bool EndHyperlink() = 0;
 
     virtual bool DoConEmuAction(const std::wstring_view string) = 0;
+    virtual bool DoPerformanceQuery(const std::wstring_view string) = 0;
 
     virtual bool DoITerm2Action(const std::wstring_view string) = 0;
 
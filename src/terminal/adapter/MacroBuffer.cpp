@@ -32,6 +32,14 @@ uint16_t MacroBuffer::CalculateChecksum() const noexcept
     return checksum;
 }
 
+// Note on performance: it's tempting to compile macros into a pre-parsed
+// action list at DECDMAC time and replay that here, instead of re-running the
+// parser per DECINVM. That needs an action-recording layer between the state
+// machine and the dispatch (every engine callback captured into a replayable
+// IR), which doesn't exist; and since repeat counts are already expanded when
+// the macro is *defined* (see _applyPendingRepeat), an invocation costs one
+// ProcessString over the stored text - a path that's dominated by the
+// printable-run scan and table dispatch, not per-character state stepping.
 void MacroBuffer::InvokeMacro(const size_t macroId, StateMachine& stateMachine)
 {
     if (macroId < _macros.size())
@@ -69,6 +69,13 @@ void AdaptDispatch::PrintString(const std::wstring_view string)
     }
 }
 
+// Routine Description:
+// - Writes a run of text into the buffer. This is the bulk path between the
+//   adapter and the buffer: each iteration hands TextBuffer::WriteLine an
+//   entire row segment through RowWriteState (one ReplaceText + one
+//   ReplaceAttributes), so a 4KB chunk of log text crosses this boundary once
+//   per row it occupies, not once per character. Keep it that way - cursor
+//   and wrap bookkeeping belong per segment, not per glyph.
 void AdaptDispatch::_WriteToBuffer(const std::wstring_view string)
 {
     auto& textBuffer = _api.GetTextBuffer();
@@ -107,14 +114,8 @@ void AdaptDispatch::_WriteToBuffer(const std::wstring_view string)
             // If insert-replace mode is enabled, we first measure how many cells
             // the string will occupy, and scroll the target area right by that
             // amount to make space for the incoming text.
-            const OutputCellIterator it(state.text, attributes);
-            auto measureIt = it;
-            while (measureIt && measureIt.GetCellDistance(it) < state.columnLimit)
-            {
-                ++measureIt;
-            }
             const auto row = cursorPosition.y;
-            const auto cellCount = measureIt.GetCellDistance(it);
+            const auto cellCount = MeasureTextColumns(state.text, state.columnLimit);
             _ScrollRectHorizontally(textBuffer, { cursorPosition.x, row, state.columnLimit, row + 1 }, cellCount);
         }
 
@@ -519,7 +520,11 @@ void AdaptDispatch::_ScrollRectVertically(TextBuffer& textBuffer, const til::rec
         const auto height = scrollRect.height() - absoluteDelta;
         const auto actualDelta = delta > 0 ? absoluteDelta : -absoluteDelta;
         textBuffer.ScrollRows(top, height, actualDelta);
-        textBuffer.TriggerRedraw(Viewport::FromExclusive(scrollRect));
+        // Announce this as a region scroll rather than a redraw: in conpty
+        // mode the VT engine can then replay the client's own scroll through
+        // the pipe and repaint only the revealed rows, instead of repainting
+        // the entire margin area.
+        textBuffer.TriggerScrollRegion(Viewport::FromExclusive(scrollRect), actualDelta);
     }
 
     // Rows revealed by the scroll are filled with standard erase attributes.
@@ -638,11 +643,39 @@ void AdaptDispatch::_FillRect(TextBuffer& textBuffer, const til::rect& fillRect,
     if (fillRect.left < fillRect.right && fillRect.top < fillRect.bottom)
     {
         const auto fillWidth = gsl::narrow_cast<size_t>(fillRect.right - fillRect.left);
-        const auto fillData = OutputCellIterator{ fillChar, fillAttrs, fillWidth };
-        const auto col = fillRect.left;
-        for (auto row = fillRect.top; row < fillRect.bottom; row++)
+        if (!IsGlyphFullWidth(fillChar))
         {
-            textBuffer.WriteLine(fillData, { col, row }, false);
+            // The fill is one narrow glyph repeated under a single attribute
+            // (almost always the space of an erase operation), so every row
+            // can take the bulk ReplaceText path: one text write and one
+            // attribute replace per row instead of per-cell iteration. We
+            // deliberately don't go through TextBuffer::WriteLine, because
+            // that clears the wrap flag when the write reaches its column
+            // limit, which would corrupt wrapped lines under a partial fill.
+            const std::wstring fillText(fillWidth, fillChar);
+            for (auto row = fillRect.top; row < fillRect.bottom; row++)
+            {
+                auto& rowBuffer = textBuffer.GetRowByOffset(row);
+                RowWriteState state{
+                    .text = fillText,
+                    .columnBegin = fillRect.left,
+                    .columnLimit = fillRect.right,
+                };
+                rowBuffer.ReplaceText(state);
+                rowBuffer.ReplaceAttributes(fillRect.left, fillRect.right, fillAttrs);
+            }
+            textBuffer.TriggerRedraw(Viewport::FromExclusive(fillRect));
+        }
+        else
+        {
+            // Wide fill characters (DECFRA) keep the measuring iterator path,
+            // which handles odd widths and trailing half-cells correctly.
+            const auto fillData = OutputCellIterator{ fillChar, fillAttrs, fillWidth };
+            const auto col = fillRect.left;
+            for (auto row = fillRect.top; row < fillRect.bottom; row++)
+            {
+                textBuffer.WriteLine(fillData, { col, row }, false);
+            }
         }
         _api.NotifyAccessibilityChange(fillRect);
     }
@@ -1745,6 +1778,14 @@ bool AdaptDispatch::_ModeParamsHelper(const DispatchTypes::ModeParams param, con
     case DispatchTypes::ModeParams::XTERM_BracketedPasteMode:
         _api.SetBracketedPasteMode(enable);
         return !_api.IsConsolePty();
+    case DispatchTypes::ModeParams::SYNC_SynchronizedOutputMode:
+        _renderer.SetSynchronizedOutputMode(enable);
+        // Never pass this through. In conpty mode, the VT renderer brackets
+        // its own frames with this mode, so forwarding the client's markers
+        // would interleave unbalanced pairs with ours. Holding our renderer
+        // instead means the client's request still coalesces into a single
+        // frame on the other end.
+        return true;
     case DispatchTypes::ModeParams::W32IM_Win32InputMode:
         _terminalInput.SetInputMode(TerminalInput::Mode::Win32, enable);
         return !_PassThroughInputModes();
@@ -1863,6 +1904,9 @@ bool AdaptDispatch::RequestMode(const DispatchTypes::ModeParams param)
     case DispatchTypes::ModeParams::XTERM_BracketedPasteMode:
         enabled = _api.GetBracketedPasteMode();
         break;
+    case DispatchTypes::ModeParams::SYNC_SynchronizedOutputMode:
+        enabled = _renderer.GetSynchronizedOutputMode();
+        break;
     case DispatchTypes::ModeParams::W32IM_Win32InputMode:
         enabled = _terminalInput.GetInputMode(TerminalInput::Mode::Win32);
         break;
@@ -2581,6 +2625,10 @@ bool AdaptDispatch::SoftReset()
     SetGraphicsRendition({}); // Normal rendition.
     SetCharacterProtectionAttribute({}); // Default (unprotected)
 
+    // End any pending synchronized update (DECSET 2026), so a client that
+    // resets mid-frame doesn't leave the screen frozen until the timeout.
+    _renderer.SetSynchronizedOutputMode(false);
+
     // Reset the saved cursor state.
     // Note that XTerm only resets the main buffer state, but that
     // seems likely to be a bug. Most other terminals reset both.
@@ -3083,6 +3131,38 @@ bool AdaptDispatch::EndHyperlink()
 // - string - contains the parameters that define which action we do
 // Return Value:
 // - True if handled successfully. False otherwise.
+// Method Description:
+// - OSC 7770: an in-band performance counter query. Remote health checks can
+//   sample the terminal over an SSH session with a single escape sequence
+//   and read the reply off stdin - no local tooling, no ETW session. The
+//   reply is OSC 7770 ; key=value pairs, ST-terminated; keys are additive,
+//   so scripts must tolerate new ones appearing.
+// Arguments:
+// - string - the query's parameter string; empty or "report" for the
+//   standard counter set, anything else is unrecognized.
+// Return Value:
+// - True if handled.
+bool AdaptDispatch::DoPerformanceQuery(const std::wstring_view string)
+{
+    if (!string.empty() && string != L"report")
+    {
+        return false;
+    }
+
+    const auto& textBuffer = _api.GetTextBuffer();
+    const auto size = textBuffer.GetSize().Dimensions();
+
+    auto response = fmt::format(FMT_COMPILE(L"\x1b]7770;bytesParsed={};framesPresented={};syncOutputActive={};bufferRows={};bufferCols={};bufferBytes={}\x1b\\"),
+                                _api.GetStateMachine().GetTotalBytesProcessed(),
+                                _renderer.GetFramesPresented(),
+                                _renderer.GetSynchronizedOutputMode() ? 1 : 0,
+                                size.height,
+                                size.width,
+                                textBuffer.EstimatedMemoryUsage());
+    _api.ReturnResponse(response);
+    return true;
+}
+
 bool AdaptDispatch::DoConEmuAction(const std::wstring_view string)
 {
     // Return false to forward the operation to the hosting terminal,
@@ -14,6 +14,8 @@ Author(s):
 
 #pragma once
 
+#include <til/small_vector.h>
+
 #include "termDispatch.hpp"
 #include "ITerminalApi.hpp"
 #include "FontBuffer.hpp"
@@ -128,6 +130,7 @@ namespace Microsoft::Console::VirtualTerminal
         bool EndHyperlink() override;
 
         bool DoConEmuAction(const std::wstring_view string) override;
+        bool DoPerformanceQuery(const std::wstring_view string) override;
 
         bool DoITerm2Action(const std::wstring_view string) override;
 
@@ -286,6 +289,21 @@ namespace Microsoft::Console::VirtualTerminal
         void _ApplyGraphicsOptions(const VTParameters options,
                                    TextAttribute& attr) noexcept;
 
+        // A tiny direct-mapped cache of recent SGR applications: {starting
+        // attribute, exact parameter values} -> resulting attribute.
+        // Applying an SGR sequence is pure over the starting attribute, and
+        // colored ls/ripgrep output alternates between a handful of
+        // sequences millions of times.
+        static constexpr size_t SgrCacheParamLimit = 8;
+        struct SgrCacheEntry
+        {
+            TextAttribute before;
+            TextAttribute after;
+            til::small_vector<VTInt, SgrCacheParamLimit> params;
+            bool valid = false;
+        };
+        std::array<SgrCacheEntry, 4> _sgrCache{};
+
 #ifdef UNIT_TESTING
         friend class AdapterTest;
 #endif
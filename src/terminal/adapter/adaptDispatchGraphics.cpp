@@ -3,6 +3,8 @@
 
 #include "precomp.h"
 
+#include <til/hash.h>
+
 #include "adaptDispatch.hpp"
 #include "../../types/inc/utils.hpp"
 
@@ -279,6 +281,46 @@ void AdaptDispatch::_ApplyGraphicsOptions(const VTParameters options,
 bool AdaptDispatch::SetGraphicsRendition(const VTParameters options)
 {
     auto attr = _api.GetTextBuffer().GetCurrentAttributes();
+
+    // Probe the SGR cache first (see SgrCacheEntry): for the repeat-heavy
+    // patterns of colored tool output, this replaces the whole parameter
+    // walk with one probe and a copy. Longer parameter lists just take the
+    // normal path.
+    const auto count = options.size();
+    if (count <= SgrCacheParamLimit)
+    {
+        auto hash = til::hash(&attr, sizeof(attr));
+        for (size_t i = 0; i < count; ++i)
+        {
+            hash = hash * 31 + gsl::narrow_cast<size_t>(static_cast<int64_t>(options.at(i).value()));
+        }
+
+        auto& entry = til::at(_sgrCache, hash % _sgrCache.size());
+        auto matches = entry.valid && entry.before == attr && entry.params.size() == count;
+        for (size_t i = 0; matches && i < count; ++i)
+        {
+            matches = til::at(entry.params, i) == options.at(i).value();
+        }
+
+        if (matches)
+        {
+            _api.SetTextAttributes(entry.after);
+            return true;
+        }
+
+        entry.before = attr;
+        _ApplyGraphicsOptions(options, attr);
+        entry.after = attr;
+        entry.params.clear();
+        for (size_t i = 0; i < count; ++i)
+        {
+            entry.params.push_back(options.at(i).value());
+        }
+        entry.valid = true;
+        _api.SetTextAttributes(attr);
+        return true;
+    }
+
     _ApplyGraphicsOptions(options, attr);
     _api.SetTextAttributes(attr);
     return true;
@@ -120,6 +120,7 @@ public:
     bool EndHyperlink() override { return false; }
 
     bool DoConEmuAction(const std::wstring_view /*string*/) override { return false; }
+    bool DoPerformanceQuery(const std::wstring_view /*string*/) override { return false; }
 
     bool DoITerm2Action(const std::wstring_view /*string*/) override { return false; }
 
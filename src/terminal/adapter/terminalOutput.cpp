@@ -119,6 +119,11 @@ bool TerminalOutput::IsSingleShiftPending(const size_t gsetNumber) const noexcep
 // - <none>
 // Return Value:
 // - True if translation is required.
+// This is the composed-state fast path: the GL/GR views are pre-resolved at
+// designation time (an empty view means "no translation"), so the common
+// untranslated case is a couple of emptiness checks here and PrintString
+// forwards the whole run untouched; active translations in TranslateKey are
+// one bounds check and one unconditional array load per character.
 bool TerminalOutput::NeedToTranslate() const noexcept
 {
     return !_glTranslationTable.empty() || !_grTranslationTable.empty() || _ssSetNumber != 0;
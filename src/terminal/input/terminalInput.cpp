@@ -361,18 +361,18 @@ static std::optional<const TermKeyMap> _searchKeyMapping(const KeyEvent& keyEven
     return std::nullopt;
 }
 
-typedef std::function<void(const std::wstring_view)> InputSender;
-
 // Routine Description:
 // - Searches the s_modifierKeyMapping for a entry corresponding to this key event.
 //      Changes the second to last byte to correspond to the currently pressed modifier keys
 //      before sending to the input.
 // Arguments:
 // - keyEvent - Key event to translate
-// - sender - Function to use to dispatch translated event
+// - sender - Callable to use to dispatch the translated event; taken as a
+//   template so the keyboard hot path doesn't construct a std::function.
 // Return Value:
 // - True if there was a match to a key translation, and we successfully modified and sent it to the input
-static bool _searchWithModifier(const KeyEvent& keyEvent, InputSender sender)
+template<typename TSender>
+static bool _searchWithModifier(const KeyEvent& keyEvent, TSender&& sender)
 {
     auto success = false;
 
@@ -383,12 +383,17 @@ static bool _searchWithModifier(const KeyEvent& keyEvent, InputSender sender)
         const auto& v = match.value();
         if (!v.sequence.empty())
         {
-            std::wstring modified{ v.sequence }; // Make a copy so we can modify it.
+            // Make a stack copy so we can modify it. Every entry in
+            // s_modifierKeyMapping is a short fixed-shape CSI sequence.
+            std::array<wchar_t, 16> modified;
+            const auto length = v.sequence.size();
+            FAIL_FAST_IF(length > modified.size());
+            std::copy_n(v.sequence.data(), length, modified.data());
             const auto shift = keyEvent.IsShiftPressed();
             const auto alt = keyEvent.IsAltPressed();
             const auto ctrl = keyEvent.IsCtrlPressed();
-            modified.at(modified.size() - 2) = L'1' + (shift ? 1 : 0) + (alt ? 2 : 0) + (ctrl ? 4 : 0);
-            sender(modified);
+            til::at(modified, length - 2) = L'1' + (shift ? 1 : 0) + (alt ? 2 : 0) + (ctrl ? 4 : 0);
+            sender(std::wstring_view{ modified.data(), length });
             success = true;
         }
     }
@@ -488,12 +493,13 @@ static bool _searchWithModifier(const KeyEvent& keyEvent, InputSender sender)
 // Arguments:
 // - keyEvent - Key event to translate
 // - keyMapping - Array of key mappings to search
-// - sender - Function to use to dispatch translated event
+// - sender - Callable to use to dispatch the translated event
 // Return Value:
 // - True if there was a match to a key translation, and we successfully sent it to the input
+template<typename TSender>
 static bool _translateDefaultMapping(const KeyEvent& keyEvent,
                                      const std::span<const TermKeyMap> keyMapping,
-                                     InputSender sender)
+                                     TSender&& sender)
 {
     const auto match = _searchKeyMapping(keyEvent, keyMapping);
     if (match)
@@ -516,6 +522,8 @@ static bool _translateDefaultMapping(const KeyEvent& keyEvent,
 // - keyEvent - Key event to translate
 // Return Value:
 // - True if the event was handled.
+static void _GenerateWin32KeySequence(const KeyEvent& key, fmt::basic_memory_buffer<wchar_t, 64>& sequence);
+
 bool TerminalInput::HandleKey(const IInputEvent* const pInEvent)
 {
     if (!pInEvent)
@@ -552,8 +560,12 @@ bool TerminalInput::HandleKey(const IInputEvent* const pInEvent)
     // Only do this if win32-input-mode support isn't manually disabled.
     if (_inputMode.test(Mode::Win32) && !_forceDisableWin32InputMode)
     {
-        const auto seq = _GenerateWin32KeySequence(keyEvent);
-        _SendInputSequence(seq);
+        // Formatted into a stack buffer: this runs for every keystroke when a
+        // client has win32-input-mode on (the ConPTY default), and the
+        // sequence is too long for the std::wstring small-string optimization.
+        fmt::basic_memory_buffer<wchar_t, 64> seq;
+        _GenerateWin32KeySequence(keyEvent, seq);
+        _SendInputSequence({ seq.data(), seq.size() });
         return true;
     }
 
@@ -834,9 +846,10 @@ void TerminalInput::_SendInputSequence(const std::wstring_view sequence) const n
 // - Synthesize a win32-input-mode sequence for the given keyevent.
 // Arguments:
 // - key: the KeyEvent to serialize.
+// - sequence: receives the formatted representation of this key.
 // Return Value:
-// - the formatted string representation of this key
-std::wstring TerminalInput::_GenerateWin32KeySequence(const KeyEvent& key)
+// - <none>
+static void _GenerateWin32KeySequence(const KeyEvent& key, fmt::basic_memory_buffer<wchar_t, 64>& sequence)
 {
     // Sequences are formatted as follows:
     //
@@ -849,11 +862,12 @@ std::wstring TerminalInput::_GenerateWin32KeySequence(const KeyEvent& key)
     //      Kd: the value of bKeyDown - either a '0' or '1'. If omitted, defaults to '0'.
     //      Cs: the value of dwControlKeyState - any number. If omitted, defaults to '0'.
     //      Rc: the value of wRepeatCount - any number. If omitted, defaults to '1'.
-    return fmt::format(FMT_COMPILE(L"\x1b[{};{};{};{};{};{}_"),
-                       key.GetVirtualKeyCode(),
-                       key.GetVirtualScanCode(),
-                       static_cast<int>(key.GetCharData()),
-                       key.IsKeyDown() ? 1 : 0,
-                       key.GetActiveModifierKeys(),
-                       key.GetRepeatCount());
+    fmt::format_to(std::back_inserter(sequence),
+                   FMT_COMPILE(L"\x1b[{};{};{};{};{};{}_"),
+                   key.GetVirtualKeyCode(),
+                   key.GetVirtualScanCode(),
+                   static_cast<int>(key.GetCharData()),
+                   key.IsKeyDown() ? 1 : 0,
+                   key.GetActiveModifierKeys(),
+                   key.GetRepeatCount());
 }
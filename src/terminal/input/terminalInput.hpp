@@ -103,7 +103,6 @@ namespace Microsoft::Console::VirtualTerminal
         void _SendNullInputSequence(const DWORD dwControlKeyState) const;
         void _SendInputSequence(const std::wstring_view sequence) const noexcept;
         void _SendEscapedInputSequence(const wchar_t wch) const;
-        static std::wstring _GenerateWin32KeySequence(const KeyEvent& key);
 
 #pragma region MouseInputState Management
         // These methods are defined in mouseInputState.cpp
@@ -558,7 +558,7 @@ bool InputStateMachineEngine::ActionOscDispatch(const wchar_t /*wch*/,
 void InputStateMachineEngine::_GenerateWrappedSequence(const wchar_t wch,
                                                        const short vkey,
                                                        const DWORD modifierState,
-                                                       std::vector<INPUT_RECORD>& input)
+                                                       KeypressRecords& input)
 {
     input.reserve(input.size() + 8);
 
@@ -668,7 +668,7 @@ void InputStateMachineEngine::_GenerateWrappedSequence(const wchar_t wch,
 void InputStateMachineEngine::_GetSingleKeypress(const wchar_t wch,
                                                  const short vkey,
                                                  const DWORD modifierState,
-                                                 std::vector<INPUT_RECORD>& input)
+                                                 KeypressRecords& input)
 {
     input.reserve(input.size() + 2);
 
@@ -701,7 +701,9 @@ void InputStateMachineEngine::_GetSingleKeypress(const wchar_t wch,
 bool InputStateMachineEngine::_WriteSingleKey(const wchar_t wch, const short vkey, const DWORD modifierState)
 {
     // At most 8 records - 2 for each of shift,ctrl,alt up and down, and 2 for the actual key up and down.
-    std::vector<INPUT_RECORD> input;
+    // Stack-allocated: one keypress otherwise cost a heap allocation for
+    // this buffer on every single key that flows through the input engine.
+    KeypressRecords input;
     _GenerateWrappedSequence(wch, vkey, modifierState, input);
     auto inputEvents = IInputEvent::Create(std::span{ input });
 
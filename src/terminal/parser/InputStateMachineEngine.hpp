@@ -18,6 +18,7 @@ Author(s):
 #include "telemetry.hpp"
 #include "IStateMachineEngine.hpp"
 #include <functional>
+#include <til/small_vector.h>
 #include "../../types/inc/IInputEvent.hpp"
 #include "../adapter/IInteractDispatch.hpp"
 
@@ -195,15 +196,19 @@ namespace Microsoft::Console::VirtualTerminal
 
         bool _WriteMouseEvent(const til::point uiPos, const DWORD buttonState, const DWORD controlKeyState, const DWORD eventFlags);
 
+        // Key sequences top out at 8 records (3 modifier downs, key
+        // down/up, 3 modifier ups), so they fit on the stack.
+        using KeypressRecords = til::small_vector<INPUT_RECORD, 8>;
+
         void _GenerateWrappedSequence(const wchar_t wch,
                                       const short vkey,
                                       const DWORD modifierState,
-                                      std::vector<INPUT_RECORD>& input);
+                                      KeypressRecords& input);
 
         void _GetSingleKeypress(const wchar_t wch,
                                 const short vkey,
                                 const DWORD modifierState,
-                                std::vector<INPUT_RECORD>& input);
+                                KeypressRecords& input);
 
         bool _GetWindowManipulationType(const std::span<const size_t> parameters,
                                         unsigned int& function) const noexcept;
@@ -4,6 +4,8 @@
 #include "precomp.h"
 #include "OutputStateMachineEngine.hpp"
 
+#include <til/static_map.h>
+
 #include "ascii.hpp"
 #include "base64.hpp"
 #include "stateMachine.hpp"
@@ -426,288 +428,104 @@ bool OutputStateMachineEngine::ActionVt52EscDispatch(const VTID id, const VTPara
 // - true iff we successfully dispatched the sequence.
 bool OutputStateMachineEngine::ActionCsiDispatch(const VTID id, const VTParameters parameters)
 {
+    // CSI actions dispatch through a compile-time perfect-hash table: one
+    // multiply+shift probe and an indirect call per sequence, instead of a
+    // compiler-generated compare cascade (or a binary search's unpredictable
+    // branches) that regrows with every newly added sequence. Each handler
+    // runs before its telemetry is logged, matching the order the old
+    // switch used.
+    struct CsiDispatchEntry
+    {
+        TermTelemetry::Codes code;
+        bool (*handler)(OutputStateMachineEngine& self, const VTParameters parameters);
+    };
+
+    static constexpr til::perfect_static_map dispatchTable{
+        std::pair{ uint64_t{ CsiActionCodes::CUU_CursorUp }, CsiDispatchEntry{ TermTelemetry::Codes::CUU, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->CursorUp(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::CUD_CursorDown }, CsiDispatchEntry{ TermTelemetry::Codes::CUD, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->CursorDown(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::CUF_CursorForward }, CsiDispatchEntry{ TermTelemetry::Codes::CUF, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->CursorForward(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::CUB_CursorBackward }, CsiDispatchEntry{ TermTelemetry::Codes::CUB, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->CursorBackward(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::CNL_CursorNextLine }, CsiDispatchEntry{ TermTelemetry::Codes::CNL, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->CursorNextLine(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::CPL_CursorPrevLine }, CsiDispatchEntry{ TermTelemetry::Codes::CPL, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->CursorPrevLine(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::CHA_CursorHorizontalAbsolute }, CsiDispatchEntry{ TermTelemetry::Codes::CHA, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->CursorHorizontalPositionAbsolute(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::HPA_HorizontalPositionAbsolute }, CsiDispatchEntry{ TermTelemetry::Codes::CHA, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->CursorHorizontalPositionAbsolute(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::VPA_VerticalLinePositionAbsolute }, CsiDispatchEntry{ TermTelemetry::Codes::VPA, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->VerticalLinePositionAbsolute(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::HPR_HorizontalPositionRelative }, CsiDispatchEntry{ TermTelemetry::Codes::HPR, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->HorizontalPositionRelative(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::VPR_VerticalPositionRelative }, CsiDispatchEntry{ TermTelemetry::Codes::VPR, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->VerticalPositionRelative(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::CUP_CursorPosition }, CsiDispatchEntry{ TermTelemetry::Codes::CUP, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->CursorPosition(parameters.at(0), parameters.at(1)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::HVP_HorizontalVerticalPosition }, CsiDispatchEntry{ TermTelemetry::Codes::CUP, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->CursorPosition(parameters.at(0), parameters.at(1)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECSTBM_SetScrollingRegion }, CsiDispatchEntry{ TermTelemetry::Codes::DECSTBM, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->SetTopBottomScrollingMargins(parameters.at(0).value_or(0), parameters.at(1).value_or(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::ICH_InsertCharacter }, CsiDispatchEntry{ TermTelemetry::Codes::ICH, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->InsertCharacter(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DCH_DeleteCharacter }, CsiDispatchEntry{ TermTelemetry::Codes::DCH, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->DeleteCharacter(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::ED_EraseDisplay }, CsiDispatchEntry{ TermTelemetry::Codes::ED, [](OutputStateMachineEngine& self, const VTParameters parameters) { return parameters.for_each([&](const auto eraseType) { return self._dispatch->EraseInDisplay(eraseType); }); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECSED_SelectiveEraseDisplay }, CsiDispatchEntry{ TermTelemetry::Codes::DECSED, [](OutputStateMachineEngine& self, const VTParameters parameters) { return parameters.for_each([&](const auto eraseType) { return self._dispatch->SelectiveEraseInDisplay(eraseType); }); } } },
+        std::pair{ uint64_t{ CsiActionCodes::EL_EraseLine }, CsiDispatchEntry{ TermTelemetry::Codes::EL, [](OutputStateMachineEngine& self, const VTParameters parameters) { return parameters.for_each([&](const auto eraseType) { return self._dispatch->EraseInLine(eraseType); }); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECSEL_SelectiveEraseLine }, CsiDispatchEntry{ TermTelemetry::Codes::DECSEL, [](OutputStateMachineEngine& self, const VTParameters parameters) { return parameters.for_each([&](const auto eraseType) { return self._dispatch->SelectiveEraseInLine(eraseType); }); } } },
+        std::pair{ uint64_t{ CsiActionCodes::SM_SetMode }, CsiDispatchEntry{ TermTelemetry::Codes::SM, [](OutputStateMachineEngine& self, const VTParameters parameters) { return parameters.for_each([&](const auto mode) { return self._dispatch->SetMode(DispatchTypes::ANSIStandardMode(mode)); }); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECSET_PrivateModeSet }, CsiDispatchEntry{ TermTelemetry::Codes::DECSET, [](OutputStateMachineEngine& self, const VTParameters parameters) { return parameters.for_each([&](const auto mode) { return self._dispatch->SetMode(DispatchTypes::DECPrivateMode(mode)); }); } } },
+        std::pair{ uint64_t{ CsiActionCodes::RM_ResetMode }, CsiDispatchEntry{ TermTelemetry::Codes::RM, [](OutputStateMachineEngine& self, const VTParameters parameters) { return parameters.for_each([&](const auto mode) { return self._dispatch->ResetMode(DispatchTypes::ANSIStandardMode(mode)); }); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECRST_PrivateModeReset }, CsiDispatchEntry{ TermTelemetry::Codes::DECRST, [](OutputStateMachineEngine& self, const VTParameters parameters) { return parameters.for_each([&](const auto mode) { return self._dispatch->ResetMode(DispatchTypes::DECPrivateMode(mode)); }); } } },
+        std::pair{ uint64_t{ CsiActionCodes::SGR_SetGraphicsRendition }, CsiDispatchEntry{ TermTelemetry::Codes::SGR, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->SetGraphicsRendition(parameters); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DSR_DeviceStatusReport }, CsiDispatchEntry{ TermTelemetry::Codes::DSR, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->DeviceStatusReport(DispatchTypes::ANSIStandardStatus(parameters.at(0)), parameters.at(1)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DSR_PrivateDeviceStatusReport }, CsiDispatchEntry{ TermTelemetry::Codes::DSR, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->DeviceStatusReport(DispatchTypes::DECPrivateStatus(parameters.at(0)), parameters.at(1)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DA_DeviceAttributes }, CsiDispatchEntry{ TermTelemetry::Codes::DA, [](OutputStateMachineEngine& self, const VTParameters parameters) { return parameters.at(0).value_or(0) == 0 && self._dispatch->DeviceAttributes(); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DA2_SecondaryDeviceAttributes }, CsiDispatchEntry{ TermTelemetry::Codes::DA2, [](OutputStateMachineEngine& self, const VTParameters parameters) { return parameters.at(0).value_or(0) == 0 && self._dispatch->SecondaryDeviceAttributes(); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DA3_TertiaryDeviceAttributes }, CsiDispatchEntry{ TermTelemetry::Codes::DA3, [](OutputStateMachineEngine& self, const VTParameters parameters) { return parameters.at(0).value_or(0) == 0 && self._dispatch->TertiaryDeviceAttributes(); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECREQTPARM_RequestTerminalParameters }, CsiDispatchEntry{ TermTelemetry::Codes::DECREQTPARM, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->RequestTerminalParameters(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::SU_ScrollUp }, CsiDispatchEntry{ TermTelemetry::Codes::SU, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->ScrollUp(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::SD_ScrollDown }, CsiDispatchEntry{ TermTelemetry::Codes::SD, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->ScrollDown(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::ANSISYSSC_CursorSave }, CsiDispatchEntry{ TermTelemetry::Codes::ANSISYSSC, [](OutputStateMachineEngine& self, const VTParameters parameters) { return parameters.empty() && self._dispatch->CursorSaveState(); } } },
+        std::pair{ uint64_t{ CsiActionCodes::ANSISYSRC_CursorRestore }, CsiDispatchEntry{ TermTelemetry::Codes::ANSISYSRC, [](OutputStateMachineEngine& self, const VTParameters parameters) { return parameters.empty() && self._dispatch->CursorRestoreState(); } } },
+        std::pair{ uint64_t{ CsiActionCodes::IL_InsertLine }, CsiDispatchEntry{ TermTelemetry::Codes::IL, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->InsertLine(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DL_DeleteLine }, CsiDispatchEntry{ TermTelemetry::Codes::DL, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->DeleteLine(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::CHT_CursorForwardTab }, CsiDispatchEntry{ TermTelemetry::Codes::CHT, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->ForwardTab(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::CBT_CursorBackTab }, CsiDispatchEntry{ TermTelemetry::Codes::CBT, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->BackwardsTab(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::TBC_TabClear }, CsiDispatchEntry{ TermTelemetry::Codes::TBC, [](OutputStateMachineEngine& self, const VTParameters parameters) { return parameters.for_each([&](const auto clearType) { return self._dispatch->TabClear(clearType); }); } } },
+        std::pair{ uint64_t{ CsiActionCodes::ECH_EraseCharacters }, CsiDispatchEntry{ TermTelemetry::Codes::ECH, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->EraseCharacters(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DTTERM_WindowManipulation }, CsiDispatchEntry{ TermTelemetry::Codes::DTTERM_WM, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->WindowManipulation(parameters.at(0), parameters.at(1), parameters.at(2)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::REP_RepeatCharacter }, CsiDispatchEntry{ TermTelemetry::Codes::REP, [](OutputStateMachineEngine& self, const VTParameters parameters) {
+                       // Handled w/o the dispatch. This function is unique in that way
+                       // If this were in the ITerminalDispatch, then each
+                       // implementation would effectively be the same, calling only
+                       // functions that are already part of the interface.
+                       // Print the last graphical character a number of times.
+                       if (self._lastPrintedChar != AsciiChars::NUL)
+                       {
+                           const size_t repeatCount = parameters.at(0);
+                           std::wstring wstr(repeatCount, self._lastPrintedChar);
+                           self._dispatch->PrintString(wstr);
+                       }
+                       return true;
+                   } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECSCUSR_SetCursorStyle }, CsiDispatchEntry{ TermTelemetry::Codes::DECSCUSR, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->SetCursorStyle(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECSTR_SoftReset }, CsiDispatchEntry{ TermTelemetry::Codes::DECSTR, [](OutputStateMachineEngine& self, const VTParameters) { return self._dispatch->SoftReset(); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECSCA_SetCharacterProtectionAttribute }, CsiDispatchEntry{ TermTelemetry::Codes::DECSCA, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->SetCharacterProtectionAttribute(parameters); } } },
+        std::pair{ uint64_t{ CsiActionCodes::XT_PushSgr }, CsiDispatchEntry{ TermTelemetry::Codes::XTPUSHSGR, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->PushGraphicsRendition(parameters); } } },
+        std::pair{ uint64_t{ CsiActionCodes::XT_PushSgrAlias }, CsiDispatchEntry{ TermTelemetry::Codes::XTPUSHSGR, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->PushGraphicsRendition(parameters); } } },
+        std::pair{ uint64_t{ CsiActionCodes::XT_PopSgr }, CsiDispatchEntry{ TermTelemetry::Codes::XTPOPSGR, [](OutputStateMachineEngine& self, const VTParameters) { return self._dispatch->PopGraphicsRendition(); } } },
+        std::pair{ uint64_t{ CsiActionCodes::XT_PopSgrAlias }, CsiDispatchEntry{ TermTelemetry::Codes::XTPOPSGR, [](OutputStateMachineEngine& self, const VTParameters) { return self._dispatch->PopGraphicsRendition(); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECRQM_RequestMode }, CsiDispatchEntry{ TermTelemetry::Codes::DECRQM, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->RequestMode(DispatchTypes::ANSIStandardMode(parameters.at(0))); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECRQM_PrivateRequestMode }, CsiDispatchEntry{ TermTelemetry::Codes::DECRQM, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->RequestMode(DispatchTypes::DECPrivateMode(parameters.at(0))); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECCARA_ChangeAttributesRectangularArea }, CsiDispatchEntry{ TermTelemetry::Codes::DECCARA, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->ChangeAttributesRectangularArea(parameters.at(0), parameters.at(1), parameters.at(2).value_or(0), parameters.at(3).value_or(0), parameters.subspan(4)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECRARA_ReverseAttributesRectangularArea }, CsiDispatchEntry{ TermTelemetry::Codes::DECRARA, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->ReverseAttributesRectangularArea(parameters.at(0), parameters.at(1), parameters.at(2).value_or(0), parameters.at(3).value_or(0), parameters.subspan(4)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECCRA_CopyRectangularArea }, CsiDispatchEntry{ TermTelemetry::Codes::DECCRA, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->CopyRectangularArea(parameters.at(0), parameters.at(1), parameters.at(2).value_or(0), parameters.at(3).value_or(0), parameters.at(4), parameters.at(5), parameters.at(6), parameters.at(7)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECRQPSR_RequestPresentationStateReport }, CsiDispatchEntry{ TermTelemetry::Codes::DECRQPSR, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->RequestPresentationStateReport(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECFRA_FillRectangularArea }, CsiDispatchEntry{ TermTelemetry::Codes::DECFRA, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->FillRectangularArea(parameters.at(0), parameters.at(1), parameters.at(2), parameters.at(3).value_or(0), parameters.at(4).value_or(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECERA_EraseRectangularArea }, CsiDispatchEntry{ TermTelemetry::Codes::DECERA, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->EraseRectangularArea(parameters.at(0), parameters.at(1), parameters.at(2).value_or(0), parameters.at(3).value_or(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECSERA_SelectiveEraseRectangularArea }, CsiDispatchEntry{ TermTelemetry::Codes::DECSERA, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->SelectiveEraseRectangularArea(parameters.at(0), parameters.at(1), parameters.at(2).value_or(0), parameters.at(3).value_or(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECSACE_SelectAttributeChangeExtent }, CsiDispatchEntry{ TermTelemetry::Codes::DECSACE, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->SelectAttributeChangeExtent(parameters.at(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECRQCRA_RequestChecksumRectangularArea }, CsiDispatchEntry{ TermTelemetry::Codes::DECRQCRA, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->RequestChecksumRectangularArea(parameters.at(0).value_or(0), parameters.at(1).value_or(0), parameters.at(2), parameters.at(3), parameters.at(4).value_or(0), parameters.at(5).value_or(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECINVM_InvokeMacro }, CsiDispatchEntry{ TermTelemetry::Codes::DECINVM, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->InvokeMacro(parameters.at(0).value_or(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECAC_AssignColor }, CsiDispatchEntry{ TermTelemetry::Codes::DECAC, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->AssignColor(parameters.at(0), parameters.at(1).value_or(0), parameters.at(2).value_or(0)); } } },
+        std::pair{ uint64_t{ CsiActionCodes::DECPS_PlaySound }, CsiDispatchEntry{ TermTelemetry::Codes::DECPS, [](OutputStateMachineEngine& self, const VTParameters parameters) { return self._dispatch->PlaySounds(parameters); } } },
+    };
+
     auto success = false;
 
-    switch (id)
+    if (const auto entry = dispatchTable.find(uint64_t{ id }); entry != dispatchTable.end())
     {
-    case CsiActionCodes::CUU_CursorUp:
-        success = _dispatch->CursorUp(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::CUU);
-        break;
-    case CsiActionCodes::CUD_CursorDown:
-        success = _dispatch->CursorDown(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::CUD);
-        break;
-    case CsiActionCodes::CUF_CursorForward:
-        success = _dispatch->CursorForward(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::CUF);
-        break;
-    case CsiActionCodes::CUB_CursorBackward:
-        success = _dispatch->CursorBackward(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::CUB);
-        break;
-    case CsiActionCodes::CNL_CursorNextLine:
-        success = _dispatch->CursorNextLine(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::CNL);
-        break;
-    case CsiActionCodes::CPL_CursorPrevLine:
-        success = _dispatch->CursorPrevLine(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::CPL);
-        break;
-    case CsiActionCodes::CHA_CursorHorizontalAbsolute:
-    case CsiActionCodes::HPA_HorizontalPositionAbsolute:
-        success = _dispatch->CursorHorizontalPositionAbsolute(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::CHA);
-        break;
-    case CsiActionCodes::VPA_VerticalLinePositionAbsolute:
-        success = _dispatch->VerticalLinePositionAbsolute(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::VPA);
-        break;
-    case CsiActionCodes::HPR_HorizontalPositionRelative:
-        success = _dispatch->HorizontalPositionRelative(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::HPR);
-        break;
-    case CsiActionCodes::VPR_VerticalPositionRelative:
-        success = _dispatch->VerticalPositionRelative(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::VPR);
-        break;
-    case CsiActionCodes::CUP_CursorPosition:
-    case CsiActionCodes::HVP_HorizontalVerticalPosition:
-        success = _dispatch->CursorPosition(parameters.at(0), parameters.at(1));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::CUP);
-        break;
-    case CsiActionCodes::DECSTBM_SetScrollingRegion:
-        success = _dispatch->SetTopBottomScrollingMargins(parameters.at(0).value_or(0), parameters.at(1).value_or(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECSTBM);
-        break;
-    case CsiActionCodes::ICH_InsertCharacter:
-        success = _dispatch->InsertCharacter(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::ICH);
-        break;
-    case CsiActionCodes::DCH_DeleteCharacter:
-        success = _dispatch->DeleteCharacter(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DCH);
-        break;
-    case CsiActionCodes::ED_EraseDisplay:
-        success = parameters.for_each([&](const auto eraseType) {
-            return _dispatch->EraseInDisplay(eraseType);
-        });
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::ED);
-        break;
-    case CsiActionCodes::DECSED_SelectiveEraseDisplay:
-        success = parameters.for_each([&](const auto eraseType) {
-            return _dispatch->SelectiveEraseInDisplay(eraseType);
-        });
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECSED);
-        break;
-    case CsiActionCodes::EL_EraseLine:
-        success = parameters.for_each([&](const auto eraseType) {
-            return _dispatch->EraseInLine(eraseType);
-        });
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::EL);
-        break;
-    case CsiActionCodes::DECSEL_SelectiveEraseLine:
-        success = parameters.for_each([&](const auto eraseType) {
-            return _dispatch->SelectiveEraseInLine(eraseType);
-        });
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECSEL);
-        break;
-    case CsiActionCodes::SM_SetMode:
-        success = parameters.for_each([&](const auto mode) {
-            return _dispatch->SetMode(DispatchTypes::ANSIStandardMode(mode));
-        });
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::SM);
-        break;
-    case CsiActionCodes::DECSET_PrivateModeSet:
-        success = parameters.for_each([&](const auto mode) {
-            return _dispatch->SetMode(DispatchTypes::DECPrivateMode(mode));
-        });
-        //TODO: MSFT:6367459 Add specific logging for each of the DECSET/DECRST codes
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECSET);
-        break;
-    case CsiActionCodes::RM_ResetMode:
-        success = parameters.for_each([&](const auto mode) {
-            return _dispatch->ResetMode(DispatchTypes::ANSIStandardMode(mode));
-        });
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::RM);
-        break;
-    case CsiActionCodes::DECRST_PrivateModeReset:
-        success = parameters.for_each([&](const auto mode) {
-            return _dispatch->ResetMode(DispatchTypes::DECPrivateMode(mode));
-        });
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECRST);
-        break;
-    case CsiActionCodes::SGR_SetGraphicsRendition:
-        success = _dispatch->SetGraphicsRendition(parameters);
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::SGR);
-        break;
-    case CsiActionCodes::DSR_DeviceStatusReport:
-        success = _dispatch->DeviceStatusReport(DispatchTypes::ANSIStandardStatus(parameters.at(0)), parameters.at(1));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DSR);
-        break;
-    case CsiActionCodes::DSR_PrivateDeviceStatusReport:
-        success = _dispatch->DeviceStatusReport(DispatchTypes::DECPrivateStatus(parameters.at(0)), parameters.at(1));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DSR);
-        break;
-    case CsiActionCodes::DA_DeviceAttributes:
-        success = parameters.at(0).value_or(0) == 0 && _dispatch->DeviceAttributes();
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DA);
-        break;
-    case CsiActionCodes::DA2_SecondaryDeviceAttributes:
-        success = parameters.at(0).value_or(0) == 0 && _dispatch->SecondaryDeviceAttributes();
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DA2);
-        break;
-    case CsiActionCodes::DA3_TertiaryDeviceAttributes:
-        success = parameters.at(0).value_or(0) == 0 && _dispatch->TertiaryDeviceAttributes();
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DA3);
-        break;
-    case CsiActionCodes::DECREQTPARM_RequestTerminalParameters:
-        success = _dispatch->RequestTerminalParameters(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECREQTPARM);
-        break;
-    case CsiActionCodes::SU_ScrollUp:
-        success = _dispatch->ScrollUp(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::SU);
-        break;
-    case CsiActionCodes::SD_ScrollDown:
-        success = _dispatch->ScrollDown(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::SD);
-        break;
-    case CsiActionCodes::ANSISYSSC_CursorSave:
-        success = parameters.empty() && _dispatch->CursorSaveState();
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::ANSISYSSC);
-        break;
-    case CsiActionCodes::ANSISYSRC_CursorRestore:
-        success = parameters.empty() && _dispatch->CursorRestoreState();
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::ANSISYSRC);
-        break;
-    case CsiActionCodes::IL_InsertLine:
-        success = _dispatch->InsertLine(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::IL);
-        break;
-    case CsiActionCodes::DL_DeleteLine:
-        success = _dispatch->DeleteLine(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DL);
-        break;
-    case CsiActionCodes::CHT_CursorForwardTab:
-        success = _dispatch->ForwardTab(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::CHT);
-        break;
-    case CsiActionCodes::CBT_CursorBackTab:
-        success = _dispatch->BackwardsTab(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::CBT);
-        break;
-    case CsiActionCodes::TBC_TabClear:
-        success = parameters.for_each([&](const auto clearType) {
-            return _dispatch->TabClear(clearType);
-        });
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::TBC);
-        break;
-    case CsiActionCodes::ECH_EraseCharacters:
-        success = _dispatch->EraseCharacters(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::ECH);
-        break;
-    case CsiActionCodes::DTTERM_WindowManipulation:
-        success = _dispatch->WindowManipulation(parameters.at(0), parameters.at(1), parameters.at(2));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DTTERM_WM);
-        break;
-    case CsiActionCodes::REP_RepeatCharacter:
-        // Handled w/o the dispatch. This function is unique in that way
-        // If this were in the ITerminalDispatch, then each
-        // implementation would effectively be the same, calling only
-        // functions that are already part of the interface.
-        // Print the last graphical character a number of times.
-        if (_lastPrintedChar != AsciiChars::NUL)
-        {
-            const size_t repeatCount = parameters.at(0);
-            std::wstring wstr(repeatCount, _lastPrintedChar);
-            _dispatch->PrintString(wstr);
-        }
-        success = true;
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::REP);
-        break;
-    case CsiActionCodes::DECSCUSR_SetCursorStyle:
-        success = _dispatch->SetCursorStyle(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECSCUSR);
-        break;
-    case CsiActionCodes::DECSTR_SoftReset:
-        success = _dispatch->SoftReset();
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECSTR);
-        break;
-    case CsiActionCodes::DECSCA_SetCharacterProtectionAttribute:
-        success = _dispatch->SetCharacterProtectionAttribute(parameters);
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECSCA);
-        break;
-    case CsiActionCodes::XT_PushSgr:
-    case CsiActionCodes::XT_PushSgrAlias:
-        success = _dispatch->PushGraphicsRendition(parameters);
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::XTPUSHSGR);
-        break;
-    case CsiActionCodes::XT_PopSgr:
-    case CsiActionCodes::XT_PopSgrAlias:
-        success = _dispatch->PopGraphicsRendition();
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::XTPOPSGR);
-        break;
-    case CsiActionCodes::DECRQM_RequestMode:
-        success = _dispatch->RequestMode(DispatchTypes::ANSIStandardMode(parameters.at(0)));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECRQM);
-        break;
-    case CsiActionCodes::DECRQM_PrivateRequestMode:
-        success = _dispatch->RequestMode(DispatchTypes::DECPrivateMode(parameters.at(0)));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECRQM);
-        break;
-    case CsiActionCodes::DECCARA_ChangeAttributesRectangularArea:
-        success = _dispatch->ChangeAttributesRectangularArea(parameters.at(0), parameters.at(1), parameters.at(2).value_or(0), parameters.at(3).value_or(0), parameters.subspan(4));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECCARA);
-        break;
-    case CsiActionCodes::DECRARA_ReverseAttributesRectangularArea:
-        success = _dispatch->ReverseAttributesRectangularArea(parameters.at(0), parameters.at(1), parameters.at(2).value_or(0), parameters.at(3).value_or(0), parameters.subspan(4));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECRARA);
-        break;
-    case CsiActionCodes::DECCRA_CopyRectangularArea:
-        success = _dispatch->CopyRectangularArea(parameters.at(0), parameters.at(1), parameters.at(2).value_or(0), parameters.at(3).value_or(0), parameters.at(4), parameters.at(5), parameters.at(6), parameters.at(7));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECCRA);
-        break;
-    case CsiActionCodes::DECRQPSR_RequestPresentationStateReport:
-        success = _dispatch->RequestPresentationStateReport(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECRQPSR);
-        break;
-    case CsiActionCodes::DECFRA_FillRectangularArea:
-        success = _dispatch->FillRectangularArea(parameters.at(0), parameters.at(1), parameters.at(2), parameters.at(3).value_or(0), parameters.at(4).value_or(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECFRA);
-        break;
-    case CsiActionCodes::DECERA_EraseRectangularArea:
-        success = _dispatch->EraseRectangularArea(parameters.at(0), parameters.at(1), parameters.at(2).value_or(0), parameters.at(3).value_or(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECERA);
-        break;
-    case CsiActionCodes::DECSERA_SelectiveEraseRectangularArea:
-        success = _dispatch->SelectiveEraseRectangularArea(parameters.at(0), parameters.at(1), parameters.at(2).value_or(0), parameters.at(3).value_or(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECSERA);
-        break;
-    case CsiActionCodes::DECSACE_SelectAttributeChangeExtent:
-        success = _dispatch->SelectAttributeChangeExtent(parameters.at(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECSACE);
-        break;
-    case CsiActionCodes::DECRQCRA_RequestChecksumRectangularArea:
-        success = _dispatch->RequestChecksumRectangularArea(parameters.at(0).value_or(0), parameters.at(1).value_or(0), parameters.at(2), parameters.at(3), parameters.at(4).value_or(0), parameters.at(5).value_or(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECRQCRA);
-        break;
-    case CsiActionCodes::DECINVM_InvokeMacro:
-        success = _dispatch->InvokeMacro(parameters.at(0).value_or(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECINVM);
-        break;
-    case CsiActionCodes::DECAC_AssignColor:
-        success = _dispatch->AssignColor(parameters.at(0), parameters.at(1).value_or(0), parameters.at(2).value_or(0));
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECAC);
-        break;
-    case CsiActionCodes::DECPS_PlaySound:
-        success = _dispatch->PlaySounds(parameters);
-        TermTelemetry::Instance().Log(TermTelemetry::Codes::DECPS);
-        break;
-    default:
-        // If no functions to call, overall dispatch was a failure.
-        success = false;
-        break;
+        success = entry->second.handler(*this, parameters);
+        TermTelemetry::Instance().Log(entry->second.code);
     }
 
     // If we were unable to process the string, and there's a TTY attached to us,
@@ -923,6 +741,11 @@ bool OutputStateMachineEngine::ActionOscDispatch(const wchar_t /*wch*/,
         success = _dispatch->DoConEmuAction(string);
         break;
     }
+    case OscActionCodes::PerformanceQuery:
+    {
+        success = _dispatch->DoPerformanceQuery(string);
+        break;
+    }
     case OscActionCodes::ITerm2Action:
     {
         success = _dispatch->DoITerm2Action(string);
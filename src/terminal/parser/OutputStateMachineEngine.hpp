@@ -212,6 +212,9 @@ namespace Microsoft::Console::VirtualTerminal
             ResetCursorColor = 112,
             FinalTermAction = 133,
             ITerm2Action = 1337,
+            // Private: in-band performance counter query; see
+            // AdaptDispatch::DoPerformanceQuery.
+            PerformanceQuery = 7770,
         };
 
         bool _GetOscTitle(const std::wstring_view string,
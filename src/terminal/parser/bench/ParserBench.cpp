@@ -0,0 +1,150 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+// ParserBench: drives StateMachine and OutputStateMachineEngine with
+// representative output corpora and reports bytes/sec and dispatches/sec per
+// corpus, so parser throughput regressions show up as numbers instead of
+// bug reports. Run a few times and compare against a baseline build; the
+// corpora are synthesized deterministically, so runs are comparable.
+
+#include "precomp.h"
+
+#include "../stateMachine.hpp"
+#include "../OutputStateMachineEngine.hpp"
+#include "../../adapter/termDispatch.hpp"
+
+using namespace Microsoft::Console::VirtualTerminal;
+
+namespace
+{
+    // Counts work instead of doing it, so the numbers measure the parser and
+    // the engine dispatch, not a buffer implementation.
+    class CountingDispatch final : public TermDispatch
+    {
+    public:
+        void Print(const wchar_t) override
+        {
+            ++printed;
+        }
+
+        void PrintString(const std::wstring_view string) override
+        {
+            printed += string.size();
+        }
+
+        bool CursorPosition(const VTInt, const VTInt) override
+        {
+            ++dispatches;
+            return true;
+        }
+
+        bool SetGraphicsRendition(const VTParameters) override
+        {
+            ++dispatches;
+            return true;
+        }
+
+        bool EraseInLine(const DispatchTypes::EraseType) override
+        {
+            ++dispatches;
+            return true;
+        }
+
+        bool CursorForward(const VTInt) override
+        {
+            ++dispatches;
+            return true;
+        }
+
+        size_t printed = 0;
+        size_t dispatches = 0;
+    };
+
+    std::wstring plainLogCorpus()
+    {
+        // 80-column build-log-style lines of plain ASCII.
+        std::wstring out;
+        for (auto i = 0; i < 20000; ++i)
+        {
+            out.append(L"[build] compiling source file number ");
+            out.append(std::to_wstring(i));
+            out.append(L" ................................ ok\r\n");
+        }
+        return out;
+    }
+
+    std::wstring sgrDenseCorpus()
+    {
+        // ls --color style: short runs of text with an SGR flip in between.
+        std::wstring out;
+        for (auto i = 0; i < 20000; ++i)
+        {
+            out.append(L"\x1b[01;34mdirectory\x1b[0m  \x1b[01;32mexecutable\x1b[0m  plain.txt\r\n");
+        }
+        return out;
+    }
+
+    std::wstring tuiFrameCorpus()
+    {
+        // Full-screen TUI frame repaint: cursor positioning plus a styled row.
+        std::wstring out;
+        for (auto frame = 0; frame < 400; ++frame)
+        {
+            for (auto row = 1; row <= 50; ++row)
+            {
+                out.append(L"\x1b[");
+                out.append(std::to_wstring(row));
+                out.append(L";1H\x1b[38;2;32;96;160m");
+                out.append(L"| cell | cell | cell | cell | cell | cell | cell | cell |");
+                out.append(L"\x1b[0m\x1b[K");
+            }
+        }
+        return out;
+    }
+
+    std::wstring cursorStormCorpus()
+    {
+        // Editors redrawing small regions: lots of tiny movements, no text.
+        std::wstring out;
+        for (auto i = 0; i < 200000; ++i)
+        {
+            out.append(L"\x1b[5;10H\x1b[2C\x1b[8;1H");
+        }
+        return out;
+    }
+
+    void runCorpus(const wchar_t* name, const std::wstring& corpus)
+    {
+        auto dispatch = std::make_unique<CountingDispatch>();
+        const auto counters = dispatch.get();
+        auto engine = std::make_unique<OutputStateMachineEngine>(std::move(dispatch));
+        StateMachine machine{ std::move(engine) };
+
+        constexpr auto chunkSize = size_t{ 4096 }; // ConPTY-sized chunks
+        const auto start = std::chrono::steady_clock::now();
+
+        for (size_t offset = 0; offset < corpus.size(); offset += chunkSize)
+        {
+            machine.ProcessString({ corpus.data() + offset, std::min(chunkSize, corpus.size() - offset) });
+        }
+
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        const auto bytes = corpus.size() * sizeof(wchar_t);
+
+        wprintf(L"%-16s %8.3f s  %9.1f MB/s  %10zu printed  %10zu dispatches\n",
+                name,
+                elapsed,
+                bytes / elapsed / 1e6,
+                counters->printed,
+                counters->dispatches);
+    }
+}
+
+int __cdecl wmain(int /*argc*/, wchar_t** /*argv*/)
+{
+    runCorpus(L"plain-log", plainLogCorpus());
+    runCorpus(L"sgr-dense", sgrDenseCorpus());
+    runCorpus(L"tui-frame", tuiFrameCorpus());
+    runCorpus(L"cursor-storm", cursorStormCorpus());
+    return 0;
+}
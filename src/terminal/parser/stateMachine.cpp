@@ -18,7 +18,7 @@ StateMachine::StateMachine(std::unique_ptr<IStateMachineEngine> engine, const bo
     _parameters{},
     _parameterLimitReached(false),
     _oscString{},
-    _cachedSequence{ std::nullopt },
+    _cachedSequence{},
     _processingIndividually(false)
 {
     _ActionClear();
@@ -377,6 +377,47 @@ static constexpr bool _isActionableFromGround(const wchar_t wch) noexcept
     return (wch <= AsciiChars::US) || _isC1ControlCharacter(wch) || _isDelete(wch);
 }
 
+// Routine Description:
+// - Returns the position of the next character at or past `pos` that requires
+//   an action from ground state (see _isActionableFromGround), or the string
+//   size if there is none. More than 99% of real output is printable text, so
+//   this is the hottest scan in the parser; on x64 it tests 8 characters per
+//   iteration: a character is actionable iff it's a C0 control (< 0x20) or
+//   falls into [0x7F, 0x9F] (DEL and the C1 controls). The comparisons run on
+//   values biased by 0x8000 so that the signed epi16 compares order like
+//   unsigned characters.
+static size_t _findActionableFromGround(const std::wstring_view string, size_t pos) noexcept
+{
+#ifdef _M_AMD64
+    const auto size = string.size();
+    const auto bias = _mm_set1_epi16(static_cast<short>(0x8000));
+    const auto c0Limit = _mm_set1_epi16(static_cast<short>(0x8020));
+    const auto delLow = _mm_set1_epi16(static_cast<short>(0x807f));
+    const auto c1Limit = _mm_set1_epi16(static_cast<short>(0x80a0));
+    while (pos + 8 <= size)
+    {
+        const auto chunk = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(string.data() + pos)), bias);
+        const auto isC0 = _mm_cmplt_epi16(chunk, c0Limit);
+        const auto belowDel = _mm_cmplt_epi16(chunk, delLow);
+        const auto belowC1End = _mm_cmplt_epi16(chunk, c1Limit);
+        const auto isDelOrC1 = _mm_andnot_si128(belowDel, belowC1End);
+        const auto mask = _mm_movemask_epi8(_mm_or_si128(isC0, isDelOrC1));
+        if (mask)
+        {
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return pos + index / 2;
+        }
+        pos += 8;
+    }
+#endif
+
+    for (; pos < string.size() && !_isActionableFromGround(til::at(string, pos)); ++pos)
+    {
+    }
+    return pos;
+}
+
 #pragma warning(pop)
 
 // Routine Description:
@@ -699,7 +740,7 @@ void StateMachine::_ActionDcsDispatch(const wchar_t wch)
 void StateMachine::_EnterGround() noexcept
 {
     _state = VTStates::Ground;
-    _cachedSequence.reset(); // entering ground means we've completed the pending sequence
+    _cachedSequence.clear(); // entering ground means we've completed the pending sequence
     _trace.TraceStateChange(L"Ground");
 }
 
@@ -919,7 +960,7 @@ void StateMachine::_EnterDcsParam() noexcept
 void StateMachine::_EnterDcsIgnore() noexcept
 {
     _state = VTStates::DcsIgnore;
-    _cachedSequence.reset();
+    _cachedSequence.clear();
     _trace.TraceStateChange(L"DcsIgnore");
 }
 
@@ -951,7 +992,7 @@ void StateMachine::_EnterDcsIntermediate() noexcept
 void StateMachine::_EnterDcsPassThrough() noexcept
 {
     _state = VTStates::DcsPassThrough;
-    _cachedSequence.reset();
+    _cachedSequence.clear();
     _trace.TraceStateChange(L"DcsPassThrough");
 }
 
@@ -968,7 +1009,7 @@ void StateMachine::_EnterDcsPassThrough() noexcept
 void StateMachine::_EnterSosPmApcString() noexcept
 {
     _state = VTStates::SosPmApcString;
-    _cachedSequence.reset();
+    _cachedSequence.clear();
     _trace.TraceStateChange(L"SosPmApcString");
 }
 
@@ -1796,15 +1837,15 @@ bool StateMachine::FlushToTerminal()
 {
     auto success{ true };
 
-    if (success && _cachedSequence.has_value())
+    if (success && !_cachedSequence.empty())
     {
         // Flush the partial sequence to the terminal before we flush the rest of it.
         // We always want to clear the sequence, even if we failed, so we don't accumulate bad state
         // and dump it out elsewhere later.
-        success = _SafeExecute([=]() {
-            return _engine->ActionPassThroughString(*_cachedSequence);
+        success = _SafeExecute([&]() {
+            return _engine->ActionPassThroughString(_cachedSequence);
         });
-        _cachedSequence.reset();
+        _cachedSequence.clear();
     }
 
     if (success)
@@ -1835,6 +1876,8 @@ void StateMachine::ProcessString(const std::wstring_view string)
     size_t start = 0;
     auto current = start;
 
+    _totalBytesProcessed += string.size() * sizeof(wchar_t);
+
     _currentString = string;
     _runOffset = 0;
     _runSize = 0;
@@ -1849,6 +1892,25 @@ void StateMachine::ProcessString(const std::wstring_view string)
 
         if (_processingIndividually)
         {
+            // OSC strings are by far the longest sequences we process (OSC 52
+            // clipboard payloads reach megabytes), so their plain characters
+            // are appended in whole spans instead of one state-machine step
+            // per character. Terminators, escapes and invalid characters
+            // still take the per-character path below.
+            if (_state == VTStates::OscString)
+            {
+                auto spanEnd = current;
+                for (wchar_t ch; spanEnd < string.size() && (ch = til::at(string, spanEnd), !_isOscTerminator(ch) && !_isEscape(ch) && !_isOscInvalid(ch)); ++spanEnd)
+                {
+                }
+                if (spanEnd > current)
+                {
+                    _oscString.append(string.substr(current, spanEnd - current));
+                    current = spanEnd;
+                    continue;
+                }
+            }
+
             // Note whether we're dealing with the last character in the buffer.
             _processingLastCharacter = (current + 1 >= string.size());
             // If we're processing characters individually, send it to the state machine.
@@ -1879,7 +1941,11 @@ void StateMachine::ProcessString(const std::wstring_view string)
             }
             else
             {
-                ++current; // Otherwise, add this char to the current run to be printed.
+                // Otherwise, everything up to (but excluding) the next
+                // actionable character joins the current run to be printed.
+                // Hopping there directly turns the per-character state checks
+                // into one vectorized scan per run.
+                current = _findActionableFromGround(string, current + 1);
             }
         }
     }
@@ -1975,13 +2041,7 @@ void StateMachine::ProcessString(const std::wstring_view string)
             // thing to the terminal later. There is no need to do this if we've
             // reached one of the string processing states, though, since that data
             // will be dealt with as soon as it is received.
-            if (!_cachedSequence)
-            {
-                _cachedSequence.emplace(std::wstring{});
-            }
-
-            auto& cachedSequence = *_cachedSequence;
-            cachedSequence.append(run);
+            _cachedSequence.append(run);
         }
     }
 }
@@ -59,6 +59,10 @@ namespace Microsoft::Console::VirtualTerminal
 
         void ProcessCharacter(const wchar_t wch);
         void ProcessString(const std::wstring_view string);
+
+        // Total UTF-16 code units this machine has processed; feeds the
+        // in-band performance query (OSC 7770).
+        uint64_t GetTotalBytesProcessed() const noexcept { return _totalBytesProcessed; }
         bool IsProcessingLastCharacter() const noexcept;
 
         void OnCsiComplete(const std::function<void()> callback);
@@ -200,13 +204,20 @@ namespace Microsoft::Console::VirtualTerminal
 
         IStateMachineEngine::StringHandler _dcsStringHandler;
 
-        std::optional<std::wstring> _cachedSequence;
+        // The raw text of a sequence that spans chunk boundaries, kept only
+        // so FlushToTerminal can pass the complete sequence through. The
+        // parse state itself survives chunks without it. Empty means none;
+        // clearing retains the capacity so boundary-spanning sequences stop
+        // reallocating this buffer under sustained 4KB-chunked load.
+        std::wstring _cachedSequence;
 
         // This is tracked per state machine instance so that separate calls to Process*
         //   can start and finish a sequence.
         bool _processingIndividually;
         bool _processingLastCharacter;
 
+        uint64_t _totalBytesProcessed = 0;
+
         std::function<void()> _onCsiCompleteCallback;
     };
 }
@@ -50,43 +50,42 @@ TermTelemetry::~TermTelemetry()
 }
 
 // Routine Description:
-// - Logs the usage of a particular VT100 code.
+// - Folds a thread's counter shard into the singleton's totals and resets it.
+//   This is the only place the shared counters are written, so the dispatch
+//   loops themselves never touch a contended cache line.
 //
 // Arguments:
-// - code - VT100 code.
+// - shard - The thread-local counters to fold in.
 // Return Value:
 // - <none>
-void TermTelemetry::Log(const Codes code) noexcept
+void TermTelemetry::_flushShard(ThreadShard& shard) noexcept
 {
-    // Initially we wanted to pass over a string (ex. "CUU") and use a dictionary data type to hold the counts.
-    // However we would have to search through the dictionary every time we called this method, so we decided
-    // to use an array which has very quick access times.
-    // The downside is we have to create an enum type, and then convert them to strings when we finally
-    // send out the telemetry, but the upside is we should have very good performance.
-    _uiTimesUsed[code]++;
-    _uiTimesUsedCurrent++;
-}
+    auto& instance = Instance();
+    std::lock_guard lock{ instance._mutex };
 
-// Routine Description:
-// - Logs a particular VT100 escape code failed or was unsupported.
-//
-// Arguments:
-// - code - VT100 code.
-// Return Value:
-// - <none>
-void TermTelemetry::LogFailed(const wchar_t wch) noexcept
-{
-    if (wch > CHAR_MAX)
+    unsigned int used = 0;
+    for (auto n = 0; n < NUMBER_OF_CODES; n++)
     {
-        _uiTimesFailedOutsideRange++;
-        _uiTimesFailedOutsideRangeCurrent++;
+        instance._uiTimesUsed[n] += shard.timesUsed[n];
+        used += shard.timesUsed[n];
+        shard.timesUsed[n] = 0;
     }
-    else
+    instance._uiTimesUsedCurrent += used;
+
+    unsigned int failed = 0;
+    for (auto n = 0; n <= CHAR_MAX; n++)
     {
-        // Even though we pass over a wide character, we only care about the ASCII single byte character.
-        _uiTimesFailed[wch]++;
-        _uiTimesFailedCurrent++;
+        instance._uiTimesFailed[n] += shard.timesFailed[n];
+        failed += shard.timesFailed[n];
+        shard.timesFailed[n] = 0;
     }
+    instance._uiTimesFailedCurrent += failed;
+
+    instance._uiTimesFailedOutsideRange += shard.timesFailedOutsideRange;
+    instance._uiTimesFailedOutsideRangeCurrent += shard.timesFailedOutsideRange;
+    shard.timesFailedOutsideRange = 0;
+
+    shard.pending = 0;
 }
 
 // Routine Description:
@@ -98,6 +97,7 @@ void TermTelemetry::LogFailed(const wchar_t wch) noexcept
 // - total number.
 unsigned int TermTelemetry::GetAndResetTimesUsedCurrent() noexcept
 {
+    std::lock_guard lock{ _mutex };
     const auto temp = _uiTimesUsedCurrent;
     _uiTimesUsedCurrent = 0;
     return temp;
@@ -112,6 +112,7 @@ unsigned int TermTelemetry::GetAndResetTimesUsedCurrent() noexcept
 // - total number.
 unsigned int TermTelemetry::GetAndResetTimesFailedCurrent() noexcept
 {
+    std::lock_guard lock{ _mutex };
     const auto temp = _uiTimesFailedCurrent;
     _uiTimesFailedCurrent = 0;
     return temp;
@@ -126,6 +127,7 @@ unsigned int TermTelemetry::GetAndResetTimesFailedCurrent() noexcept
 // - total number.
 unsigned int TermTelemetry::GetAndResetTimesFailedOutsideRangeCurrent() noexcept
 {
+    std::lock_guard lock{ _mutex };
     const auto temp = _uiTimesFailedOutsideRangeCurrent;
     _uiTimesFailedOutsideRangeCurrent = 0;
     return temp;
@@ -166,6 +168,7 @@ void TermTelemetry::SetActivityId(const GUID* activityId) noexcept
 // - <none>
 void TermTelemetry::WriteFinalTraceLog() const
 {
+    std::lock_guard lock{ _mutex };
     if (_fShouldWriteFinalLog)
     {
         // Determine if we've logged any VT100 sequences at all.
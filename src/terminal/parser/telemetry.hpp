@@ -15,6 +15,7 @@ Abstract:
 #include <winmeta.h>
 #include <TraceLoggingProvider.h>
 #include "climits"
+#include <mutex>
 
 TRACELOGGING_DECLARE_PROVIDER(g_hConsoleVirtTermParserEventTraceProvider);
 
@@ -128,8 +129,45 @@ namespace Microsoft::Console::VirtualTerminal
             // Only use this last enum as a count of the number of codes.
             NUMBER_OF_CODES
         };
-        void Log(const Codes code) noexcept;
-        void LogFailed(const wchar_t wch) noexcept;
+        // Logging is sharded per thread: the dispatch loops only ever touch
+        // a thread-local counter block (no shared cache lines, no branches
+        // beyond a threshold check), and shards fold into the instance totals
+        // every ShardFlushThreshold events and at thread exit. Totals are
+        // therefore eventually consistent, which is all the periodic sampler
+        // and the final log need. Define CON_VT_TELEMETRY_DISABLED to compile
+        // the logging down to nothing.
+        void Log(const Codes code) noexcept
+        {
+#ifndef CON_VT_TELEMETRY_DISABLED
+            auto& shard = _localShard();
+            shard.timesUsed[code]++;
+            if (++shard.pending >= ShardFlushThreshold)
+            {
+                _flushShard(shard);
+            }
+#endif
+        }
+
+        void LogFailed(const wchar_t wch) noexcept
+        {
+#ifndef CON_VT_TELEMETRY_DISABLED
+            auto& shard = _localShard();
+            if (wch > CHAR_MAX)
+            {
+                shard.timesFailedOutsideRange++;
+            }
+            else
+            {
+                // Even though we pass over a wide character, we only care about the ASCII single byte character.
+                shard.timesFailed[wch]++;
+            }
+            if (++shard.pending >= ShardFlushThreshold)
+            {
+                _flushShard(shard);
+            }
+#endif
+        }
+
         void SetShouldWriteFinalLog(const bool writeLog) noexcept;
         void SetActivityId(const GUID* activityId) noexcept;
         unsigned int GetAndResetTimesUsedCurrent() noexcept;
@@ -137,6 +175,34 @@ namespace Microsoft::Console::VirtualTerminal
         unsigned int GetAndResetTimesFailedOutsideRangeCurrent() noexcept;
 
     private:
+        static constexpr unsigned int ShardFlushThreshold = 4096;
+
+        struct ThreadShard
+        {
+            unsigned int timesUsed[NUMBER_OF_CODES]{};
+            unsigned int timesFailed[CHAR_MAX + 1]{};
+            unsigned int timesFailedOutsideRange = 0;
+            unsigned int pending = 0;
+
+            // Whatever the thread accumulated below the flush threshold is
+            // folded in when the thread goes away.
+            ~ThreadShard()
+            {
+                if (pending)
+                {
+                    _flushShard(*this);
+                }
+            }
+        };
+
+        static ThreadShard& _localShard() noexcept
+        {
+            static thread_local ThreadShard shard;
+            return shard;
+        }
+
+        static void _flushShard(ThreadShard& shard) noexcept;
+
         // Used to prevent multiple instances
         TermTelemetry() noexcept;
         ~TermTelemetry();
@@ -147,6 +213,7 @@ namespace Microsoft::Console::VirtualTerminal
 
         void WriteFinalTraceLog() const;
 
+        mutable std::mutex _mutex;
         unsigned int _uiTimesUsedCurrent;
         unsigned int _uiTimesFailedCurrent;
         unsigned int _uiTimesFailedOutsideRangeCurrent;
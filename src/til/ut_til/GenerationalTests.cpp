@@ -39,4 +39,50 @@ class GenerationalTests
         // ...and all values are copied over.
         VERIFY_ARE_EQUAL(123, dst->value);
     }
+
+    TEST_METHOD(Published)
+    {
+        struct Metrics
+        {
+            int width = 0;
+            int height = 0;
+        };
+
+        til::published<Metrics> channel{ Metrics{ 8, 16 } };
+
+        Metrics read;
+        channel.fetch(read);
+        VERIFY_ARE_EQUAL(8, read.width);
+        VERIFY_ARE_EQUAL(16, read.height);
+
+        channel.publish(Metrics{ 10, 20 });
+        channel.fetch(read);
+        VERIFY_ARE_EQUAL(10, read.width);
+        VERIFY_ARE_EQUAL(20, read.height);
+
+        // Fetching again without a publish re-reads the same state.
+        channel.fetch(read);
+        VERIFY_ARE_EQUAL(10, read.width);
+
+        // Hammer it from a writer thread while reading: every observed
+        // state must be internally consistent (height == 2 * width).
+        std::atomic<bool> stop{ false };
+        std::thread writer([&]() {
+            for (auto i = 1; !stop.load(std::memory_order_relaxed); ++i)
+            {
+                channel.publish(Metrics{ i, 2 * i });
+            }
+        });
+
+        auto consistent = true;
+        for (auto i = 0; i < 100000; ++i)
+        {
+            channel.fetch(read);
+            consistent = consistent && (read.width * 2 == read.height);
+        }
+        VERIFY_IS_TRUE(consistent);
+
+        stop = true;
+        writer.join();
+    }
 };
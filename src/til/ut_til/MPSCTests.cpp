@@ -0,0 +1,130 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+#include "WexTestClass.h"
+
+#include <til/mpsc.h>
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+
+class MPSCTests
+{
+    BEGIN_TEST_CLASS(MPSCTests)
+        TEST_CLASS_PROPERTY(L"TestTimeout", L"0:0:10") // 10s timeout
+    END_TEST_CLASS()
+
+    TEST_METHOD(SmokeTest);
+    TEST_METHOD(FullAndEmptyTest);
+    TEST_METHOD(BatchTest);
+    TEST_METHOD(MultiProducerIntegrationTest);
+};
+
+void MPSCTests::SmokeTest()
+{
+    til::mpsc::queue<int> q{ 8 };
+
+    VERIFY_IS_TRUE(q.try_push(1));
+    VERIFY_IS_TRUE(q.try_push(2));
+
+    int v = 0;
+    VERIFY_IS_TRUE(q.try_pop(v));
+    VERIFY_ARE_EQUAL(1, v);
+    VERIFY_IS_TRUE(q.try_pop(v));
+    VERIFY_ARE_EQUAL(2, v);
+    VERIFY_IS_FALSE(q.try_pop(v));
+}
+
+void MPSCTests::FullAndEmptyTest()
+{
+    til::mpsc::queue<int> q{ 4 };
+
+    for (auto i = 0; i < 4; ++i)
+    {
+        VERIFY_IS_TRUE(q.try_push(i));
+    }
+    // The ring is full now; a push must fail rather than overwrite.
+    VERIFY_IS_FALSE(q.try_push(99));
+
+    int v = -1;
+    VERIFY_IS_TRUE(q.try_pop(v));
+    VERIFY_ARE_EQUAL(0, v);
+
+    // One slot freed; one push fits again.
+    VERIFY_IS_TRUE(q.try_push(100));
+    VERIFY_IS_FALSE(q.try_push(101));
+
+    // Drain and verify order.
+    for (const auto expected : { 1, 2, 3, 100 })
+    {
+        VERIFY_IS_TRUE(q.try_pop(v));
+        VERIFY_ARE_EQUAL(expected, v);
+    }
+    VERIFY_IS_FALSE(q.try_pop(v));
+}
+
+void MPSCTests::BatchTest()
+{
+    til::mpsc::queue<int> q{ 8 };
+
+    const std::array<int, 6> in{ 1, 2, 3, 4, 5, 6 };
+    VERIFY_ARE_EQUAL(size_t{ 6 }, q.push_n(in.begin(), in.size()));
+
+    std::array<int, 6> out{};
+    VERIFY_ARE_EQUAL(size_t{ 4 }, q.pop_n(out.begin(), 4));
+    VERIFY_ARE_EQUAL(1, out[0]);
+    VERIFY_ARE_EQUAL(4, out[3]);
+    VERIFY_ARE_EQUAL(size_t{ 2 }, q.pop_n(out.begin(), 6));
+    VERIFY_ARE_EQUAL(5, out[0]);
+    VERIFY_ARE_EQUAL(6, out[1]);
+}
+
+void MPSCTests::MultiProducerIntegrationTest()
+{
+    constexpr auto producers = 4;
+    constexpr auto perProducer = 10000;
+
+    til::mpsc::queue<int> q{ 1024 };
+
+    std::vector<std::thread> threads;
+    for (auto p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&q, p]() {
+            for (auto i = 0; i < perProducer; ++i)
+            {
+                // Encode producer and index so the consumer can check that
+                // each producer's items arrive in its own order.
+                while (!q.try_push(p * perProducer + i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::array<int, producers> nextExpected{};
+    auto received = 0;
+    int v = 0;
+    while (received < producers * perProducer)
+    {
+        if (!q.try_pop(v))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        const auto producer = v / perProducer;
+        const auto index = v % perProducer;
+        VERIFY_ARE_EQUAL(nextExpected[producer], index);
+        ++nextExpected[producer];
+        ++received;
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    VERIFY_IS_FALSE(q.try_pop(v));
+}
@@ -0,0 +1,77 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+#include "WexTestClass.h"
+
+#include <til/pmr.h>
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+
+class PmrArenaTests
+{
+    BEGIN_TEST_CLASS(PmrArenaTests)
+    END_TEST_CLASS()
+
+    TEST_METHOD(BumpAndRewind)
+    {
+        til::pmr::arena_resource arena{ 64 };
+
+        const auto before = arena.mark();
+        const auto a = arena.allocate(16, 8);
+        const auto b = arena.allocate(16, 8);
+        VERIFY_IS_NOT_NULL(a);
+        VERIFY_IS_NOT_NULL(b);
+        VERIFY_ARE_NOT_EQUAL(a, b);
+
+        // Exceed the first chunk; a new one is created rather than failing.
+        const auto big = arena.allocate(128, 16);
+        VERIFY_IS_NOT_NULL(big);
+        VERIFY_IS_TRUE((reinterpret_cast<uintptr_t>(big) & 15) == 0);
+
+        arena.rewind(before);
+
+        // After rewinding, the same addresses come back out: the chunks were
+        // kept and the bump pointer reset.
+        const auto a2 = arena.allocate(16, 8);
+        VERIFY_ARE_EQUAL(a, a2);
+    }
+
+    TEST_METHOD(ScopedNesting)
+    {
+        void* inner = nullptr;
+        void* outerFirst = nullptr;
+        {
+            til::pmr::scoped_arena outer;
+            outerFirst = outer.resource()->allocate(32, 8);
+            {
+                til::pmr::scoped_arena innerScope;
+                inner = innerScope.resource()->allocate(32, 8);
+                VERIFY_ARE_NOT_EQUAL(outerFirst, inner);
+            }
+            // The inner scope rewound; its space is reusable.
+            const auto again = outer.resource()->allocate(32, 8);
+            VERIFY_ARE_EQUAL(inner, again);
+        }
+        {
+            // The outer scope rewound too; everything is reusable.
+            til::pmr::scoped_arena fresh;
+            const auto again = fresh.resource()->allocate(32, 8);
+            VERIFY_ARE_EQUAL(outerFirst, again);
+        }
+    }
+
+    TEST_METHOD(PmrContainer)
+    {
+        til::pmr::scoped_arena arena;
+        std::pmr::vector<int> vec{ arena.resource() };
+        for (auto i = 0; i < 1000; ++i)
+        {
+            vec.push_back(i);
+        }
+        VERIFY_ARE_EQUAL(size_t{ 1000 }, vec.size());
+        VERIFY_ARE_EQUAL(999, vec.back());
+    }
+};
@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+#include "precomp.h"
+#include "WexTestClass.h"
+
+#include <til/rle_encode.h>
+
+using namespace WEX::Common;
+using namespace WEX::Logging;
+using namespace WEX::TestExecution;
+
+class RleEncodeTests
+{
+    BEGIN_TEST_CLASS(RleEncodeTests)
+    END_TEST_CLASS()
+
+    using run = std::pair<uint32_t, uint16_t>;
+
+    static std::vector<run> encode(const std::vector<uint32_t>& data)
+    {
+        std::vector<run> out;
+        til::rle_encode<uint16_t>(data.data(), data.size(), std::back_inserter(out));
+        return out;
+    }
+
+    TEST_METHOD(Simple)
+    {
+        const auto runs = encode({ 7, 7, 7, 9, 9, 7 });
+        VERIFY_ARE_EQUAL(size_t{ 3 }, runs.size());
+        VERIFY_ARE_EQUAL((run{ 7, 3 }), runs[0]);
+        VERIFY_ARE_EQUAL((run{ 9, 2 }), runs[1]);
+        VERIFY_ARE_EQUAL((run{ 7, 1 }), runs[2]);
+    }
+
+    TEST_METHOD(Uniform)
+    {
+        // One run, regardless of where the vector loop's tail lands.
+        for (size_t n : { size_t{ 1 }, size_t{ 3 }, size_t{ 4 }, size_t{ 5 }, size_t{ 120 } })
+        {
+            const auto runs = encode(std::vector<uint32_t>(n, 42));
+            VERIFY_ARE_EQUAL(size_t{ 1 }, runs.size());
+            VERIFY_ARE_EQUAL((run{ 42, static_cast<uint16_t>(n) }), runs[0]);
+        }
+    }
+
+    TEST_METHOD(Alternating)
+    {
+        // Worst case: every cell is its own run, across the SIMD width.
+        std::vector<uint32_t> data;
+        for (uint32_t i = 0; i < 33; ++i)
+        {
+            data.push_back(i & 1);
+        }
+        const auto runs = encode(data);
+        VERIFY_ARE_EQUAL(size_t{ 33 }, runs.size());
+        for (size_t i = 0; i < runs.size(); ++i)
+        {
+            VERIFY_ARE_EQUAL((run{ static_cast<uint32_t>(i & 1), 1 }), runs[i]);
+        }
+    }
+
+    TEST_METHOD(Empty)
+    {
+        const auto runs = encode({});
+        VERIFY_ARE_EQUAL(size_t{ 0 }, runs.size());
+    }
+
+    TEST_METHOD(BoundariesAroundVectorTail)
+    {
+        // A boundary exactly in the scalar tail after the vector loop.
+        std::vector<uint32_t> data(10, 5);
+        data[9] = 6;
+        const auto runs = encode(data);
+        VERIFY_ARE_EQUAL(size_t{ 2 }, runs.size());
+        VERIFY_ARE_EQUAL((run{ 5, 9 }), runs[0]);
+        VERIFY_ARE_EQUAL((run{ 6, 1 }), runs[1]);
+    }
+};
@@ -368,4 +368,28 @@ class SmallVectorTests
         til::small_vector<int, 5> expected{ { -1, -1, 0, 1, 2, 3, 3, 3, 4, 5, 5 } };
         VERIFY_ARE_EQUAL(expected, actual);
     }
+
+    TEST_METHOD(ResizeAndOverwrite)
+    {
+        til::small_vector<int, 4> vec{ { 1, 2 } };
+
+        // Grow past the inline capacity and fill without pre-zeroing; report
+        // a final size smaller than requested.
+        vec.resize_and_overwrite(16, [](int* data, size_t count) {
+            VERIFY_ARE_EQUAL(size_t{ 16 }, count);
+            // The existing prefix must have been relocated.
+            VERIFY_ARE_EQUAL(1, data[0]);
+            VERIFY_ARE_EQUAL(2, data[1]);
+            for (size_t i = 2; i < 10; ++i)
+            {
+                data[i] = static_cast<int>(i);
+            }
+            return size_t{ 10 };
+        });
+
+        VERIFY_ARE_EQUAL(size_t{ 10 }, vec.size());
+        VERIFY_ARE_EQUAL(1, vec[0]);
+        VERIFY_ARE_EQUAL(2, vec[1]);
+        VERIFY_ARE_EQUAL(9, vec[9]);
+    }
 };
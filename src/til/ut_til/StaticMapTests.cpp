@@ -120,4 +120,27 @@ class StaticMapTests
         VERIFY_THROWS(unused = intIntMap[7], std::runtime_error);
 #pragma warning(pop)
     }
+
+    TEST_METHOD(PerfectMap)
+    {
+        static constexpr til::perfect_static_map perfectMap{
+            std::pair{ uint64_t{ 10 }, 100 },
+            std::pair{ uint64_t{ 20 }, 200 },
+            std::pair{ uint64_t{ 30 }, 300 },
+            std::pair{ uint64_t{ 0 }, 42 }, // zero must be a usable key
+        };
+
+        VERIFY_ARE_EQUAL(100, perfectMap.at(10));
+        VERIFY_ARE_EQUAL(300, perfectMap.at(30));
+        VERIFY_ARE_EQUAL(42, perfectMap.at(0));
+
+        VERIFY_IS_TRUE(perfectMap.find(20) != perfectMap.end());
+        VERIFY_ARE_EQUAL(200, perfectMap.find(20)->second);
+        VERIFY_IS_TRUE(perfectMap.find(21) == perfectMap.end());
+        VERIFY_IS_TRUE(perfectMap.find(0xFFFFFFFFFFFFFFFF) == perfectMap.end());
+
+        auto unused = 0;
+        VERIFY_THROWS(unused = perfectMap.at(11), std::runtime_error);
+        unused;
+    }
 };
@@ -0,0 +1,308 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+// ApiBench: replays console API call traces against the live console server
+// this process is attached to, measuring the full client -> condrv ->
+// ApiDispatchers -> buffer pipeline. Unlike the parser and render benches,
+// nothing here is simulated: every call crosses the driver boundary, so the
+// numbers include message packing, the IO thread, the console lock, and the
+// buffer write itself. Launch it inside the conhost/OpenConsole build under
+// test (`OpenConsole.exe ApiBench.exe`) and compare calls/sec and MB/s
+// across server-path changes.
+//
+// Workloads:
+//   writetext - WriteConsoleW-heavy stream of build-log-style lines, the
+//               shape cooked shells and compilers produce.
+//   grid      - full-viewport WriteConsoleOutputW rectangles, the shape TUI
+//               apps and screen readers produce.
+//   mixed     - interleaved WriteConsoleW / ReadConsoleOutputW /
+//               WriteConsoleInputW+ReadConsoleInputW pairs, so the wait and
+//               wake path (CONSOLE_STATUS_WAIT -> ConsoleWaitQueue) is on
+//               the clock too.
+//   replay    - replays a captured byte stream from a file through
+//               WriteConsoleW in trace-sized chunks.
+
+#define NOMINMAX
+#include <windows.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct BenchResult
+    {
+        ULONGLONG calls = 0;
+        ULONGLONG bytes = 0;
+        double seconds = 0.0;
+    };
+
+    ULONGLONG queryNow()
+    {
+        LARGE_INTEGER li;
+        QueryPerformanceCounter(&li);
+        return li.QuadPart;
+    }
+
+    double toSeconds(const ULONGLONG ticks)
+    {
+        static const double frequency = [] {
+            LARGE_INTEGER li;
+            QueryPerformanceFrequency(&li);
+            return static_cast<double>(li.QuadPart);
+        }();
+        return ticks / frequency;
+    }
+
+    void report(const char* const name, const BenchResult& r)
+    {
+        printf("%-10s %10llu calls  %12llu bytes  %8.3f s  %12.0f calls/s  %10.2f MB/s\n",
+               name,
+               r.calls,
+               r.bytes,
+               r.seconds,
+               r.calls / r.seconds,
+               r.bytes / r.seconds / (1024.0 * 1024.0));
+    }
+
+    // Deterministic build-log-style lines: mostly ASCII, varying lengths,
+    // the occasional wide path separator run. Seeded so every run replays
+    // the identical call sequence.
+    std::vector<std::wstring> makeLogCorpus()
+    {
+        std::vector<std::wstring> lines;
+        unsigned seed = 0x5eed;
+        for (int i = 0; i < 256; ++i)
+        {
+            seed = seed * 1103515245 + 12345;
+            const size_t len = 20 + (seed >> 16) % 180;
+            std::wstring line;
+            line.reserve(len + 2);
+            wchar_t buf[32];
+            swprintf_s(buf, L"[%4d/ 256] ", i + 1);
+            line.append(buf);
+            while (line.size() < len)
+            {
+                line.push_back(L'a' + (seed >> 8) % 26);
+                seed = seed * 1103515245 + 12345;
+            }
+            line.append(L"\r\n");
+            lines.emplace_back(std::move(line));
+        }
+        return lines;
+    }
+
+    BenchResult benchWriteText(const HANDLE out, const int iterations)
+    {
+        const auto corpus = makeLogCorpus();
+        BenchResult r;
+        const auto start = queryNow();
+        for (int i = 0; i < iterations; ++i)
+        {
+            for (const auto& line : corpus)
+            {
+                DWORD written = 0;
+                WriteConsoleW(out, line.data(), static_cast<DWORD>(line.size()), &written, nullptr);
+                ++r.calls;
+                r.bytes += line.size() * sizeof(wchar_t);
+            }
+        }
+        r.seconds = toSeconds(queryNow() - start);
+        return r;
+    }
+
+    BenchResult benchGrid(const HANDLE out, const int iterations)
+    {
+        CONSOLE_SCREEN_BUFFER_INFO csbi{};
+        GetConsoleScreenBufferInfo(out, &csbi);
+        const SHORT width = csbi.srWindow.Right - csbi.srWindow.Left + 1;
+        const SHORT height = csbi.srWindow.Bottom - csbi.srWindow.Top + 1;
+
+        std::vector<CHAR_INFO> grid(static_cast<size_t>(width) * height);
+        for (size_t i = 0; i < grid.size(); ++i)
+        {
+            grid[i].Char.UnicodeChar = L'0' + i % 10;
+            grid[i].Attributes = static_cast<WORD>(i % 0x7f);
+        }
+
+        BenchResult r;
+        const auto start = queryNow();
+        for (int i = 0; i < iterations; ++i)
+        {
+            // Perturb one cell per frame so the server can't trivially elide
+            // the write, matching how a TUI repaints a mostly-static screen.
+            grid[i % grid.size()].Char.UnicodeChar = L'A' + i % 26;
+            SMALL_RECT target = csbi.srWindow;
+            WriteConsoleOutputW(out, grid.data(), { width, height }, { 0, 0 }, &target);
+            ++r.calls;
+            r.bytes += grid.size() * sizeof(CHAR_INFO);
+        }
+        r.seconds = toSeconds(queryNow() - start);
+        return r;
+    }
+
+    BenchResult benchMixed(const HANDLE out, const HANDLE in, const int iterations)
+    {
+        const auto corpus = makeLogCorpus();
+        std::vector<wchar_t> readBack(120);
+
+        INPUT_RECORD key{};
+        key.EventType = KEY_EVENT;
+        key.Event.KeyEvent.bKeyDown = TRUE;
+        key.Event.KeyEvent.wRepeatCount = 1;
+        key.Event.KeyEvent.uChar.UnicodeChar = L'x';
+
+        BenchResult r;
+        const auto start = queryNow();
+        for (int i = 0; i < iterations; ++i)
+        {
+            const auto& line = corpus[i % corpus.size()];
+            DWORD count = 0;
+
+            WriteConsoleW(out, line.data(), static_cast<DWORD>(line.size()), &count, nullptr);
+            ++r.calls;
+            r.bytes += line.size() * sizeof(wchar_t);
+
+            CONSOLE_SCREEN_BUFFER_INFO csbi{};
+            GetConsoleScreenBufferInfo(out, &csbi);
+            ++r.calls;
+
+            SMALL_RECT region = csbi.srWindow;
+            region.Bottom = region.Top;
+            CHAR_INFO row[200];
+            const SHORT width = std::min<SHORT>(200, region.Right - region.Left + 1);
+            ReadConsoleOutputW(out, row, { width, 1 }, { 0, 0 }, &region);
+            ++r.calls;
+            r.bytes += static_cast<ULONGLONG>(width) * sizeof(CHAR_INFO);
+
+            // Queue a key, then read it back: the read parks on the wait
+            // queue until the write satisfies it, exercising the same
+            // wait/wake machinery a blocked ReadConsoleInput client does.
+            WriteConsoleInputW(in, &key, 1, &count);
+            ++r.calls;
+            INPUT_RECORD received{};
+            ReadConsoleInputW(in, &received, 1, &count);
+            ++r.calls;
+            r.bytes += 2 * sizeof(INPUT_RECORD);
+        }
+        r.seconds = toSeconds(queryNow() - start);
+        return r;
+    }
+
+    BenchResult benchReplay(const HANDLE out, const wchar_t* const path, const int iterations)
+    {
+        FILE* f = nullptr;
+        if (_wfopen_s(&f, path, L"rb") != 0 || !f)
+        {
+            fwprintf(stderr, L"ApiBench: cannot open trace file '%s'\n", path);
+            return {};
+        }
+        std::string raw;
+        char chunk[65536];
+        size_t got;
+        while ((got = fread(chunk, 1, sizeof(chunk), f)) > 0)
+        {
+            raw.append(chunk, got);
+        }
+        fclose(f);
+
+        const int needed = MultiByteToWideChar(CP_UTF8, 0, raw.data(), static_cast<int>(raw.size()), nullptr, 0);
+        std::wstring text(needed, L'\0');
+        MultiByteToWideChar(CP_UTF8, 0, raw.data(), static_cast<int>(raw.size()), text.data(), needed);
+
+        // Feed in the 4KB chunks a pipe-relay client (ConPTY, ssh) would.
+        constexpr size_t chunkChars = 4096 / sizeof(wchar_t);
+        BenchResult r;
+        const auto start = queryNow();
+        for (int i = 0; i < iterations; ++i)
+        {
+            for (size_t off = 0; off < text.size(); off += chunkChars)
+            {
+                const auto len = std::min(chunkChars, text.size() - off);
+                DWORD written = 0;
+                WriteConsoleW(out, text.data() + off, static_cast<DWORD>(len), &written, nullptr);
+                ++r.calls;
+                r.bytes += len * sizeof(wchar_t);
+            }
+        }
+        r.seconds = toSeconds(queryNow() - start);
+        return r;
+    }
+}
+
+int wmain(int argc, wchar_t* argv[])
+{
+    const auto out = GetStdHandle(STD_OUTPUT_HANDLE);
+    const auto in = GetStdHandle(STD_INPUT_HANDLE);
+
+    int iterations = 50;
+    const wchar_t* tracePath = nullptr;
+    bool runWriteText = true, runGrid = true, runMixed = true;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (wcscmp(argv[i], L"--iterations") == 0 && i + 1 < argc)
+        {
+            iterations = _wtoi(argv[++i]);
+        }
+        else if (wcscmp(argv[i], L"--replay") == 0 && i + 1 < argc)
+        {
+            tracePath = argv[++i];
+            runWriteText = runGrid = runMixed = false;
+        }
+        else if (wcscmp(argv[i], L"--only") == 0 && i + 1 < argc)
+        {
+            const auto name = argv[++i];
+            runWriteText = wcscmp(name, L"writetext") == 0;
+            runGrid = wcscmp(name, L"grid") == 0;
+            runMixed = wcscmp(name, L"mixed") == 0;
+        }
+        else
+        {
+            fwprintf(stderr, L"usage: ApiBench [--iterations N] [--only writetext|grid|mixed] [--replay trace.txt]\n");
+            return 1;
+        }
+    }
+
+    // The workload output would drown the report, so gather first and print
+    // after the screen noise.
+    BenchResult writeText, grid, mixed, replay;
+    if (runWriteText)
+    {
+        writeText = benchWriteText(out, iterations);
+    }
+    if (runGrid)
+    {
+        grid = benchGrid(out, iterations * 20);
+    }
+    if (runMixed)
+    {
+        mixed = benchMixed(out, in, iterations * 50);
+    }
+    if (tracePath)
+    {
+        replay = benchReplay(out, tracePath, iterations);
+    }
+
+    printf("\n--- ApiBench ---\n");
+    if (runWriteText)
+    {
+        report("writetext", writeText);
+    }
+    if (runGrid)
+    {
+        report("grid", grid);
+    }
+    if (runMixed)
+    {
+        report("mixed", mixed);
+    }
+    if (tracePath && replay.calls > 0)
+    {
+        report("replay", replay);
+    }
+    return 0;
+}
@@ -0,0 +1,438 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+// ConptyBench: measures the conhost -> pipe -> consumer half of the ConPTY
+// pipeline end to end. The parent creates a real pseudoconsole through the
+// repo's winconpty (so the side-by-side OpenConsole build under test is the
+// one on the clock, not the inbox conhost), relaunches itself inside it as
+// the workload client, and then plays the part of a headless terminal:
+// draining the output pipe as fast as it arrives and counting what flows by.
+//
+// Reported per workload:
+//   bytes/s - raw throughput across the pipe, the platform team's headline
+//             number.
+//   reads   - how many ReadFile completions delivered those bytes; the
+//             batching the consumer actually observes.
+//   frames  - completed VT frames, counted by the synchronized-update
+//             markers (CSI ? 2026 h) the VT renderer emits around every
+//             flush - one marker pair per conhost WriteFile.
+//
+// Workloads (the client side, running inside the conpty):
+//   flood   - plain text lines, the `cat bigfile` / build log shape.
+//   colorls - short lines with several SGR color runs each, the `ls --color`
+//             shape that stresses attribute run-length handling.
+//   tui     - full-screen repaints with a handful of changed cells per
+//             frame, the vim/htop diff-storm shape.
+//   scroll  - single-line writes that each push the viewport, the
+//             scroll-region shape that used to dominate circling costs.
+
+#define NOMINMAX
+#include <windows.h>
+
+#include <conpty-static.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct DrainResult
+    {
+        ULONGLONG bytes = 0;
+        ULONGLONG reads = 0;
+        ULONGLONG frames = 0;
+        double seconds = 0.0;
+        // Inter-frame gap percentiles, for jank rather than just averages.
+        double p50FrameMs = 0.0;
+        double p99FrameMs = 0.0;
+    };
+
+    // Computes the given percentile (0..1) over a sorted copy of samples.
+    double percentile(std::vector<double> samples, const double p)
+    {
+        if (samples.empty())
+        {
+            return 0.0;
+        }
+        std::sort(samples.begin(), samples.end());
+        const auto idx = std::min(samples.size() - 1, static_cast<size_t>(p * samples.size()));
+        return samples[idx];
+    }
+
+    ULONGLONG queryNow()
+    {
+        LARGE_INTEGER li;
+        QueryPerformanceCounter(&li);
+        return li.QuadPart;
+    }
+
+    double toSeconds(const ULONGLONG ticks)
+    {
+        static const double frequency = [] {
+            LARGE_INTEGER li;
+            QueryPerformanceFrequency(&li);
+            return static_cast<double>(li.QuadPart);
+        }();
+        return ticks / frequency;
+    }
+
+    void report(const wchar_t* const name, const DrainResult& r, const bool json)
+    {
+        if (json)
+        {
+            // One object per line, so results concatenate into JSONL that
+            // perf dashboards ingest without a wrapper.
+            wprintf(L"{\"workload\":\"%s\",\"bytes\":%llu,\"reads\":%llu,\"frames\":%llu,\"seconds\":%.6f,\"mbps\":%.3f,\"framesPerSecond\":%.1f,\"p50FrameMs\":%.3f,\"p99FrameMs\":%.3f}\n",
+                    name,
+                    r.bytes,
+                    r.reads,
+                    r.frames,
+                    r.seconds,
+                    r.bytes / r.seconds / (1024.0 * 1024.0),
+                    r.frames / r.seconds,
+                    r.p50FrameMs,
+                    r.p99FrameMs);
+            return;
+        }
+
+        wprintf(L"%-8s %12llu bytes  %8llu reads  %8llu frames  %8.3f s  %10.2f MB/s  %10.0f frames/s  p50 %6.2fms  p99 %6.2fms\n",
+                name,
+                r.bytes,
+                r.reads,
+                r.frames,
+                r.seconds,
+                r.bytes / r.seconds / (1024.0 * 1024.0),
+                r.frames / r.seconds,
+                r.p50FrameMs,
+                r.p99FrameMs);
+    }
+
+    // Counts occurrences of the frame-begin marker in the stream. Chunks are
+    // scanned in place (copying every byte just to count would tax the very
+    // throughput we're measuring); only the few bytes that could be a marker
+    // prefix are carried across read boundaries.
+    struct FrameCounter
+    {
+        static constexpr std::string_view marker{ "\x1b[?2026h" };
+
+        ULONGLONG count = 0;
+        std::string carry;
+
+        void feed(const char* const data, const size_t size)
+        {
+            const std::string_view chunk{ data, size };
+            const auto keep = marker.size() - 1;
+
+            // A marker can straddle a read boundary: stitch the carried tail
+            // onto the head of this chunk and count matches that span the
+            // seam. Matches wholly inside the chunk are counted below.
+            if (!carry.empty())
+            {
+                auto seam = carry;
+                const auto seamStart = seam.size();
+                seam.append(chunk.substr(0, std::min(size, keep)));
+                for (size_t pos = 0; (pos = seam.find(marker, pos)) != std::string::npos; pos += marker.size())
+                {
+                    if (pos < seamStart)
+                    {
+                        ++count;
+                    }
+                }
+            }
+
+            for (size_t pos = 0; (pos = chunk.find(marker, pos)) != std::string::npos; pos += marker.size())
+            {
+                ++count;
+            }
+
+            // Keep whatever trailing bytes could still become a marker once
+            // the next read arrives (accumulating across reads smaller than
+            // the marker itself).
+            if (size >= keep)
+            {
+                carry.assign(chunk.substr(size - keep));
+            }
+            else
+            {
+                carry.append(chunk);
+                if (carry.size() > keep)
+                {
+                    carry.erase(0, carry.size() - keep);
+                }
+            }
+        }
+    };
+
+    // --- client side ------------------------------------------------------
+    // Everything below _Client* runs inside the pseudoconsole and writes to
+    // the attached conhost; the parent never sees these functions' cost
+    // directly, only the VT stream conhost renders from them.
+
+    void clientFlood(const HANDLE out, const int iterations)
+    {
+        unsigned seed = 0x5eed;
+        std::wstring line;
+        for (int i = 0; i < iterations * 1024; ++i)
+        {
+            line.clear();
+            seed = seed * 1103515245 + 12345;
+            const size_t len = 20 + (seed >> 16) % 160;
+            while (line.size() < len)
+            {
+                line.push_back(L'a' + (seed >> 8) % 26);
+                seed = seed * 1103515245 + 12345;
+            }
+            line.append(L"\r\n");
+            WriteConsoleW(out, line.data(), static_cast<DWORD>(line.size()), nullptr, nullptr);
+        }
+    }
+
+    void clientColorLs(const HANDLE out, const int iterations)
+    {
+        // drwxr-xr-x  1 user group  4096 Jan  1 00:00 <colored name>
+        static constexpr const wchar_t* names[] = { L"src", L"inc", L"main.cpp", L"a.out", L"notes.txt", L"build.ninja" };
+        static constexpr const wchar_t* colors[] = { L"\x1b[34m", L"\x1b[34m", L"\x1b[m", L"\x1b[32m", L"\x1b[m", L"\x1b[33m" };
+        std::wstring line;
+        for (int i = 0; i < iterations * 1024; ++i)
+        {
+            const auto n = i % ARRAYSIZE(names);
+            line.assign(L"\x1b[90mdrwxr-xr-x\x1b[m  1 \x1b[36muser\x1b[m \x1b[36mgroup\x1b[m  4096 Jan  1 00:00 ");
+            line.append(colors[n]);
+            line.append(names[n]);
+            line.append(L"\x1b[m\r\n");
+            WriteConsoleW(out, line.data(), static_cast<DWORD>(line.size()), nullptr, nullptr);
+        }
+    }
+
+    void clientTui(const HANDLE out, const int iterations, const SHORT width, const SHORT height)
+    {
+        // First paint the whole screen, then per "frame" home the cursor and
+        // rewrite a few scattered lines - the shape of a TUI status update.
+        std::wstring frame;
+        for (int i = 0; i < iterations * 64; ++i)
+        {
+            frame.assign(L"\x1b[H");
+            const int linesThisFrame = (i == 0) ? height : 4;
+            for (int l = 0; l < linesThisFrame; ++l)
+            {
+                const int row = (i == 0) ? l : (i * 7 + l * 13) % height;
+                wchar_t cup[16];
+                swprintf_s(cup, L"\x1b[%d;1H", row + 1);
+                frame.append(cup);
+                frame.append(static_cast<size_t>(width), L'a' + (i + l) % 26);
+            }
+            WriteConsoleW(out, frame.data(), static_cast<DWORD>(frame.size()), nullptr, nullptr);
+        }
+    }
+
+    void clientScroll(const HANDLE out, const int iterations)
+    {
+        // One short line per write: every one pushes the viewport down, so
+        // the cost is dominated by scroll/circling, not by text volume.
+        std::wstring line;
+        for (int i = 0; i < iterations * 2048; ++i)
+        {
+            line.assign(L"line ");
+            line.append(std::to_wstring(i));
+            line.append(L"\r\n");
+            WriteConsoleW(out, line.data(), static_cast<DWORD>(line.size()), nullptr, nullptr);
+        }
+    }
+
+    // --- parent side ------------------------------------------------------
+
+    DrainResult runWorkload(const wchar_t* const workload, const int iterations, const COORD size)
+    {
+        DrainResult r;
+
+        // Pipes between us (playing the terminal) and the conhost we spawn.
+        // Sized like the Terminal's own connection: roomy enough on the
+        // output side that the writer isn't capped by pipe capacity.
+        HANDLE outReadRaw{}, outWriteRaw{}, inReadRaw{}, inWriteRaw{};
+        if (!CreatePipe(&inReadRaw, &inWriteRaw, nullptr, 64 * 1024) ||
+            !CreatePipe(&outReadRaw, &outWriteRaw, nullptr, 1024 * 1024))
+        {
+            fwprintf(stderr, L"ConptyBench: CreatePipe failed (%lu)\n", GetLastError());
+            return r;
+        }
+
+        HPCON hPC{};
+        if (FAILED(ConptyCreatePseudoConsole(size, inReadRaw, outWriteRaw, 0, &hPC)))
+        {
+            fwprintf(stderr, L"ConptyBench: ConptyCreatePseudoConsole failed\n");
+            return r;
+        }
+        CloseHandle(inReadRaw);
+        CloseHandle(outWriteRaw);
+
+        // Relaunch ourselves inside the conpty as the workload client.
+        wchar_t selfPath[MAX_PATH];
+        GetModuleFileNameW(nullptr, selfPath, MAX_PATH);
+        wchar_t cmd[MAX_PATH * 2];
+        swprintf_s(cmd, L"\"%s\" --client %s --iterations %d", selfPath, workload, iterations);
+
+        STARTUPINFOEXW siEx{};
+        siEx.StartupInfo.cb = sizeof(STARTUPINFOEXW);
+        SIZE_T attrSize{};
+        InitializeProcThreadAttributeList(nullptr, 1, 0, &attrSize);
+        std::vector<std::byte> attrBuffer(attrSize);
+        siEx.lpAttributeList = reinterpret_cast<PPROC_THREAD_ATTRIBUTE_LIST>(attrBuffer.data());
+        InitializeProcThreadAttributeList(siEx.lpAttributeList, 1, 0, &attrSize);
+        UpdateProcThreadAttribute(siEx.lpAttributeList, 0, PROC_THREAD_ATTRIBUTE_PSEUDOCONSOLE, hPC, sizeof(HPCON), nullptr, nullptr);
+
+        PROCESS_INFORMATION pi{};
+        if (!CreateProcessW(nullptr, cmd, nullptr, nullptr, FALSE, EXTENDED_STARTUPINFO_PRESENT, nullptr, nullptr, &siEx.StartupInfo, &pi))
+        {
+            fwprintf(stderr, L"ConptyBench: CreateProcessW failed (%lu)\n", GetLastError());
+            ConptyClosePseudoConsole(hPC);
+            return r;
+        }
+        DeleteProcThreadAttributeList(siEx.lpAttributeList);
+
+        // Once the client exits, close the pseudoconsole so our read loop
+        // sees the pipe break. Done off-thread because we must keep draining
+        // the whole time - a full pipe would deadlock the measurement.
+        std::thread closer([&]() {
+            WaitForSingleObject(pi.hProcess, INFINITE);
+            ConptyClosePseudoConsole(hPC);
+            CloseHandle(inWriteRaw);
+        });
+
+        // The drain loop: the clock starts at the first byte, so conhost
+        // startup isn't part of the measurement.
+        std::vector<char> buffer(128 * 1024);
+        FrameCounter frames;
+        std::vector<double> frameGaps;
+        ULONGLONG start = 0;
+        auto lastFrameAt = ULONGLONG{ 0 };
+        auto framesSeen = ULONGLONG{ 0 };
+        for (;;)
+        {
+            DWORD read = 0;
+            if (!ReadFile(outReadRaw, buffer.data(), static_cast<DWORD>(buffer.size()), &read, nullptr) || read == 0)
+            {
+                break;
+            }
+            if (start == 0)
+            {
+                start = queryNow();
+                lastFrameAt = start;
+            }
+            r.bytes += read;
+            r.reads += 1;
+            frames.feed(buffer.data(), read);
+
+            // Frame completions since the last read give us inter-frame
+            // gaps. Multiple frames landing in one read share the gap; the
+            // skew is bounded by the read size, and it's the long gaps -
+            // the p99 - that we're hunting anyway.
+            if (frames.count > framesSeen)
+            {
+                const auto nowTicks = queryNow();
+                const auto gapMs = toSeconds(nowTicks - lastFrameAt) * 1000.0 / static_cast<double>(frames.count - framesSeen);
+                for (; framesSeen < frames.count; ++framesSeen)
+                {
+                    frameGaps.push_back(gapMs);
+                }
+                lastFrameAt = nowTicks;
+            }
+        }
+        r.seconds = toSeconds(queryNow() - start);
+        r.frames = frames.count;
+        r.p50FrameMs = percentile(frameGaps, 0.50);
+        r.p99FrameMs = percentile(frameGaps, 0.99);
+
+        closer.join();
+        CloseHandle(pi.hProcess);
+        CloseHandle(pi.hThread);
+        CloseHandle(outReadRaw);
+        return r;
+    }
+}
+
+int wmain(int argc, wchar_t* argv[])
+{
+    int iterations = 10;
+    const wchar_t* clientWorkload = nullptr;
+    const wchar_t* only = nullptr;
+    auto json = false;
+    COORD size{ 120, 30 };
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (wcscmp(argv[i], L"--iterations") == 0 && i + 1 < argc)
+        {
+            iterations = _wtoi(argv[++i]);
+        }
+        else if (wcscmp(argv[i], L"--client") == 0 && i + 1 < argc)
+        {
+            clientWorkload = argv[++i];
+        }
+        else if (wcscmp(argv[i], L"--only") == 0 && i + 1 < argc)
+        {
+            only = argv[++i];
+        }
+        else if (wcscmp(argv[i], L"--json") == 0)
+        {
+            json = true;
+        }
+        else if (wcscmp(argv[i], L"--size") == 0 && i + 2 < argc)
+        {
+            size.X = static_cast<SHORT>(_wtoi(argv[++i]));
+            size.Y = static_cast<SHORT>(_wtoi(argv[++i]));
+        }
+        else
+        {
+            fwprintf(stderr, L"usage: ConptyBench [--iterations N] [--only flood|colorls|tui|scroll] [--size W H] [--json]\n");
+            return 1;
+        }
+    }
+
+    if (clientWorkload)
+    {
+        // We're the instance inside the pseudoconsole: produce, don't report.
+        const auto out = GetStdHandle(STD_OUTPUT_HANDLE);
+        CONSOLE_SCREEN_BUFFER_INFO csbi{};
+        GetConsoleScreenBufferInfo(out, &csbi);
+        const SHORT width = csbi.srWindow.Right - csbi.srWindow.Left + 1;
+        const SHORT height = csbi.srWindow.Bottom - csbi.srWindow.Top + 1;
+
+        if (wcscmp(clientWorkload, L"flood") == 0)
+        {
+            clientFlood(out, iterations);
+        }
+        else if (wcscmp(clientWorkload, L"colorls") == 0)
+        {
+            clientColorLs(out, iterations);
+        }
+        else if (wcscmp(clientWorkload, L"tui") == 0)
+        {
+            clientTui(out, iterations, width, height);
+        }
+        else if (wcscmp(clientWorkload, L"scroll") == 0)
+        {
+            clientScroll(out, iterations);
+        }
+        return 0;
+    }
+
+    static constexpr const wchar_t* workloads[] = { L"flood", L"colorls", L"tui", L"scroll" };
+    if (!json)
+    {
+        wprintf(L"--- ConptyBench (%dx%d, %d iterations) ---\n", size.X, size.Y, iterations);
+    }
+    for (const auto workload : workloads)
+    {
+        if (only && wcscmp(only, workload) != 0)
+        {
+            continue;
+        }
+        report(workload, runWorkload(workload, iterations, size), json);
+    }
+    return 0;
+}
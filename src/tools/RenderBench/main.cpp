@@ -0,0 +1,174 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+// RenderBench: drives the renderer base with the (headless) VT engine and
+// synthesized invalidation/paint sequences, reporting frame-time percentiles.
+// The GPU engines can't run headless - they need a composition surface and a
+// device - so the VT engine stands in for the full IRenderEngine call stream:
+// StartPaint, buffer-line painting, cursor, EndPaint, Present. The workloads
+// model the interesting invalidation shapes: single-line updates, full-screen
+// repaints, and scrolling.
+
+#include <LibraryIncludes.h>
+
+#include <windows.h>
+
+#include "../../renderer/base/renderer.hpp"
+#include "../../renderer/inc/DummyRenderer.hpp"
+#include "../../renderer/vt/Xterm256Engine.hpp"
+#include "../../buffer/out/textBuffer.hpp"
+#include "../../types/inc/Viewport.hpp"
+
+using namespace Microsoft::Console::Render;
+using namespace Microsoft::Console::Types;
+
+namespace
+{
+    // Just enough IRenderData over a TextBuffer to let Renderer paint frames.
+    class BenchRenderData final : public IRenderData
+    {
+    public:
+        BenchRenderData(TextBuffer& buffer, const til::size viewSize) :
+            _buffer{ buffer },
+            _viewport{ Viewport::FromDimensions({ 0, 0 }, viewSize) }
+        {
+        }
+
+        Viewport GetViewport() noexcept override { return _viewport; }
+        til::point GetTextBufferEndPosition() const noexcept override { return { _viewport.RightInclusive(), _viewport.BottomInclusive() }; }
+        const TextBuffer& GetTextBuffer() const noexcept override { return _buffer; }
+        const FontInfo& GetFontInfo() const noexcept override { return _fontInfo; }
+        std::vector<Viewport> GetSelectionRects() noexcept override { return {}; }
+        void LockConsole() noexcept override {}
+        void UnlockConsole() noexcept override {}
+
+        til::point GetCursorPosition() const noexcept override { return _buffer.GetCursor().GetPosition(); }
+        bool IsCursorVisible() const noexcept override { return true; }
+        bool IsCursorOn() const noexcept override { return true; }
+        ULONG GetCursorHeight() const noexcept override { return 25; }
+        CursorType GetCursorStyle() const noexcept override { return CursorType::Legacy; }
+        ULONG GetCursorPixelWidth() const noexcept override { return 1; }
+        bool IsCursorDoubleWidth() const noexcept override { return false; }
+        const std::vector<RenderOverlay> GetOverlays() const noexcept override { return {}; }
+        const bool IsGridLineDrawingAllowed() noexcept override { return true; }
+        const std::wstring_view GetConsoleTitle() const noexcept override { return L"RenderBench"; }
+        const std::wstring GetHyperlinkUri(uint16_t) const override { return {}; }
+        const std::wstring GetHyperlinkCustomId(uint16_t) const override { return {}; }
+        const std::vector<size_t> GetPatternId(const til::point) const override { return {}; }
+
+        std::pair<COLORREF, COLORREF> GetAttributeColors(const TextAttribute&) const noexcept override { return { RGB(204, 204, 204), RGB(12, 12, 12) }; }
+        const bool IsSelectionActive() const override { return false; }
+        const bool IsBlockSelection() const override { return false; }
+        void ClearSelection() override {}
+        void SelectNewRegion(const til::point, const til::point) override {}
+        const til::point GetSelectionAnchor() const noexcept override { return {}; }
+        const til::point GetSelectionEnd() const noexcept override { return {}; }
+        void ColorSelection(const til::point, const til::point, const TextAttribute) override {}
+        const bool IsUiaDataInitialized() const noexcept override { return true; }
+
+    private:
+        TextBuffer& _buffer;
+        Viewport _viewport;
+        FontInfo _fontInfo{ L"Consolas", 54, 400, { 8, 16 }, 437 };
+    };
+
+    void fillRow(TextBuffer& buffer, const til::CoordType row, const std::wstring_view text, const TextAttribute attr)
+    {
+        RowWriteState state{
+            .text = text,
+            .columnBegin = 0,
+            .columnLimit = buffer.GetSize().Width(),
+        };
+        buffer.WriteLine(row, false, attr, state);
+    }
+
+    void report(const wchar_t* name, std::vector<double>& frameTimes)
+    {
+        std::sort(frameTimes.begin(), frameTimes.end());
+        const auto at = [&](double p) { return frameTimes[std::min(frameTimes.size() - 1, static_cast<size_t>(p * frameTimes.size()))] * 1e3; };
+        wprintf(L"%-16s frames: %5zu  p50: %7.3f ms  p90: %7.3f ms  p99: %7.3f ms\n", name, frameTimes.size(), at(0.50), at(0.90), at(0.99));
+    }
+
+    enum class Workload
+    {
+        SingleLine,
+        FullScreen,
+        Scroll,
+    };
+
+    void runWorkload(const wchar_t* name, const Workload workload)
+    {
+        static constexpr til::size viewSize{ 120, 50 };
+
+        // The buffer's own invalidation sink can be a dummy: the bench drives
+        // the real renderer's triggers explicitly per frame.
+        DummyRenderer bufferSink;
+        TextBuffer buffer{ viewSize, TextAttribute{}, 12, true, bufferSink };
+        BenchRenderData data{ buffer, viewSize };
+
+        // The VT engine happily writes to NUL, which is exactly the kind of
+        // infinitely fast sink you want when measuring the engine itself.
+        wil::unique_hfile nul{ CreateFileW(L"NUL", GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, 0, nullptr) };
+        THROW_LAST_ERROR_IF(!nul);
+        Xterm256Engine engine{ std::move(nul), Viewport::FromDimensions({ 0, 0 }, viewSize) };
+
+        RenderSettings renderSettings;
+        IRenderEngine* enginePtr = &engine;
+        Renderer renderer{ renderSettings, &data, &enginePtr, 1, nullptr };
+
+        const TextAttribute plain{};
+        TextAttribute colored{};
+        colored.SetIndexedForeground(2);
+
+        for (til::CoordType row = 0; row < viewSize.height; ++row)
+        {
+            fillRow(buffer, row, L"The quick brown fox jumps over the lazy dog 0123456789", plain);
+        }
+        renderer.TriggerRedrawAll();
+        LOG_IF_FAILED(renderer.PaintFrame());
+
+        std::vector<double> frameTimes;
+        frameTimes.reserve(2000);
+
+        for (auto frame = 0; frame < 2000; ++frame)
+        {
+            switch (workload)
+            {
+            case Workload::SingleLine:
+                fillRow(buffer, viewSize.height - 1, L"one line of fresh output for this frame", frame & 1 ? colored : plain);
+                renderer.TriggerRedraw(Viewport::FromDimensions({ 0, viewSize.height - 1 }, { viewSize.width, 1 }));
+                break;
+            case Workload::FullScreen:
+                for (til::CoordType row = 0; row < viewSize.height; ++row)
+                {
+                    fillRow(buffer, row, L"| cell | cell | cell | cell | cell | cell | cell |", frame & 1 ? colored : plain);
+                }
+                renderer.TriggerRedrawAll();
+                break;
+            case Workload::Scroll:
+            {
+                buffer.IncrementCircularBuffer();
+                fillRow(buffer, viewSize.height - 1, L"scrolled in line of log output for this frame", plain);
+                const til::point delta{ 0, -1 };
+                renderer.TriggerScroll(&delta);
+                renderer.TriggerRedraw(Viewport::FromDimensions({ 0, viewSize.height - 1 }, { viewSize.width, 1 }));
+                break;
+            }
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            LOG_IF_FAILED(renderer.PaintFrame());
+            frameTimes.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        }
+
+        report(name, frameTimes);
+    }
+}
+
+int __cdecl wmain(int /*argc*/, wchar_t** /*argv*/)
+{
+    runWorkload(L"single-line", Workload::SingleLine);
+    runWorkload(L"full-screen", Workload::FullScreen);
+    runWorkload(L"scroll", Workload::Scroll);
+    return 0;
+}
@@ -0,0 +1,227 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT license.
+
+// TilBench: microbenchmarks for the til primitives the hot paths lean on.
+// No external benchmark framework - a small harness in the style of the
+// other src/tools benches: each case runs its operation in a timed loop
+// against a volatile sink, and reports ns/op and ops/s. Run a Release
+// build; numbers from Debug measure the iterator debugging, not til.
+//
+//   TilBench [--filter substring] [--seconds N]
+
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+#include <LibraryIncludes.h>
+
+#include <til.h>
+#include <til/bitmap.h>
+#include <til/hash.h>
+#include <til/rle.h>
+#include <til/rle_encode.h>
+#include <til/small_vector.h>
+#include <til/spsc.h>
+
+#include <cstdio>
+
+namespace
+{
+    volatile uint64_t g_sink = 0;
+
+    double now()
+    {
+        static const double freq = [] {
+            LARGE_INTEGER li;
+            QueryPerformanceFrequency(&li);
+            return static_cast<double>(li.QuadPart);
+        }();
+        LARGE_INTEGER li;
+        QueryPerformanceCounter(&li);
+        return li.QuadPart / freq;
+    }
+
+    // Runs op() repeatedly for ~seconds, batching the clock out of the
+    // loop, and prints one report line.
+    template<typename Op>
+    void bench(const char* name, const char* filter, const double seconds, Op&& op)
+    {
+        if (filter && !strstr(name, filter))
+        {
+            return;
+        }
+
+        // Warm up + estimate a batch size that makes each timing slice
+        // ~10ms, so QueryPerformanceCounter overhead disappears.
+        auto batch = uint64_t{ 1 };
+        for (;;)
+        {
+            const auto t0 = now();
+            for (uint64_t i = 0; i < batch; ++i)
+            {
+                op();
+            }
+            const auto dt = now() - t0;
+            if (dt >= 0.01)
+            {
+                break;
+            }
+            batch *= 10;
+        }
+
+        uint64_t iterations = 0;
+        const auto start = now();
+        auto elapsed = 0.0;
+        do
+        {
+            for (uint64_t i = 0; i < batch; ++i)
+            {
+                op();
+            }
+            iterations += batch;
+            elapsed = now() - start;
+        } while (elapsed < seconds);
+
+        printf("%-28s %12.1f ns/op %14.0f ops/s\n", name, elapsed * 1e9 / iterations, iterations / elapsed);
+    }
+}
+
+int __cdecl wmain(int argc, wchar_t* argv[])
+{
+    const char* filter = nullptr;
+    char filterBuf[128]{};
+    auto seconds = 1.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (wcscmp(argv[i], L"--filter") == 0 && i + 1 < argc)
+        {
+            WideCharToMultiByte(CP_UTF8, 0, argv[++i], -1, filterBuf, sizeof(filterBuf) - 1, nullptr, nullptr);
+            filter = filterBuf;
+        }
+        else if (wcscmp(argv[i], L"--seconds") == 0 && i + 1 < argc)
+        {
+            seconds = _wtof(argv[++i]);
+        }
+        else
+        {
+            fwprintf(stderr, L"usage: TilBench [--filter substring] [--seconds N]\n");
+            return 1;
+        }
+    }
+
+    printf("--- TilBench (%.1fs per case) ---\n", seconds);
+
+    // rle: the batch replace the attribute rows perform per write, over a
+    // row-shaped run list.
+    {
+        til::small_rle<uint32_t, uint16_t, 2> row;
+        row.resize_trailing_extent(120);
+        row.replace(0, 120, 7);
+        uint16_t col = 0;
+        bench("rle.replace_batch", filter, seconds, [&]() {
+            row.replace(col, col + 8, static_cast<uint32_t>(col));
+            col = (col + 8) % 112;
+            g_sink += row.size();
+        });
+    }
+
+    // rle: the random probe hit-testing performs.
+    {
+        til::small_rle<uint32_t, uint16_t, 2> row;
+        row.resize_trailing_extent(120);
+        for (uint16_t i = 0; i < 120; i += 3)
+        {
+            row.replace(i, i + 1, i);
+        }
+        uint16_t col = 0;
+        bench("rle.at", filter, seconds, [&]() {
+            g_sink += row.at(col);
+            col = (col + 37) % 120;
+        });
+    }
+
+    // bitmap: runs() iteration, the renderer's per-frame dirty walk.
+    {
+        til::bitmap map{ til::size{ 120, 30 } };
+        for (auto y = 0; y < 30; y += 3)
+        {
+            map.set(til::rect{ 10, y, 90, y + 1 });
+        }
+        bench("bitmap.runs", filter, seconds, [&]() {
+            for (const auto& run : map.runs())
+            {
+                g_sink += static_cast<uint64_t>(run.width());
+            }
+        });
+    }
+
+    // hash: wstring throughput at viewport-line and viewport sizes.
+    {
+        const std::wstring line(120, L'x');
+        bench("hash.line_120ch", filter, seconds, [&]() {
+            g_sink += til::hash(line.data(), line.size() * sizeof(wchar_t));
+        });
+
+        const std::wstring screen(120 * 30, L'x');
+        bench("hash.screen_3600ch", filter, seconds, [&]() {
+            g_sink += til::hash(screen.data(), screen.size() * sizeof(wchar_t));
+        });
+    }
+
+    // small_vector: the grow-from-inline push pattern of run assembly.
+    {
+        bench("small_vector.push_grow", filter, seconds, [&]() {
+            til::small_vector<uint32_t, 8> vec;
+            for (uint32_t i = 0; i < 64; ++i)
+            {
+                vec.push_back(i);
+            }
+            g_sink += vec.back();
+        });
+    }
+
+    // rle_encode: the flat-row run extraction.
+    {
+        std::vector<uint32_t> cells(120, 7);
+        cells[40] = 8;
+        cells[80] = 9;
+        std::vector<std::pair<uint32_t, uint16_t>> runs;
+        runs.reserve(8);
+        bench("rle_encode.row_120", filter, seconds, [&]() {
+            runs.clear();
+            g_sink += til::rle_encode<uint16_t>(cells.data(), cells.size(), std::back_inserter(runs));
+        });
+    }
+
+    // spsc: ping-pong latency between two threads.
+    if (!filter || strstr("spsc.pingpong", filter))
+    {
+        auto [tx1, rx1] = til::spsc::channel<int>(16);
+        auto [tx2, rx2] = til::spsc::channel<int>(16);
+
+        std::thread echo([rx = std::move(rx1), tx = std::move(tx2)]() mutable {
+            int v;
+            while (rx.pop_n(til::spsc::block_forever, &v, 1).first == 1)
+            {
+                if (v < 0 || tx.push_n(til::spsc::block_forever, &v, 1).first != 1)
+                {
+                    break;
+                }
+            }
+        });
+
+        bench("spsc.pingpong", filter, seconds, [&]() {
+            int v = 1;
+            tx1.push_n(til::spsc::block_forever, &v, 1);
+            rx2.pop_n(til::spsc::block_forever, &v, 1);
+            g_sink += static_cast<uint64_t>(v);
+        });
+
+        int quit = -1;
+        tx1.push_n(til::spsc::block_forever, &quit, 1);
+        echo.join();
+    }
+
+    return static_cast<int>(g_sink & 1);
+}
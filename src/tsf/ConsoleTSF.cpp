@@ -476,6 +476,40 @@ CConversionArea* CConsoleTSF::CreateConversionArea()
     return _pConversionArea;
 }
 
+//+---------------------------------------------------------------------------
+//
+// CConsoleTSF::GetCategoryAndDisplayAttributeManagers()
+//
+//----------------------------------------------------------------------------
+
+[[nodiscard]] HRESULT CConsoleTSF::GetCategoryAndDisplayAttributeManagers(CicCategoryMgr** ppCatMgr,
+                                                                          CicDisplayAttributeMgr** ppDispAttr)
+{
+    // The managers wrap CoCreated TSF services plus an enumeration of every
+    // display attribute category. Recreating them inside each edit session
+    // made every composition update pay that setup cost again, so they're
+    // created once and reused for the lifetime of this TSF connection. The
+    // returned pointers are borrowed.
+    if (!_pCicCatMgr || !_pCicDispAttr)
+    {
+        auto pTmpCat = std::make_unique<CicCategoryMgr>();
+        RETURN_IF_FAILED(pTmpCat->InitCategoryInstance());
+
+        const auto pcat = pTmpCat->GetCategoryMgr();
+        RETURN_HR_IF_NULL(E_FAIL, pcat);
+
+        auto pTmpDispAttr = std::make_unique<CicDisplayAttributeMgr>();
+        RETURN_IF_FAILED(pTmpDispAttr->InitDisplayAttributeInstance(pcat));
+
+        _pCicCatMgr = std::move(pTmpCat);
+        _pCicDispAttr = std::move(pTmpDispAttr);
+    }
+
+    *ppCatMgr = _pCicCatMgr.get();
+    *ppDispAttr = _pCicDispAttr.get();
+    return S_OK;
+}
+
 //+---------------------------------------------------------------------------
 //
 // CConsoleTSF::OnUpdateComposition()
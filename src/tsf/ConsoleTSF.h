@@ -21,6 +21,9 @@ Notes:
 
 #pragma once
 
+#include "TfCatUtil.h"
+#include "TfDispAttr.h"
+
 class CConversionArea;
 
 class CConsoleTSF final :
@@ -46,6 +49,8 @@ public:
     virtual ~CConsoleTSF() = default;
     [[nodiscard]] HRESULT Initialize();
     void Uninitialize();
+    [[nodiscard]] HRESULT GetCategoryAndDisplayAttributeManagers(CicCategoryMgr** ppCatMgr,
+                                                                 CicDisplayAttributeMgr** ppDispAttr);
 
 public:
     // IUnknown methods
@@ -210,6 +215,11 @@ private:
     BOOL _fModifyingDoc = FALSE; // Set TRUE, when calls ITfRange::SetText
     BOOL _fCoInitialized = FALSE;
     BOOL _fEditSessionRequested = FALSE;
+
+    // Cicero category/display-attribute managers, created on first use and
+    // reused by every edit session. See GetCategoryAndDisplayAttributeManagers.
+    std::unique_ptr<CicCategoryMgr> _pCicCatMgr;
+    std::unique_ptr<CicDisplayAttributeMgr> _pCicDispAttr;
     BOOL _fCleanupSessionRequested = FALSE;
     BOOL _fCompositionCleanupSkipped = FALSE;
 
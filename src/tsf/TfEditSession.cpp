@@ -825,9 +825,9 @@ CEditSessionObject::Release()
     CicDisplayAttributeMgr* pDispAttr = nullptr;
 
     //
-    // Create Cicero Category Manager and Display Attribute Manager
+    // Get the cached Cicero Category Manager and Display Attribute Manager.
     //
-    hr = _CreateCategoryAndDisplayAttributeManager(&pCicCat, &pDispAttr);
+    hr = g_pConsoleTSF ? g_pConsoleTSF->GetCategoryAndDisplayAttributeManagers(&pCicCat, &pDispAttr) : E_FAIL;
     if (SUCCEEDED(hr))
     {
         if (fInterim)
@@ -846,15 +846,6 @@ CEditSessionObject::Release()
         }
     }
 
-    if (pCicCat)
-    {
-        delete pCicCat;
-    }
-    if (pDispAttr)
-    {
-        delete pDispAttr;
-    }
-
     return hr;
 }
 
@@ -1108,60 +1099,3 @@ CEditSessionObject::Release()
 
     return S_OK;
 }
-
-//+---------------------------------------------------------------------------
-//
-// CEditSessionUpdateCompositionString::_CreateCategoryAndDisplayAttributeManager
-//
-//----------------------------------------------------------------------------
-
-[[nodiscard]] HRESULT CEditSessionUpdateCompositionString::_CreateCategoryAndDisplayAttributeManager(
-    CicCategoryMgr** pCicCatMgr,
-    CicDisplayAttributeMgr** pCicDispAttr)
-{
-    auto hr = E_OUTOFMEMORY;
-
-    CicCategoryMgr* pTmpCat = nullptr;
-    CicDisplayAttributeMgr* pTmpDispAttr = nullptr;
-
-    //
-    // Create Cicero Category Manager
-    //
-    pTmpCat = new (std::nothrow) CicCategoryMgr;
-    if (pTmpCat)
-    {
-        if (SUCCEEDED(hr = pTmpCat->InitCategoryInstance()))
-        {
-            auto pcat = pTmpCat->GetCategoryMgr();
-            if (pcat)
-            {
-                //
-                // Create Cicero Display Attribute Manager
-                //
-                pTmpDispAttr = new (std::nothrow) CicDisplayAttributeMgr;
-                if (pTmpDispAttr)
-                {
-                    if (SUCCEEDED(hr = pTmpDispAttr->InitDisplayAttributeInstance(pcat)))
-                    {
-                        *pCicCatMgr = pTmpCat;
-                        *pCicDispAttr = pTmpDispAttr;
-                    }
-                }
-            }
-        }
-    }
-
-    if (FAILED(hr))
-    {
-        if (pTmpCat)
-        {
-            delete pTmpCat;
-        }
-        if (pTmpDispAttr)
-        {
-            delete pTmpDispAttr;
-        }
-    }
-
-    return hr;
-}
@@ -214,6 +214,4 @@ private:
                                              CicCategoryMgr* pCicCatMgr,
                                              CicDisplayAttributeMgr* pCicDispAttr);
 
-    [[nodiscard]] HRESULT _CreateCategoryAndDisplayAttributeManager(CicCategoryMgr** pCicCatMgr,
-                                                                    CicDisplayAttributeMgr** pCicDispAttr);
 };
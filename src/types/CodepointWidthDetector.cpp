@@ -323,6 +323,38 @@ namespace
         UnicodeRange{ 0xf0000, 0xffffd, 1 },
         UnicodeRange{ 0x100000, 0x10fffd, 1 },
     };
+
+    // A bit-packed direct-lookup table over the BMP, built once from the
+    // range table above: 2 bits per codepoint (1 narrow, 2 wide, 3 ambiguous)
+    // for 16KiB total. Streaming CJK output hammers this classifier for every
+    // glyph on the write path, and a masked load beats a binary search over
+    // 297 ranges every time. Codepoints above the BMP are rare enough that
+    // they keep using the binary search.
+    const std::array<uint8_t, 0x10000 / 4>& bmpWidthTable() noexcept
+    {
+        static const auto table = []() noexcept {
+            std::array<uint8_t, 0x10000 / 4> t;
+            // Default everything to narrow (0b01 in each of the 4 slots).
+            t.fill(0x55);
+            for (const auto& range : s_wideAndAmbiguousTable)
+            {
+                if (range.lowerBound > 0xffff)
+                {
+                    break;
+                }
+                const auto upper = std::min<char32_t>(range.upperBound, 0xffff);
+                const auto value = range.isAmbiguous ? 3u : 2u;
+                for (auto cp = range.lowerBound; cp <= upper; ++cp)
+                {
+                    auto& slot = til::at(t, cp >> 2);
+                    const auto shift = (cp & 3) * 2;
+                    slot = gsl::narrow_cast<uint8_t>((slot & ~(3u << shift)) | (value << shift));
+                }
+            }
+            return t;
+        }();
+        return table;
+    }
 }
 
 // Routine Description:
@@ -377,6 +409,18 @@ bool CodepointWidthDetector::IsWide(const std::wstring_view& glyph) noexcept
 // GetWidth's slow-path for non-ASCII characters. Returns the number of columns the codepoint takes up in the terminal.
 uint8_t CodepointWidthDetector::_lookupGlyphWidth(const char32_t codepoint, const std::wstring_view& glyph) noexcept
 {
+    // BMP codepoints (the overwhelming majority, including all of CJK)
+    // resolve through the direct-lookup table with a single masked load.
+    if (codepoint <= 0xffff)
+    {
+        const auto packed = (til::at(bmpWidthTable(), codepoint >> 2) >> ((codepoint & 3) * 2)) & 3;
+        if (packed == 3)
+        {
+            return _checkFallbackViaCache(codepoint, glyph);
+        }
+        return gsl::narrow_cast<uint8_t>(packed);
+    }
+
 #pragma warning(suppress : 26447) // The function is declared 'noexcept' but calls function 'lower_bound<...>()' which may throw exceptions (f.6).
     const auto it = std::lower_bound(s_wideAndAmbiguousTable.begin(), s_wideAndAmbiguousTable.end(), codepoint);
     uint8_t width = 1;
@@ -2,6 +2,9 @@
 // Licensed under the MIT license.
 
 #include "precomp.h"
+
+#include <til/unicode.h>
+
 #include "inc/CodepointWidthDetector.hpp"
 #include "inc/GlyphWidth.hpp"
 
@@ -17,6 +20,60 @@ bool IsGlyphFullWidth(const std::wstring_view& glyph) noexcept
     return widthDetector.IsWide(glyph);
 }
 
+// Function Description:
+// - Measures how many terminal columns a run of text occupies, stopping once
+//      limit is reached. ASCII stretches are counted in one scan (one column
+//      per character, no classifier calls); only the rest goes through the
+//      width detector per cluster. This keeps per-character width dispatch
+//      out of run-level callers like the insert-mode measurement.
+til::CoordType MeasureTextColumns(const std::wstring_view& text, const til::CoordType limit) noexcept
+{
+    if (limit <= 0)
+    {
+        return 0;
+    }
+
+    til::CoordType columns = 0;
+    size_t pos = 0;
+    const auto size = text.size();
+
+    while (pos < size && columns < limit)
+    {
+        // Count the ASCII stretch in one scan.
+        auto asciiEnd = pos;
+        while (asciiEnd < size && til::at(text, asciiEnd) < 0x80)
+        {
+            ++asciiEnd;
+        }
+        if (asciiEnd != pos)
+        {
+            const auto budget = gsl::narrow_cast<size_t>(limit - columns);
+            columns += gsl::narrow_cast<til::CoordType>(std::min(asciiEnd - pos, budget));
+            pos = asciiEnd;
+            continue;
+        }
+
+        // Classify per cluster until ASCII resumes.
+        for (const auto& s : til::utf16_iterator{ text.substr(pos) })
+        {
+            if (til::at(s, 0) < 0x80)
+            {
+                break;
+            }
+            columns += IsGlyphFullWidth(s) ? 2 : 1;
+            pos += s.size();
+            if (columns >= limit)
+            {
+                break;
+            }
+        }
+    }
+
+    // A wide glyph straddling the limit counts only the cells up to it,
+    // exactly like a per-cell measuring walk.
+    return std::min(columns, limit);
+}
+
 // Function Description:
 // - determines if the glyph represented by the single character should be
 //      wide or not. See CodepointWidthDetector::IsWide
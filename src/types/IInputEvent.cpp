@@ -6,6 +6,92 @@
 
 #include <unordered_map>
 
+namespace
+{
+    // The slab the pooled operator new draws from. Every input event type
+    // must fit one slot; blocks once carved are never returned to the
+    // heap, only to the free list, so event churn can't fragment anything.
+    constexpr size_t InputEventSlotSize = 80;
+    constexpr size_t InputEventSlotsPerSlab = 128;
+
+    struct FreeSlot
+    {
+        FreeSlot* next;
+    };
+
+    struct InputEventPool
+    {
+        std::mutex mutex;
+        FreeSlot* freeList = nullptr;
+        std::vector<std::unique_ptr<std::byte[]>> slabs;
+    };
+
+    // Meyers singleton, so events constructed during other TUs' static
+    // initialization can't observe an unconstructed pool.
+    InputEventPool& pool()
+    {
+        static InputEventPool p;
+        return p;
+    }
+}
+
+void* IInputEvent::operator new(size_t size)
+{
+    if (size > InputEventSlotSize)
+    {
+        return ::operator new(size);
+    }
+
+    auto& p = pool();
+    std::lock_guard lock{ p.mutex };
+    if (!p.freeList)
+    {
+        auto slab = std::make_unique<std::byte[]>(InputEventSlotSize * InputEventSlotsPerSlab);
+        auto base = slab.get();
+        for (size_t i = 0; i < InputEventSlotsPerSlab; ++i)
+        {
+            const auto slot = reinterpret_cast<FreeSlot*>(base + i * InputEventSlotSize);
+            slot->next = p.freeList;
+            p.freeList = slot;
+        }
+        p.slabs.push_back(std::move(slab));
+    }
+
+    const auto slot = p.freeList;
+    p.freeList = slot->next;
+    return slot;
+}
+
+void IInputEvent::operator delete(void* ptr, size_t size) noexcept
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    // The same criterion that routed the allocation routes the free: the
+    // sized form tells us which side it came from in O(1).
+    if (size > InputEventSlotSize)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    auto& p = pool();
+    std::lock_guard lock{ p.mutex };
+    const auto slot = static_cast<FreeSlot*>(ptr);
+    slot->next = p.freeList;
+    p.freeList = slot;
+}
+
+// Keep the pool honest: every event type must fit a slot, or the new/delete
+// pair above silently bifurcates between pool and heap.
+static_assert(sizeof(KeyEvent) <= InputEventSlotSize);
+static_assert(sizeof(MouseEvent) <= InputEventSlotSize);
+static_assert(sizeof(WindowBufferSizeEvent) <= InputEventSlotSize);
+static_assert(sizeof(MenuEvent) <= InputEventSlotSize);
+static_assert(sizeof(FocusEvent) <= InputEventSlotSize);
+
 std::unique_ptr<IInputEvent> IInputEvent::Create(const INPUT_RECORD& record)
 {
     switch (record.EventType)
@@ -46,6 +46,16 @@ CATCH_RETURN();
 [[nodiscard]] HRESULT ScreenInfoUiaProviderBase::Signal(_In_ EVENTID eventId)
 {
     auto hr = S_OK;
+
+    // Don't raise anything when no UIA client is listening anymore. A screen
+    // reader that has disconnected would otherwise keep costing an automation
+    // event (and a cross-process broadcast) for every text change until the
+    // engine is torn down.
+    if (!UiaClientsAreListening())
+    {
+        return hr;
+    }
+
     // check to see if we're already firing this particular event
     if (_signalFiringMapping.find(eventId) != _signalFiringMapping.end() &&
         _signalFiringMapping[eventId] == true)
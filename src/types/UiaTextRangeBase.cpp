@@ -635,9 +635,12 @@ try
         auto end = foundLocation.second;
         bufferSize.IncrementInBounds(end, true);
 
-        // make sure what was found is within the bounds of the current range
-        if ((searchDirection == Search::Direction::Forward && end < _end) ||
-            (searchDirection == Search::Direction::Backward && start > _start))
+        // Make sure what was found is within the bounds of the current range.
+        // The comparisons are inclusive: a match that ends exactly at our
+        // exclusive end (or starts exactly at our start, going backwards)
+        // still lies entirely inside the range.
+        if ((searchDirection == Search::Direction::Forward && end <= _end) ||
+            (searchDirection == Search::Direction::Backward && start >= _start))
         {
             RETURN_IF_FAILED(Clone(ppRetVal));
             auto& range = static_cast<UiaTextRangeBase&>(**ppRetVal);
@@ -976,21 +979,53 @@ std::wstring UiaTextRangeBase::_getTextValue(til::CoordType maxLength) const
         auto inclusiveEnd = _end;
         bufferSize.DecrementInBounds(inclusiveEnd, true);
 
-        // reserve size in accordance to extracted text
-        const auto textRects = buffer.GetTextRects(_start, inclusiveEnd, _blockRange, true);
-        const auto bufferData = buffer.GetText(true,
-                                               false,
-                                               textRects);
-        const size_t textDataSize = bufferData.text.size() * bufferSize.Width();
-        textData.reserve(textDataSize);
-        for (const auto& text : bufferData.text)
+        // Extract the range row by row, straight off each ROW's backing text.
+        // The previous implementation built per-row rects and spun a cell
+        // iterator over every cell, which made Narrator's document-sized
+        // requests re-walk the entire scrollback under the console lock.
+        // This path is one bounded append per row and stops as soon as
+        // maxLength is satisfied.
+        const auto rowCount = gsl::narrow_cast<size_t>(inclusiveEnd.y - _start.y + 1);
+        textData.reserve(std::min(maxLengthAsSize, rowCount * gsl::narrow_cast<size_t>(bufferSize.Width() + 2)));
+
+        for (auto y = _start.y; y <= inclusiveEnd.y && textData.size() < maxLengthAsSize; ++y)
         {
-            if (textData.size() >= maxLengthAsSize)
+            const auto& row = buffer.GetRowByOffset(y);
+            const auto rowWidth = buffer.GetLineWidth(y);
+
+            auto colBeg = til::CoordType{ 0 };
+            auto colEnd = rowWidth;
+            if (_blockRange)
+            {
+                colBeg = std::min(_start.x, inclusiveEnd.x);
+                colEnd = std::max(_start.x, inclusiveEnd.x) + 1;
+            }
+            else
+            {
+                if (y == _start.y)
+                {
+                    colBeg = _start.x;
+                }
+                if (y == inclusiveEnd.y)
+                {
+                    colEnd = inclusiveEnd.x + 1;
+                }
+            }
+            colBeg = std::min(colBeg, rowWidth);
+            colEnd = std::min(colEnd, rowWidth);
+
+            if (colBeg < colEnd)
+            {
+                textData += row.GetTextBetween(colBeg, colEnd);
+            }
+
+            // Mirror TextBuffer::GetText: rows ending in a hard break get a
+            // CRLF, except after the final row.
+            if (y < inclusiveEnd.y && !row.WasWrapForced())
             {
-                // early exit; we're already at/past max length
-                break;
+                textData.push_back(UNICODE_CARRIAGERETURN);
+                textData.push_back(UNICODE_LINEFEED);
             }
-            textData += text;
         }
 
         // only use maxLength to resize down.
@@ -8,6 +8,111 @@
 
 #pragma hdrstop
 
+namespace
+{
+    // Returns true if every byte in the range is 7-bit ASCII.
+    bool _allBytesAscii(const char* data, size_t count) noexcept
+    {
+        size_t i = 0;
+#ifdef _M_AMD64
+        // Accumulate the sign bits of 16 bytes per step; any set bit means a
+        // byte >= 0x80 somewhere in the chunk.
+        for (; i + 16 <= count; i += 16)
+        {
+            const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            if (_mm_movemask_epi8(chunk) != 0)
+            {
+                return false;
+            }
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            if (static_cast<unsigned char>(data[i]) >= 0x80)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Returns true if every UTF-16 unit in the range is 7-bit ASCII.
+    bool _allWcharsAscii(const wchar_t* data, size_t count) noexcept
+    {
+        size_t i = 0;
+#ifdef _M_AMD64
+        const auto limit = _mm_set1_epi16(0x7F);
+        for (; i + 8 <= count; i += 8)
+        {
+            const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            // The signed compare catches 0x0080..0x7FFF; units >= 0x8000 are
+            // negative and slip past it, but their high byte's sign bit shows
+            // up in the movemask of the raw chunk, so OR the two together.
+            if (_mm_movemask_epi8(_mm_or_si128(_mm_cmpgt_epi16(chunk, limit), chunk)) != 0)
+            {
+                return false;
+            }
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            if (data[i] >= 0x80)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Returns true if the codepage maps the 7-bit ASCII range to itself, in
+    // which case ASCII-only text can bypass MultiByteToWideChar entirely.
+    // That holds for every codepage a console realistically runs in (all the
+    // SBCS/DBCS ANSI and OEM pages, UTF-8), but not for oddballs like the
+    // ISO-2022 family, UTF-7 or EBCDIC - and the exceptions can't be
+    // enumerated reliably, so each codepage is probed once and the verdict
+    // cached. The cache is thread-local because conversions run under
+    // different locks on different threads.
+    bool _asciiIsIdentity(const UINT codePage) noexcept
+    {
+        struct CacheEntry
+        {
+            UINT codePage = 0;
+            bool identity = false;
+        };
+        // A console process flips between at most a couple of codepages.
+        thread_local CacheEntry cache[2];
+
+        for (const auto& entry : cache)
+        {
+            if (entry.codePage == codePage)
+            {
+                return entry.identity;
+            }
+        }
+
+        char source[128];
+        wchar_t converted[128]{};
+        for (auto i = 0; i < 128; ++i)
+        {
+            source[i] = static_cast<char>(i);
+        }
+
+        auto identity = MultiByteToWideChar(codePage, 0, &source[0], 128, &converted[0], 128) == 128;
+        if (identity)
+        {
+            for (auto i = 0; i < 128; ++i)
+            {
+                identity &= converted[i] == static_cast<wchar_t>(i);
+            }
+        }
+
+        // Simple replacement policy: shift the newest entry in front.
+        cache[1] = cache[0];
+        cache[0] = { codePage, identity };
+        return identity;
+    }
+}
+
 // Routine Description:
 // - Takes a multibyte string, allocates the appropriate amount of memory for the conversion, performs the conversion,
 //   and returns the Unicode UTF-16 result in the smart pointer (and the length).
@@ -19,10 +124,30 @@
 // - NOTE: Throws suitable HRESULT errors from memory allocation, safe math, or MultiByteToWideChar failures.
 [[nodiscard]] std::wstring ConvertToW(const UINT codePage, const std::string_view source)
 {
+    std::wstring out;
+    ConvertToW(codePage, source, out);
+    return out;
+}
+
+// Routine Description:
+// - Same as above, but converts into a caller-owned buffer whose capacity is
+//   reused across calls. ASCII-only text in ASCII-transparent codepages is
+//   widened directly, without consulting MultiByteToWideChar at all.
+void ConvertToW(const UINT codePage, const std::string_view source, std::wstring& out)
+{
+    out.clear();
+
     // If there's nothing to convert, bail early.
     if (source.empty())
     {
-        return {};
+        return;
+    }
+
+    if (_allBytesAscii(source.data(), source.size()) && _asciiIsIdentity(codePage))
+    {
+        out.resize(source.size());
+        std::copy_n(source.data(), source.size(), out.data());
+        return;
     }
 
     int iSource; // convert to int because Mb2Wc requires it.
@@ -43,14 +168,10 @@
     THROW_IF_FAILED(IntToSizeT(iTarget, &cchNeeded));
 
     // Allocate ourselves some space
-    std::wstring out;
     out.resize(cchNeeded);
 
     // Attempt conversion for real.
     THROW_LAST_ERROR_IF_AND_IGNORE_BAD_GLE(0 == MultiByteToWideChar(codePage, 0, source.data(), iSource, out.data(), iTarget));
-
-    // Return as a string
-    return out;
 }
 
 // Routine Description:
@@ -64,10 +185,29 @@
 // - NOTE: Throws suitable HRESULT errors from memory allocation, safe math, or MultiByteToWideChar failures.
 [[nodiscard]] std::string ConvertToA(const UINT codepage, const std::wstring_view source)
 {
+    std::string out;
+    ConvertToA(codepage, source, out);
+    return out;
+}
+
+// Routine Description:
+// - Same as above, but converts into a caller-owned buffer whose capacity is
+//   reused across calls, with the same ASCII fast path as ConvertToW.
+void ConvertToA(const UINT codepage, const std::wstring_view source, std::string& out)
+{
+    out.clear();
+
     // If there's nothing to convert, bail early.
     if (source.empty())
     {
-        return {};
+        return;
+    }
+
+    if (_allWcharsAscii(source.data(), source.size()) && _asciiIsIdentity(codepage))
+    {
+        out.resize(source.size());
+        std::copy_n(source.data(), source.size(), out.data());
+        return;
     }
 
     int iSource; // convert to int because Wc2Mb requires it.
@@ -84,7 +224,6 @@
     THROW_IF_FAILED(IntToSizeT(iTarget, &cchNeeded));
 
     // Allocate ourselves some space
-    std::string out;
     out.resize(cchNeeded);
 
     // Attempt conversion for real.
@@ -92,9 +231,6 @@
 #pragma prefast(suppress: __WARNING_W2A_BEST_FIT, "WC_NO_BEST_FIT_CHARS doesn't work in many codepages. Retain old behavior.")
     // clang-format on
     THROW_LAST_ERROR_IF(0 == WideCharToMultiByte(codepage, 0, source.data(), iSource, out.data(), iTarget, nullptr, nullptr));
-
-    // Return as a string
-    return out;
 }
 
 // Routine Description:
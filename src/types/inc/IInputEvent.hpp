@@ -57,6 +57,15 @@ public:
 
     virtual InputEventType EventType() const noexcept = 0;
 
+    // Input events are tiny, uniform-sized, and churned at input-storm
+    // rates (mouse reporting allocates one per pixel of movement). They
+    // allocate from a fixed-size free-list pool instead of the general
+    // heap: allocation is a pointer pop, and the heap stops fragmenting
+    // into event-sized holes. Oversized requests (none today; the
+    // static_assert in the .cpp keeps it that way) fall back to the heap.
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr, size_t size) noexcept;
+
 #ifdef UNIT_TESTING
     friend std::wostream& operator<<(std::wostream& stream, const IInputEvent* const pEvent);
 #endif
@@ -30,6 +30,17 @@ enum class CodepointWidth : BYTE
 [[nodiscard]] std::string ConvertToA(const UINT codepage,
                                      const std::wstring_view source);
 
+// Overloads that convert into a caller-owned buffer, replacing its contents
+// but reusing its capacity. Callers on hot paths keep one buffer alive and
+// stop paying an allocation per conversion.
+void ConvertToW(const UINT codepage,
+                const std::string_view source,
+                std::wstring& out);
+
+void ConvertToA(const UINT codepage,
+                const std::wstring_view source,
+                std::string& out);
+
 [[nodiscard]] size_t GetALengthFromW(const UINT codepage,
                                      const std::wstring_view source);
 
@@ -67,6 +67,8 @@ namespace Microsoft::Console::Utils
 
     std::wstring FilterStringForPaste(const std::wstring_view wstr, const FilterOption option);
 
+    int64_t MillisecondsSinceProcessLaunch() noexcept;
+
     constexpr uint16_t EndianSwap(uint16_t value)
     {
         return (value & 0xFF00) >> 8 |
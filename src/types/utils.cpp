@@ -528,6 +528,26 @@ catch (...)
 // - option - option to use.
 // Return Value:
 // - The result string.
+// Function Description:
+// - How long this process has been alive, measured from the kernel's process
+//   creation timestamp. Used to stamp startup phase telemetry with a time
+//   base that's identical across all the modules involved in launch.
+// Return Value:
+// - milliseconds elapsed between process creation and now
+int64_t Utils::MillisecondsSinceProcessLaunch() noexcept
+{
+    static const int64_t creation = []() {
+        FILETIME creationTime{}, exitTime{}, kernelTime{}, userTime{};
+        GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime);
+        return static_cast<int64_t>((ULARGE_INTEGER{ { creationTime.dwLowDateTime, creationTime.dwHighDateTime } }).QuadPart);
+    }();
+
+    FILETIME nowFt{};
+    GetSystemTimePreciseAsFileTime(&nowFt);
+    const auto now = static_cast<int64_t>((ULARGE_INTEGER{ { nowFt.dwLowDateTime, nowFt.dwHighDateTime } }).QuadPart);
+    return (now - creation) / 10000;
+}
+
 std::wstring Utils::FilterStringForPaste(const std::wstring_view wstr, const FilterOption option)
 {
     std::wstring filtered;
@@ -93,6 +93,16 @@ static bool _HandleIsValid(HANDLE h) noexcept
     return (h != INVALID_HANDLE_VALUE) && (h != nullptr);
 }
 
+// On a shared-memory transport: hInput/hOutput aren't ours to replace - the
+// caller creates them and the public contract is only that they're byte
+// stream handles usable with ReadFile/WriteFile (callers hand the read end
+// to ssh, tees, or other processes). A PSEUDOCONSOLE_* flag negotiating a
+// mapped ring would need conhost's VT writer to target a section + event
+// instead of a handle, a second read path in every consumer, and a fallback
+// story for the pipe contract - a new protocol on both ends, not a flag on
+// this function. The pipe-side costs are attacked where they live instead:
+// conhost coalesces frames into large single writes, and the reader drains
+// in batches.
 HRESULT _CreatePseudoConsole(const HANDLE hToken,
                              const COORD size,
                              const HANDLE hInput,